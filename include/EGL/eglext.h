@@ -466,6 +466,11 @@ EGLAPI EGLBoolean EGLAPIENTRY eglQuerySurfacePointerANGLE (EGLDisplay dpy, EGLSu
 #define EGL_PLATFORM_ANGLE_TYPE_OPENGLES_ANGLE 0x320A
 #endif /* EGL_ANGLE_platform_angle_opengl */
 
+#ifndef EGL_ANGLE_create_context_draw_coalescing
+#define EGL_ANGLE_create_context_draw_coalescing 1
+#define EGL_CONTEXT_DRAW_COALESCING_ANGLE 0x320D
+#endif /* EGL_ANGLE_create_context_draw_coalescing */
+
 #ifndef EGL_ARM_pixmap_multisample_discard
 #define EGL_ARM_pixmap_multisample_discard 1
 #define EGL_DISCARD_SAMPLES_ARM           0x3286
@@ -0,0 +1,205 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// ScratchMemoryPool.cpp: Implements the rx::ScratchMemoryPool class.
+
+#include "common/ScratchMemoryPool.h"
+
+#include <algorithm>
+
+#include "common/debug.h"
+
+namespace rx
+{
+
+namespace
+{
+
+const size_t SmallestSizeClassBytes = 4096;
+
+// Returned buffers left unleased for this many frames are freed by endFrame.
+const unsigned int ScratchMemoryIdleFrames = 120;
+
+// Returns the index of the smallest size class holding size bytes, or classCount if none does.
+size_t GetSizeClass(size_t size, size_t classCount)
+{
+    size_t sizeClass = 0;
+    size_t classBytes = SmallestSizeClassBytes;
+    while (classBytes < size && sizeClass < classCount)
+    {
+        classBytes <<= 1;
+        sizeClass++;
+    }
+    return sizeClass;
+}
+
+size_t GetSizeClassBytes(size_t sizeClass)
+{
+    return SmallestSizeClassBytes << sizeClass;
+}
+
+}
+
+ScratchMemoryLease::ScratchMemoryLease()
+    : mPool(NULL),
+      mBuffer(NULL),
+      mSize(0)
+{
+}
+
+ScratchMemoryLease::~ScratchMemoryLease()
+{
+    release();
+}
+
+void ScratchMemoryLease::release()
+{
+    if (mBuffer)
+    {
+        mPool->returnBuffer(mBuffer);
+    }
+
+    mPool = NULL;
+    mBuffer = NULL;
+    mSize = 0;
+}
+
+const uint8_t *ScratchMemoryLease::data() const
+{
+    ASSERT(mBuffer);
+    return mBuffer->data();
+}
+
+uint8_t *ScratchMemoryLease::data()
+{
+    ASSERT(mBuffer);
+    return mBuffer->data();
+}
+
+ScratchMemoryPool::FrameStats::FrameStats()
+    : leases(0),
+      allocations(0),
+      highWaterBytes(0)
+{
+}
+
+ScratchMemoryPool::ScratchMemoryPool(size_t maxRetainedBytes)
+    : mMaxRetainedBytes(maxRetainedBytes),
+      mRetainedBytes(0),
+      mLeasedBytes(0),
+      mFrame(0)
+{
+}
+
+ScratchMemoryPool::~ScratchMemoryPool()
+{
+    ASSERT(mLeasedBytes == 0);
+    clear();
+}
+
+bool ScratchMemoryPool::lease(size_t size, ScratchMemoryLease *leaseOut)
+{
+    leaseOut->release();
+
+    size_t sizeClass = GetSizeClass(size, SizeClassCount);
+    MemoryBuffer *buffer = NULL;
+
+    if (sizeClass < SizeClassCount && !mFreeBuffers[sizeClass].empty())
+    {
+        // The most recently returned buffer is the most likely to still be in cache
+        buffer = mFreeBuffers[sizeClass].back().buffer;
+        mFreeBuffers[sizeClass].pop_back();
+        mRetainedBytes -= buffer->size();
+    }
+    else
+    {
+        // Requests past the largest class get exactly what they asked for, and are not kept
+        size_t allocationSize = (sizeClass < SizeClassCount) ? GetSizeClassBytes(sizeClass) : size;
+
+        buffer = new MemoryBuffer();
+        if (!buffer->resize(allocationSize))
+        {
+            // Memory may be short because of what the pool is holding on to
+            clear();
+            if (!buffer->resize(allocationSize))
+            {
+                SafeDelete(buffer);
+                return false;
+            }
+        }
+
+        mFrameStats.allocations++;
+    }
+
+    mLeasedBytes += buffer->size();
+    mFrameStats.leases++;
+    mFrameStats.highWaterBytes = std::max(mFrameStats.highWaterBytes, mLeasedBytes);
+
+    leaseOut->mPool = this;
+    leaseOut->mBuffer = buffer;
+    leaseOut->mSize = size;
+    return true;
+}
+
+void ScratchMemoryPool::returnBuffer(MemoryBuffer *buffer)
+{
+    size_t size = buffer->size();
+    ASSERT(mLeasedBytes >= size);
+    mLeasedBytes -= size;
+
+    size_t sizeClass = GetSizeClass(size, SizeClassCount);
+    if (sizeClass >= SizeClassCount || GetSizeClassBytes(sizeClass) != size ||
+        mRetainedBytes + size > mMaxRetainedBytes)
+    {
+        SafeDelete(buffer);
+        return;
+    }
+
+    FreeBuffer freeBuffer;
+    freeBuffer.buffer = buffer;
+    freeBuffer.lastUsedFrame = mFrame;
+    mFreeBuffers[sizeClass].push_back(freeBuffer);
+    mRetainedBytes += size;
+}
+
+void ScratchMemoryPool::endFrame()
+{
+    mLastFrameStats = mFrameStats;
+    mFrameStats = FrameStats();
+    mFrameStats.highWaterBytes = mLeasedBytes;
+    mFrame++;
+
+    for (size_t sizeClass = 0; sizeClass < SizeClassCount; sizeClass++)
+    {
+        // Buffers are pushed as they are returned, so the idle ones are at the front
+        std::vector<FreeBuffer> &freeBuffers = mFreeBuffers[sizeClass];
+        size_t idleCount = 0;
+        while (idleCount < freeBuffers.size() &&
+               mFrame - freeBuffers[idleCount].lastUsedFrame > ScratchMemoryIdleFrames)
+        {
+            mRetainedBytes -= freeBuffers[idleCount].buffer->size();
+            SafeDelete(freeBuffers[idleCount].buffer);
+            idleCount++;
+        }
+        freeBuffers.erase(freeBuffers.begin(), freeBuffers.begin() + idleCount);
+    }
+}
+
+void ScratchMemoryPool::clear()
+{
+    for (size_t sizeClass = 0; sizeClass < SizeClassCount; sizeClass++)
+    {
+        std::vector<FreeBuffer> &freeBuffers = mFreeBuffers[sizeClass];
+        for (size_t i = 0; i < freeBuffers.size(); i++)
+        {
+            SafeDelete(freeBuffers[i].buffer);
+        }
+        freeBuffers.clear();
+    }
+    mRetainedBytes = 0;
+}
+
+}
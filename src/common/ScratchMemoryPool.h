@@ -0,0 +1,106 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// ScratchMemoryPool.h: Defines the rx::ScratchMemoryPool class, which hands out temporary
+// buffers from power-of-two size classes and keeps returned ones for reuse in later frames.
+
+#ifndef COMMON_SCRATCHMEMORYPOOL_H_
+#define COMMON_SCRATCHMEMORYPOOL_H_
+
+#include "common/MemoryBuffer.h"
+
+#include <vector>
+
+namespace rx
+{
+
+class ScratchMemoryPool;
+
+// A buffer leased from a ScratchMemoryPool, returned to the pool on release or destruction.
+class ScratchMemoryLease
+{
+  public:
+    ScratchMemoryLease();
+    ~ScratchMemoryLease();
+
+    void release();
+
+    bool empty() const { return mBuffer == NULL; }
+    size_t size() const { return mSize; }
+    const uint8_t *data() const;
+    uint8_t *data();
+
+  private:
+    DISALLOW_COPY_AND_ASSIGN(ScratchMemoryLease);
+    friend class ScratchMemoryPool;
+
+    ScratchMemoryPool *mPool;
+    MemoryBuffer *mBuffer;
+    size_t mSize;
+};
+
+// Not thread safe; leases are taken and released on the thread that owns the pool, although the
+// leased memory itself may be used anywhere.
+class ScratchMemoryPool
+{
+  public:
+    struct FrameStats
+    {
+        FrameStats();
+
+        // Number of leases handed out
+        size_t leases;
+        // Number of leases that needed a new system allocation
+        size_t allocations;
+        // Largest number of leased bytes outstanding at once
+        size_t highWaterBytes;
+    };
+
+    explicit ScratchMemoryPool(size_t maxRetainedBytes);
+    ~ScratchMemoryPool();
+
+    // Returns false if the memory could not be allocated.
+    bool lease(size_t size, ScratchMemoryLease *leaseOut);
+
+    // Closes the current frame's stats, and frees returned buffers that have not been leased for a
+    // while so that a burst of large uploads does not keep its memory forever.
+    void endFrame();
+
+    // Frees every returned buffer. Outstanding leases are unaffected.
+    void clear();
+
+    const FrameStats &getLastFrameStats() const { return mLastFrameStats; }
+    size_t getRetainedBytes() const { return mRetainedBytes; }
+
+  private:
+    DISALLOW_COPY_AND_ASSIGN(ScratchMemoryPool);
+    friend class ScratchMemoryLease;
+
+    void returnBuffer(MemoryBuffer *buffer);
+
+    struct FreeBuffer
+    {
+        MemoryBuffer *buffer;
+        unsigned int lastUsedFrame;
+    };
+
+    // Classes run from 4KB to 16MB. Larger requests are rarely kept within the retention budget, so
+    // rounding them up would only waste memory.
+    static const size_t SizeClassCount = 13;
+
+    std::vector<FreeBuffer> mFreeBuffers[SizeClassCount];
+    size_t mMaxRetainedBytes;
+    size_t mRetainedBytes;
+    size_t mLeasedBytes;
+    unsigned int mFrame;
+
+    FrameStats mFrameStats;
+    FrameStats mLastFrameStats;
+};
+
+}
+
+#endif // COMMON_SCRATCHMEMORYPOOL_H_
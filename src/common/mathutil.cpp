@@ -11,6 +11,11 @@
 #include <algorithm>
 #include <math.h>
 
+#if defined(ANGLE_USE_SSE) && (defined(_MSC_VER) || defined(__SSE2__))
+#define ANGLE_MATHUTIL_SSE2
+#include <emmintrin.h>
+#endif
+
 namespace gl
 {
 
@@ -64,4 +69,241 @@ void convert999E5toRGBFloats(unsigned int input, float *red, float *green, float
     *blue = inputData->B * pow(2.0f, (int)inputData->E - g_sharedexp_bias - g_sharedexp_mantissabits);
 }
 
+#if defined(ANGLE_MATHUTIL_SSE2)
+namespace
+{
+
+inline __m128i Select(const __m128i &mask, const __m128i &a, const __m128i &b)
+{
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+// Computes value >> shift for each lane without a per-lane shift instruction. Values below 2^24
+// convert to float exactly and scaling by a power of two is exact, so truncating gives the floor.
+// The shift is passed as the biased float exponent of 2^-shift.
+inline __m128i ShiftRightVariable(const __m128i &value, const __m128i &scaleExponent)
+{
+    __m128 scale = _mm_castsi128_ps(_mm_slli_epi32(scaleExponent, 23));
+    return _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(value), scale));
+}
+
+// Mirrors float32ToFloat16 on four floats; the results are in the low 16 bits of each lane.
+inline __m128i Float32ToFloat16SSE2(const __m128 &input)
+{
+    __m128i bits = _mm_castps_si128(input);
+    __m128i sign = _mm_srli_epi32(_mm_and_si128(bits, _mm_set1_epi32(0x80000000)), 16);
+    __m128i abs = _mm_and_si128(bits, _mm_set1_epi32(0x7FFFFFFF));
+    __m128i roundBias = _mm_set1_epi32(0x00000FFF);
+    __m128i one = _mm_set1_epi32(1);
+
+    __m128i normal = _mm_add_epi32(abs, _mm_set1_epi32(0xC8000000));
+    normal = _mm_add_epi32(_mm_add_epi32(normal, roundBias), _mm_and_si128(_mm_srli_epi32(abs, 13), one));
+    normal = _mm_srli_epi32(normal, 13);
+
+    // Denormal lanes shift the mantissa right by 113 - exponent, which is 2^(exponent + 14 - 127)
+    __m128i mantissa = _mm_or_si128(_mm_and_si128(abs, _mm_set1_epi32(0x007FFFFF)), _mm_set1_epi32(0x00800000));
+    __m128i scaleExponent = _mm_add_epi32(_mm_srli_epi32(abs, 23), _mm_set1_epi32(14));
+    __m128i denormal = ShiftRightVariable(mantissa, scaleExponent);
+    denormal = _mm_add_epi32(_mm_add_epi32(denormal, roundBias), _mm_and_si128(_mm_srli_epi32(denormal, 13), one));
+    denormal = _mm_srli_epi32(denormal, 13);
+
+    __m128i isInfinity = _mm_cmpgt_epi32(abs, _mm_set1_epi32(0x47FFEFFF));
+    __m128i isDenormal = _mm_cmplt_epi32(abs, _mm_set1_epi32(0x38800000));
+
+    __m128i result = Select(isDenormal, denormal, normal);
+    result = Select(isInfinity, _mm_set1_epi32(0x7FFF), result);
+    return _mm_or_si128(result, sign);
+}
+
+// Mirrors float16ToFloat32 on four halves held in the low 16 bits of each lane.
+inline __m128 Float16ToFloat32SSE2(const __m128i &input)
+{
+    __m128i sign = _mm_slli_epi32(_mm_and_si128(input, _mm_set1_epi32(0x8000)), 16);
+    __m128i abs = _mm_and_si128(input, _mm_set1_epi32(0x7FFF));
+    __m128i exponent = _mm_and_si128(input, _mm_set1_epi32(0x7C00));
+
+    // Rebias the exponent; infinities and NaNs keep their maximum exponent
+    __m128i shifted = _mm_slli_epi32(abs, 13);
+    __m128i isInfNaN = _mm_cmpeq_epi32(exponent, _mm_set1_epi32(0x7C00));
+    __m128i bias = Select(isInfNaN, _mm_set1_epi32(0x70000000), _mm_set1_epi32(0x38000000));
+    __m128i normal = _mm_add_epi32(shifted, bias);
+
+    // Denormals are mantissa * 2^-24, which is exact in float
+    __m128 denormal = _mm_mul_ps(_mm_cvtepi32_ps(abs), _mm_set1_ps(1.0f / 16777216.0f));
+
+    __m128i isDenormal = _mm_cmpeq_epi32(exponent, _mm_setzero_si128());
+    __m128i result = Select(isDenormal, _mm_castps_si128(denormal), normal);
+    return _mm_castsi128_ps(_mm_or_si128(result, sign));
+}
+
+// Per-format constants for float32ToFloat11 and float32ToFloat10.
+struct Float11Traits
+{
+    static const int MantissaShift = 17;
+    static const int NaNShift0 = 17;
+    static const int NaNShift1 = 11;
+    static const int NaNShift2 = 6;
+    static const unsigned int Max = 0x7BF;
+    static const unsigned int MantissaMask = 0x3F;
+    static const unsigned int ExponentMask = 0x7C0;
+    static const unsigned int BitMask = 0x7FF;
+    static const unsigned int Float32Max = 0x477E0000;
+};
+
+struct Float10Traits
+{
+    static const int MantissaShift = 18;
+    static const int NaNShift0 = 18;
+    static const int NaNShift1 = 13;
+    static const int NaNShift2 = 3;
+    static const unsigned int Max = 0x3DF;
+    static const unsigned int MantissaMask = 0x1F;
+    static const unsigned int ExponentMask = 0x3E0;
+    static const unsigned int BitMask = 0x3FF;
+    static const unsigned int Float32Max = 0x477C0000;
+};
+
+// Mirrors float32ToFloat11 or float32ToFloat10 on four floats.
+template <typename Traits>
+inline __m128i Float32ToSmallFloatSSE2(const __m128i &bits)
+{
+    __m128i value = _mm_and_si128(bits, _mm_set1_epi32(0x7FFFFFFF));
+    __m128i float32ExponentMask = _mm_set1_epi32(0x7F800000);
+    __m128i float32MantissaMask = _mm_set1_epi32(0x007FFFFF);
+
+    __m128i normal = _mm_add_epi32(value, _mm_set1_epi32(0xC8000000));
+
+    __m128i mantissa = _mm_or_si128(_mm_and_si128(value, float32MantissaMask), _mm_set1_epi32(0x00800000));
+    __m128i scaleExponent = _mm_add_epi32(_mm_srli_epi32(value, 23), _mm_set1_epi32(14));
+    __m128i denormal = ShiftRightVariable(mantissa, scaleExponent);
+
+    __m128i isDenormal = _mm_cmplt_epi32(value, _mm_set1_epi32(0x38800000));
+    __m128i finite = Select(isDenormal, denormal, normal);
+    __m128i roundBias = _mm_set1_epi32((1 << (Traits::MantissaShift - 1)) - 1);
+    __m128i lsb = _mm_and_si128(_mm_srli_epi32(finite, Traits::MantissaShift), _mm_set1_epi32(1));
+    finite = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(finite, roundBias), lsb), Traits::MantissaShift);
+    finite = _mm_and_si128(finite, _mm_set1_epi32(Traits::BitMask));
+
+    __m128i nanMantissa = _mm_or_si128(_mm_or_si128(_mm_srli_epi32(value, Traits::NaNShift0), _mm_srli_epi32(value, Traits::NaNShift1)),
+                                       _mm_or_si128(_mm_srli_epi32(value, Traits::NaNShift2), value));
+    __m128i nan = _mm_or_si128(_mm_and_si128(nanMantissa, _mm_set1_epi32(Traits::MantissaMask)), _mm_set1_epi32(Traits::ExponentMask));
+
+    __m128i isInfNaN = _mm_cmpeq_epi32(_mm_and_si128(value, float32ExponentMask), float32ExponentMask);
+    __m128i isNaN = _mm_andnot_si128(_mm_cmpeq_epi32(_mm_and_si128(value, float32MantissaMask), _mm_setzero_si128()), isInfNaN);
+    __m128i isNegative = _mm_srai_epi32(bits, 31);
+    __m128i isTooLarge = _mm_cmpgt_epi32(value, _mm_set1_epi32(Traits::Float32Max));
+
+    __m128i result = Select(isTooLarge, _mm_set1_epi32(Traits::Max), finite);
+    result = Select(isInfNaN, _mm_set1_epi32(Traits::ExponentMask), result);
+    result = _mm_andnot_si128(isNegative, result);
+    return Select(isNaN, nan, result);
+}
+
+}
+#endif // ANGLE_MATHUTIL_SSE2
+
+void float32ToFloat16Array(const float *input, unsigned short *output, size_t count)
+{
+    size_t i = 0;
+
+#if defined(ANGLE_MATHUTIL_SSE2)
+    if (supportsSSE2())
+    {
+        for (; i + 7 < count; i += 8)
+        {
+            __m128i lo = Float32ToFloat16SSE2(_mm_loadu_ps(&input[i]));
+            __m128i hi = Float32ToFloat16SSE2(_mm_loadu_ps(&input[i + 4]));
+            // Sign-extend the 16-bit results so the saturating pack keeps their bits
+            lo = _mm_srai_epi32(_mm_slli_epi32(lo, 16), 16);
+            hi = _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(&output[i]), _mm_packs_epi32(lo, hi));
+        }
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        output[i] = float32ToFloat16(input[i]);
+    }
+}
+
+void float16ToFloat32Array(const unsigned short *input, float *output, size_t count)
+{
+    size_t i = 0;
+
+#if defined(ANGLE_MATHUTIL_SSE2)
+    if (supportsSSE2())
+    {
+        __m128i zero = _mm_setzero_si128();
+        for (; i + 7 < count; i += 8)
+        {
+            __m128i halves = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&input[i]));
+            _mm_storeu_ps(&output[i], Float16ToFloat32SSE2(_mm_unpacklo_epi16(halves, zero)));
+            _mm_storeu_ps(&output[i + 4], Float16ToFloat32SSE2(_mm_unpackhi_epi16(halves, zero)));
+        }
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        output[i] = float16ToFloat32(input[i]);
+    }
+}
+
+void convertRGBFloatsToR11G11B10Array(const float *input, unsigned int *output, size_t pixelCount)
+{
+    size_t i = 0;
+
+#if defined(ANGLE_MATHUTIL_SSE2)
+    if (supportsSSE2())
+    {
+        // Four pixels are twelve channels, where every third one is blue and converts to float10
+        const __m128i blueMask0 = _mm_setr_epi32(0, 0, -1, 0);
+        const __m128i blueMask1 = _mm_setr_epi32(0, -1, 0, 0);
+        const __m128i blueMask2 = _mm_setr_epi32(-1, 0, 0, -1);
+
+        for (; i + 3 < pixelCount; i += 4)
+        {
+            const float *source = &input[i * 3];
+            __m128i channels[3] =
+            {
+                _mm_castps_si128(_mm_loadu_ps(source + 0)),
+                _mm_castps_si128(_mm_loadu_ps(source + 4)),
+                _mm_castps_si128(_mm_loadu_ps(source + 8)),
+            };
+            const __m128i *blueMasks[3] = { &blueMask0, &blueMask1, &blueMask2 };
+
+            unsigned int converted[12];
+            for (size_t j = 0; j < 3; j++)
+            {
+                __m128i result = Select(*blueMasks[j], Float32ToSmallFloatSSE2<Float10Traits>(channels[j]),
+                                        Float32ToSmallFloatSSE2<Float11Traits>(channels[j]));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(&converted[j * 4]), result);
+            }
+
+            for (size_t j = 0; j < 4; j++)
+            {
+                output[i + j] = converted[j * 3 + 0] | (converted[j * 3 + 1] << 11) | (converted[j * 3 + 2] << 22);
+            }
+        }
+    }
+#endif
+
+    for (; i < pixelCount; i++)
+    {
+        output[i] = (float32ToFloat11(input[i * 3 + 0]) <<  0) |
+                    (float32ToFloat11(input[i * 3 + 1]) << 11) |
+                    (float32ToFloat10(input[i * 3 + 2]) << 22);
+    }
+}
+
+void convertRGBFloatsTo999E5Array(const float *input, unsigned int *output, size_t pixelCount)
+{
+    // The shared exponent comes from the C library's log, so there is no vector form that is bit-exact
+    for (size_t i = 0; i < pixelCount; i++)
+    {
+        output[i] = convertRGBFloatsTo999E5(input[i * 3 + 0], input[i * 3 + 1], input[i * 3 + 2]);
+    }
+}
+
 }
@@ -132,6 +132,9 @@ inline bool supportsSSE2()
     checked = true;
 
     return supports;
+#elif defined(ANGLE_USE_SSE) && defined(__SSE2__)
+    // The compiler already assumes SSE2 for this target
+    return true;
 #else
     UNIMPLEMENTED();
     return false;
@@ -241,7 +244,15 @@ inline unsigned short float32ToFloat11(float fp32)
             // The number is too small to be represented as a normalized float11
             // Convert it to a denormalized value.
             const unsigned int shift = (float32ExponentBias - float11ExponentBias) - (float32Val >> float32ExponentFirstBit);
-            float32Val = ((1 << float32ExponentFirstBit) | (float32Val & float32MantissaMask)) >> shift;
+            if (shift < 24)
+            {
+                float32Val = ((1 << float32ExponentFirstBit) | (float32Val & float32MantissaMask)) >> shift;
+            }
+            else
+            {
+                // Shifting out the whole 24-bit mantissa gives zero
+                float32Val = 0;
+            }
         }
         else
         {
@@ -310,7 +321,15 @@ inline unsigned short float32ToFloat10(float fp32)
             // The number is too small to be represented as a normalized float11
             // Convert it to a denormalized value.
             const unsigned int shift = (float32ExponentBias - float10ExponentBias) - (float32Val >> float32ExponentFirstBit);
-            float32Val = ((1 << float32ExponentFirstBit) | (float32Val & float32MantissaMask)) >> shift;
+            if (shift < 24)
+            {
+                float32Val = ((1 << float32ExponentFirstBit) | (float32Val & float32MantissaMask)) >> shift;
+            }
+            else
+            {
+                // Shifting out the whole 24-bit mantissa gives zero
+                float32Val = 0;
+            }
         }
         else
         {
@@ -357,7 +376,8 @@ inline float float11ToFloat32(unsigned short fp11)
             exponent = -112;
         }
 
-        return bitCast<float>(((exponent + 112) << 23) | (mantissa << 17));
+        // The exponent of a denormal wraps below zero, which the unsigned shift discards
+        return bitCast<float>((static_cast<unsigned int>(exponent + 112) << 23) | (mantissa << 17));
     }
 }
 
@@ -396,10 +416,20 @@ inline float float10ToFloat32(unsigned short fp11)
             exponent = -112;
         }
 
-        return bitCast<float>(((exponent + 112) << 23) | (mantissa << 18));
+        // The exponent of a denormal wraps below zero, which the unsigned shift discards
+        return bitCast<float>((static_cast<unsigned int>(exponent + 112) << 23) | (mantissa << 18));
     }
 }
 
+// Array versions of the conversions above. Each produces the same bits as calling the matching
+// single-value function on every element, using SSE2 where available.
+void float32ToFloat16Array(const float *input, unsigned short *output, size_t count);
+void float16ToFloat32Array(const unsigned short *input, float *output, size_t count);
+
+// Converts pixelCount tightly packed RGB float triples into R11G11B10 or RGB9E5 words.
+void convertRGBFloatsToR11G11B10Array(const float *input, unsigned int *output, size_t pixelCount);
+void convertRGBFloatsTo999E5Array(const float *input, unsigned int *output, size_t pixelCount);
+
 template <typename T>
 inline float normalizedToFloat(T input)
 {
@@ -532,6 +562,17 @@ struct Range
 typedef Range<int> RangeI;
 typedef Range<unsigned int> RangeUI;
 
+// The range of the indices of an indexed draw. Validation leaves it unresolved for client memory
+// indices when it doesn't need the range itself; the backend then finds it while converting them.
+struct DrawIndexRange
+{
+    DrawIndexRange() : range(0, 0), resolved(false) {}
+    explicit DrawIndexRange(const RangeUI &range) : range(range), resolved(true) {}
+
+    RangeUI range;
+    bool resolved;
+};
+
 template <typename T>
 T roundUp(const T value, const T alignment)
 {
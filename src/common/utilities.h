@@ -42,6 +42,11 @@ GLenum LayerIndexToCubeMapTextureTarget(size_t index);
 
 bool IsTriangleMode(GLenum drawMode);
 
+// The first constant registers of D3D9 shaders hold the driver uniforms that the HLSL translator
+// declares, and uniforms of the program are assigned the registers after them.
+static const unsigned int D3D9VertexDriverUniformRegisters = 4;
+static const unsigned int D3D9PixelDriverUniformRegisters = 3;
+
 // [OpenGL ES 3.0.2] Section 2.3.1 page 14
 // Data Conversion For State-Setting Commands
 // Floating-point values are rounded to the nearest integer, instead of truncated, as done by static_cast.
@@ -137,12 +137,12 @@ OutputHLSL::OutputHLSL(TParseContext &context, TranslatorHLSL *parentTranslator)
         if (mContext.shaderType == GL_FRAGMENT_SHADER)
         {
             // Reserve registers for dx_DepthRange, dx_ViewCoords and dx_DepthFront
-            mUniformHLSL->reserveUniformRegisters(3);
+            mUniformHLSL->reserveUniformRegisters(gl::D3D9PixelDriverUniformRegisters);
         }
         else
         {
             // Reserve registers for dx_DepthRange, dx_ViewAdjust, dx_ViewScale and dx_ViewCoords
-            mUniformHLSL->reserveUniformRegisters(4);
+            mUniformHLSL->reserveUniformRegisters(gl::D3D9VertexDriverUniformRegisters);
         }
     }
 
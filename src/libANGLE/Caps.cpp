@@ -124,6 +124,8 @@ Extensions::Extensions()
       framebufferBlit(false),
       framebufferMultisample(false),
       instancedArrays(false),
+      multiDrawArrays(false),
+      multiDraw(false),
       packReverseRowOrder(false),
       standardDerivatives(false),
       shaderTextureLOD(false),
@@ -173,6 +175,8 @@ std::vector<std::string> Extensions::getStrings() const
     InsertExtensionString("GL_ANGLE_framebuffer_blit",         framebufferBlit,          &extensionStrings);
     InsertExtensionString("GL_ANGLE_framebuffer_multisample",  framebufferMultisample,   &extensionStrings);
     InsertExtensionString("GL_ANGLE_instanced_arrays",         instancedArrays,          &extensionStrings);
+    InsertExtensionString("GL_EXT_multi_draw_arrays",          multiDrawArrays,          &extensionStrings);
+    InsertExtensionString("GL_ANGLE_multi_draw",               multiDraw,                &extensionStrings);
     InsertExtensionString("GL_ANGLE_pack_reverse_row_order",   packReverseRowOrder,      &extensionStrings);
     InsertExtensionString("GL_OES_standard_derivatives",       standardDerivatives,      &extensionStrings);
     InsertExtensionString("GL_EXT_shader_texture_lod",         shaderTextureLOD,         &extensionStrings);
@@ -445,7 +449,8 @@ DisplayExtensions::DisplayExtensions()
       querySurfacePointer(false),
       windowFixedSize(false),
       postSubBuffer(false),
-      createContext(false)
+      createContext(false),
+      createContextDrawCoalescing(false)
 {
 }
 
@@ -461,6 +466,7 @@ std::vector<std::string> DisplayExtensions::getStrings() const
     InsertExtensionString("EGL_ANGLE_window_fixed_size",                   windowFixedSize,                &extensionStrings);
     InsertExtensionString("EGL_NV_post_sub_buffer",                        postSubBuffer,                  &extensionStrings);
     InsertExtensionString("EGL_KHR_create_context",                        createContext,                  &extensionStrings);
+    InsertExtensionString("EGL_ANGLE_create_context_draw_coalescing",      createContextDrawCoalescing,    &extensionStrings);
 
     return extensionStrings;
 }
@@ -182,6 +182,12 @@ struct Extensions
     // GL_ANGLE_instanced_arrays
     bool instancedArrays;
 
+    // GL_EXT_multi_draw_arrays
+    bool multiDrawArrays;
+
+    // GL_ANGLE_multi_draw
+    bool multiDraw;
+
     // GL_ANGLE_pack_reverse_row_order
     bool packReverseRowOrder;
 
@@ -318,6 +324,9 @@ struct DisplayExtensions
 
     // EGL_KHR_create_context
     bool createContext;
+
+    // EGL_ANGLE_create_context_draw_coalescing
+    bool createContextDrawCoalescing;
 };
 
 struct ClientExtensions
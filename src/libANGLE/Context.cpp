@@ -37,7 +37,8 @@
 namespace gl
 {
 
-Context::Context(const egl::Config *config, int clientVersion, const Context *shareContext, rx::Renderer *renderer, bool notifyResets, bool robustAccess)
+Context::Context(const egl::Config *config, int clientVersion, const Context *shareContext, rx::Renderer *renderer, bool notifyResets, bool robustAccess,
+                 bool coalesceDraws)
     : mRenderer(renderer)
 {
     ASSERT(robustAccess == false);   // Unimplemented
@@ -124,6 +125,7 @@ Context::Context(const egl::Config *config, int clientVersion, const Context *sh
     mResetStatus = GL_NO_ERROR;
     mResetStrategy = (notifyResets ? GL_LOSE_CONTEXT_ON_RESET_EXT : GL_NO_RESET_NOTIFICATION_EXT);
     mRobustAccess = robustAccess;
+    mCoalesceDraws = coalesceDraws;
 
     mCompiler = new Compiler(mRenderer->createCompiler(getData()));
 }
@@ -203,11 +205,6 @@ void Context::markContextLost()
     mContextLost = true;
 }
 
-bool Context::isContextLost()
-{
-    return mContextLost;
-}
-
 GLuint Context::createBuffer()
 {
     return mResourceManager->createBuffer();
@@ -1197,25 +1194,83 @@ bool Context::getIndexedQueryParameterInfo(GLenum target, GLenum *type, unsigned
     return false;
 }
 
+// Client vertex arrays are read when the draw reaches the renderer, and the application may change
+// their contents before a held back draw does
+static bool UsesClientVertexArrays(const State &state)
+{
+    return (state.getVertexArray()->getEnabledClientArrayMask() &
+            state.getProgram()->getActiveAttribLocationsMask()) != 0;
+}
+
 Error Context::drawArrays(GLenum mode, GLint first, GLsizei count, GLsizei instances)
 {
+    if (mCoalesceDraws && DrawCoalescer::CanCoalesce(mode, instances) && !UsesClientVertexArrays(mState))
+    {
+        CoalescedDraw emitted;
+        if (mDrawCoalescer.add(first, count, &emitted))
+        {
+            return mRenderer->drawArrays(getData(), GL_TRIANGLES, emitted.first, emitted.count, 0);
+        }
+
+        return Error(GL_NO_ERROR);
+    }
+
+    flushDeferredDraws();
+
     return mRenderer->drawArrays(getData(), mode, first, count, instances);
 }
 
 Error Context::drawElements(GLenum mode, GLsizei count, GLenum type,
                             const GLvoid *indices, GLsizei instances,
-                            const rx::RangeUI &indexRange)
+                            const rx::DrawIndexRange &indexRange)
 {
+    flushDeferredDraws();
+
     return mRenderer->drawElements(getData(), mode, count, type, indices, instances, indexRange);
 }
 
+Error Context::multiDrawArrays(GLenum mode, const GLint *firsts, const GLsizei *counts,
+                               const GLsizei *instanceCounts, GLsizei drawCount)
+{
+    flushDeferredDraws();
+
+    return mRenderer->multiDrawArrays(getData(), mode, firsts, counts, instanceCounts, drawCount);
+}
+
+Error Context::multiDrawElements(GLenum mode, const GLsizei *counts, GLenum type,
+                                 const GLvoid *const *indices, const GLsizei *instanceCounts,
+                                 const rx::DrawIndexRange *indexRanges, GLsizei drawCount)
+{
+    flushDeferredDraws();
+
+    return mRenderer->multiDrawElements(getData(), mode, counts, type, indices, instanceCounts, indexRanges,
+                                        drawCount);
+}
+
 Error Context::flush()
 {
+    flushDeferredDraws();
+
     return mRenderer->flush();
 }
 
+void Context::emitDeferredDraw()
+{
+    CoalescedDraw emitted;
+    if (mDrawCoalescer.flush(&emitted))
+    {
+        Error error = mRenderer->drawArrays(getData(), GL_TRIANGLES, emitted.first, emitted.count, 0);
+        if (error.isError())
+        {
+            recordError(error);
+        }
+    }
+}
+
 Error Context::finish()
 {
+    flushDeferredDraws();
+
     return mRenderer->finish();
 }
 
@@ -1231,6 +1286,9 @@ void Context::recordError(const Error &error)
 // [OpenGL ES 2.0.24] section 2.5 page 13.
 GLenum Context::getError()
 {
+    // Errors of held back draws are recorded when they are drawn
+    flushDeferredDraws();
+
     if (mErrors.empty())
     {
         return GL_NO_ERROR;
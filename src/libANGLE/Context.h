@@ -15,6 +15,7 @@
 #include "libANGLE/Caps.h"
 #include "libANGLE/Constants.h"
 #include "libANGLE/Data.h"
+#include "libANGLE/DrawCoalescer.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/HandleAllocator.h"
 #include "libANGLE/VertexAttribute.h"
@@ -58,14 +59,15 @@ class TransformFeedback;
 class Context
 {
   public:
-    Context(const egl::Config *config, int clientVersion, const Context *shareContext, rx::Renderer *renderer, bool notifyResets, bool robustAccess);
+    Context(const egl::Config *config, int clientVersion, const Context *shareContext, rx::Renderer *renderer, bool notifyResets, bool robustAccess,
+            bool coalesceDraws);
 
     virtual ~Context();
 
     void makeCurrent(egl::Surface *surface);
 
     virtual void markContextLost();
-    bool isContextLost();
+    bool isContextLost() { return mContextLost; }
 
     // These create  and destroy methods are merely pass-throughs to 
     // ResourceManager, which owns these object types
@@ -168,10 +170,27 @@ class Context
     Error drawArrays(GLenum mode, GLint first, GLsizei count, GLsizei instances);
     Error drawElements(GLenum mode, GLsizei count, GLenum type,
                        const GLvoid *indices, GLsizei instances,
-                       const rx::RangeUI &indexRange);
+                       const rx::DrawIndexRange &indexRange);
+    Error multiDrawArrays(GLenum mode, const GLint *firsts, const GLsizei *counts,
+                          const GLsizei *instanceCounts, GLsizei drawCount);
+    Error multiDrawElements(GLenum mode, const GLsizei *counts, GLenum type,
+                            const GLvoid *const *indices, const GLsizei *instanceCounts,
+                            const rx::DrawIndexRange *indexRanges, GLsizei drawCount);
     Error flush();
     Error finish();
 
+    // With draw coalescing, glDrawArrays calls may be held back to be merged with the next. Entry
+    // points that change what a held draw renders, or that observe its results, emit it first;
+    // draws, flush, finish and getError do so themselves.
+    void flushDeferredDraws()
+    {
+        if (mCoalesceDraws && mDrawCoalescer.hasPendingDraw())
+        {
+            emitDeferredDraw();
+        }
+    }
+    const DrawCoalescerStats &getDrawCoalescerStats() const { return mDrawCoalescer.getStats(); }
+
     void recordError(const Error &error);
 
     GLenum getError();
@@ -215,6 +234,8 @@ class Context
     void initRendererString();
     void initExtensionStrings();
 
+    void emitDeferredDraw();
+
     void initCaps(GLuint clientVersion);
 
     // Caps to use for validation
@@ -272,6 +293,9 @@ class Context
     GLenum mResetStrategy;
     bool mRobustAccess;
 
+    bool mCoalesceDraws;
+    DrawCoalescer mDrawCoalescer;
+
     ResourceManager *mResourceManager;
 };
 }
@@ -0,0 +1,84 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// DrawCoalescer.cpp: Implements the gl::DrawCoalescer class.
+
+#include "libANGLE/DrawCoalescer.h"
+
+#include "common/debug.h"
+
+#include <limits>
+
+namespace gl
+{
+
+CoalescedDraw::CoalescedDraw()
+    : first(0),
+      count(0)
+{
+}
+
+CoalescedDraw::CoalescedDraw(GLint first, GLsizei count)
+    : first(first),
+      count(count)
+{
+}
+
+DrawCoalescerStats::DrawCoalescerStats()
+    : mergedDraws(0),
+      emittedDraws(0)
+{
+}
+
+DrawCoalescer::DrawCoalescer()
+    : mHasPendingDraw(false)
+{
+}
+
+// static
+bool DrawCoalescer::CanCoalesce(GLenum mode, GLsizei instances)
+{
+    return (mode == GL_TRIANGLES && instances == 0);
+}
+
+bool DrawCoalescer::add(GLint first, GLsizei count, CoalescedDraw *outEmitted)
+{
+    ASSERT(first >= 0 && count >= 0);
+
+    if (mHasPendingDraw)
+    {
+        // A range ending in a partial triangle would complete it with the vertices that follow
+        GLint64 pendingEnd = static_cast<GLint64>(mPendingDraw.first) + mPendingDraw.count;
+        if (mPendingDraw.count % 3 == 0 && pendingEnd == first &&
+            count <= std::numeric_limits<GLsizei>::max() - mPendingDraw.count)
+        {
+            mPendingDraw.count += count;
+            mStats.mergedDraws++;
+            return false;
+        }
+    }
+
+    bool emitted = flush(outEmitted);
+
+    mHasPendingDraw = true;
+    mPendingDraw = CoalescedDraw(first, count);
+    return emitted;
+}
+
+bool DrawCoalescer::flush(CoalescedDraw *outEmitted)
+{
+    if (!mHasPendingDraw)
+    {
+        return false;
+    }
+
+    *outEmitted = mPendingDraw;
+    mHasPendingDraw = false;
+    mStats.emittedDraws++;
+    return true;
+}
+
+}
@@ -0,0 +1,72 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// DrawCoalescer.h: Defines the gl::DrawCoalescer class, which merges runs of glDrawArrays calls
+// that draw adjacent ranges of triangles into one draw.
+
+#ifndef LIBANGLE_DRAWCOALESCER_H_
+#define LIBANGLE_DRAWCOALESCER_H_
+
+#include "common/angleutils.h"
+
+#include "angle_gl.h"
+
+namespace gl
+{
+
+struct CoalescedDraw
+{
+    CoalescedDraw();
+    CoalescedDraw(GLint first, GLsizei count);
+
+    GLint first;
+    GLsizei count;
+};
+
+struct DrawCoalescerStats
+{
+    DrawCoalescerStats();
+
+    // Draws merged into the draw before them, and the draws that were emitted in their place
+    unsigned int mergedDraws;
+    unsigned int emittedDraws;
+};
+
+// Holds back the last GL_TRIANGLES draw, so that a draw continuing its range can be merged into
+// it. The caller emits the held draw before anything that could change what it draws; draws that
+// follow each other with nothing in between always share their state.
+class DrawCoalescer
+{
+  public:
+    DrawCoalescer();
+
+    // Only non-instanced triangle lists draw the same triangles whether their vertices are drawn
+    // in one range or in several, as long as they are split at multiples of three.
+    static bool CanCoalesce(GLenum mode, GLsizei instances);
+
+    // Adds a draw, merging it into the held draw when it starts where that one ends. Otherwise it
+    // is held instead, and the previously held draw is returned in *outEmitted to be drawn first.
+    // Returns whether a draw was returned.
+    bool add(GLint first, GLsizei count, CoalescedDraw *outEmitted);
+
+    // Returns the held draw in *outEmitted, if there is one, and holds no draw.
+    bool flush(CoalescedDraw *outEmitted);
+
+    bool hasPendingDraw() const { return mHasPendingDraw; }
+    const DrawCoalescerStats &getStats() const { return mStats; }
+
+  private:
+    DISALLOW_COPY_AND_ASSIGN(DrawCoalescer);
+
+    bool mHasPendingDraw;
+    CoalescedDraw mPendingDraw;
+
+    DrawCoalescerStats mStats;
+};
+
+}
+
+#endif // LIBANGLE_DRAWCOALESCER_H_
@@ -189,6 +189,7 @@ LinkedVarying::LinkedVarying(const std::string &name, GLenum type, GLsizei size,
 
 Program::Program(rx::ProgramImpl *impl, ResourceManager *manager, GLuint handle)
     : mProgram(impl),
+      mActiveAttribLocationsMask(0),
       mValidated(false),
       mTransformFeedbackVaryings(),
       mTransformFeedbackBufferMode(GL_NONE),
@@ -398,6 +399,7 @@ void Program::unlink(bool destroy)
     }
 
     std::fill(mLinkedAttribute, mLinkedAttribute + ArraySize(mLinkedAttribute), sh::Attribute());
+    mActiveAttribLocationsMask = 0;
     mOutputVariables.clear();
 
     mProgram->reset();
@@ -455,6 +457,8 @@ Error Program::loadBinary(GLenum binaryFormat, const void *binary, GLsizei lengt
         stream.readInt(&mProgram->getSemanticIndexes()[i]);
     }
 
+    updateActiveAttribLocationsMask();
+
     rx::LinkResult result = mProgram->load(mInfoLog, &stream);
     if (result.error.isError() || !result.linkSuccess)
     {
@@ -621,6 +625,11 @@ int Program::getSemanticIndex(int attributeIndex)
     return mProgram->getSemanticIndexes()[attributeIndex];
 }
 
+unsigned int Program::getActiveAttribLocationsMask() const
+{
+    return mActiveAttribLocationsMask;
+}
+
 void Program::getActiveAttribute(GLuint index, GLsizei bufsize, GLsizei *length, GLint *size, GLenum *type, GLchar *name)
 {
     if (mLinked)
@@ -1381,9 +1390,23 @@ bool Program::linkAttributes(InfoLog &infoLog, const AttributeBindings &attribut
         }
     }
 
+    updateActiveAttribLocationsMask();
+
     return true;
 }
 
+void Program::updateActiveAttribLocationsMask()
+{
+    mActiveAttribLocationsMask = 0;
+    for (int attributeIndex = 0; attributeIndex < MAX_VERTEX_ATTRIBS; attributeIndex++)
+    {
+        if (mProgram->getSemanticIndexes()[attributeIndex] != -1)
+        {
+            mActiveAttribLocationsMask |= (1u << attributeIndex);
+        }
+    }
+}
+
 bool Program::linkUniformBlocks(InfoLog &infoLog, const Shader &vertexShader, const Shader &fragmentShader, const Caps &caps)
 {
     const std::vector<sh::InterfaceBlock> &vertexInterfaceBlocks = vertexShader.getInterfaceBlocks();
@@ -136,6 +136,7 @@ class Program
 
     GLuint getAttributeLocation(const std::string &name);
     int getSemanticIndex(int attributeIndex);
+    unsigned int getActiveAttribLocationsMask() const;
 
     void getActiveAttribute(GLuint index, GLsizei bufsize, GLsizei *length, GLint *size, GLenum *type, GLchar *name);
     GLint getActiveAttributeCount();
@@ -225,6 +226,7 @@ class Program
     void resetUniformBlockBindings();
 
     bool linkAttributes(InfoLog &infoLog, const AttributeBindings &attributeBindings, const Shader *vertexShader);
+    void updateActiveAttribLocationsMask();
     bool linkUniformBlocks(InfoLog &infoLog, const Shader &vertexShader, const Shader &fragmentShader, const Caps &caps);
     bool areMatchingInterfaceBlocks(gl::InfoLog &infoLog, const sh::InterfaceBlock &vertexInterfaceBlock,
                                     const sh::InterfaceBlock &fragmentInterfaceBlock);
@@ -248,6 +250,10 @@ class Program
 
     sh::Attribute mLinkedAttribute[MAX_VERTEX_ATTRIBS];
 
+    // Bit i is set when attribute location i has a semantic index, so that draws needn't look
+    // each location up
+    unsigned int mActiveAttribLocationsMask;
+
     std::map<int, VariableLocation> mOutputVariables;
 
     bool mValidated;
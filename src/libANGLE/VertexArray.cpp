@@ -16,9 +16,11 @@ namespace gl
 VertexArray::VertexArray(rx::VertexArrayImpl *impl, GLuint id, size_t maxAttribs)
     : mId(id),
       mVertexArray(impl),
-      mVertexAttributes(maxAttribs)
+      mVertexAttributes(maxAttribs),
+      mEnabledClientArrayMask(0)
 {
     ASSERT(impl != NULL);
+    ASSERT(maxAttribs <= sizeof(mEnabledClientArrayMask) * 8);
 }
 
 VertexArray::~VertexArray()
@@ -44,6 +46,7 @@ void VertexArray::detachBuffer(GLuint bufferName)
         if (mVertexAttributes[attribute].buffer.id() == bufferName)
         {
             mVertexAttributes[attribute].buffer.set(NULL);
+            updateEnabledClientArrayMask(attribute);
         }
     }
 
@@ -71,6 +74,7 @@ void VertexArray::enableAttribute(unsigned int attributeIndex, bool enabledState
     ASSERT(attributeIndex < getMaxAttribs());
     mVertexAttributes[attributeIndex].enabled = enabledState;
     mVertexArray->enableAttribute(attributeIndex, enabledState);
+    updateEnabledClientArrayMask(attributeIndex);
 }
 
 void VertexArray::setAttributeState(unsigned int attributeIndex, gl::Buffer *boundBuffer, GLint size, GLenum type,
@@ -85,6 +89,22 @@ void VertexArray::setAttributeState(unsigned int attributeIndex, gl::Buffer *bou
     mVertexAttributes[attributeIndex].stride = stride;
     mVertexAttributes[attributeIndex].pointer = pointer;
     mVertexArray->setAttribute(attributeIndex, mVertexAttributes[attributeIndex]);
+    updateEnabledClientArrayMask(attributeIndex);
+}
+
+void VertexArray::updateEnabledClientArrayMask(size_t attributeIndex)
+{
+    const VertexAttribute &attrib = mVertexAttributes[attributeIndex];
+    unsigned int attributeBit = (1u << attributeIndex);
+
+    if (attrib.enabled && attrib.buffer.get() == NULL)
+    {
+        mEnabledClientArrayMask |= attributeBit;
+    }
+    else
+    {
+        mEnabledClientArrayMask &= ~attributeBit;
+    }
 }
 
 void VertexArray::setElementArrayBuffer(Buffer *buffer)
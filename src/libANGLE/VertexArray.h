@@ -49,12 +49,19 @@ class VertexArray
     GLuint getElementArrayBufferId() const { return mElementArrayBuffer.id(); }
     size_t getMaxAttribs() const { return mVertexAttributes.size(); }
 
+    // Bit i is set when attribute i is enabled and reads from client memory
+    unsigned int getEnabledClientArrayMask() const { return mEnabledClientArrayMask; }
+
   private:
+    void updateEnabledClientArrayMask(size_t attributeIndex);
+
     GLuint mId;
 
     rx::VertexArrayImpl *mVertexArray;
     std::vector<VertexAttribute> mVertexAttributes;
     BindingPointer<Buffer> mElementArrayBuffer;
+
+    unsigned int mEnabledClientArrayMask;
 };
 
 }
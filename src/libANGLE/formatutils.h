@@ -1,5 +1,5 @@
 //
-// Copyright (c) 2013 The ANGLE Project Authors. All rights reserved.
+// Copyright (c) 2013-2015 The ANGLE Project Authors. All rights reserved.
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 //
@@ -20,10 +20,10 @@
 namespace gl
 {
 
+// Type and InternalFormat are aggregates so that the tables in formatutils_autogen.inl are
+// initialized at compile time.
 struct Type
 {
-    Type();
-
     GLuint bytes;
     bool specialInterpretation;
 };
@@ -31,8 +31,6 @@ const Type &GetTypeInfo(GLenum type);
 
 struct InternalFormat
 {
-    InternalFormat();
-
     GLuint redBits;
     GLuint greenBits;
     GLuint blueBits;
@@ -70,6 +68,11 @@ struct InternalFormat
 };
 const InternalFormat &GetInternalFormatInfo(GLenum internalFormat);
 
+// Dense index of internalFormat, for renderer tables that hold per-format data. Unknown formats
+// share index 0 with GL_NONE.
+size_t GetInternalFormatIndex(GLenum internalFormat);
+size_t GetInternalFormatCount();
+
 GLenum GetSizedInternalFormat(GLenum internalFormat, GLenum type);
 
 typedef std::set<GLenum> FormatSet;
@@ -0,0 +1,590 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// formatutils_autogen.inl: Tables of GL types and internal formats.
+// This file is automatically generated by gen_formatutils_tables.py from
+// formatutils_data.json. Do not edit it by hand.
+
+namespace gl
+{
+
+namespace
+{
+
+// Entry 0 is returned for unknown types.
+const Type TypeTable[] =
+{
+    // Bytes, special interpretation
+    { 0, false }, // Unknown types
+    { 1, false }, // GL_UNSIGNED_BYTE
+    { 1, false }, // GL_BYTE
+    { 2, false }, // GL_UNSIGNED_SHORT
+    { 2, false }, // GL_SHORT
+    { 4, false }, // GL_UNSIGNED_INT
+    { 4, false }, // GL_INT
+    { 2, false }, // GL_HALF_FLOAT
+    { 2, false }, // GL_HALF_FLOAT_OES
+    { 4, false }, // GL_FLOAT
+    { 2, true }, // GL_UNSIGNED_SHORT_5_6_5
+    { 2, true }, // GL_UNSIGNED_SHORT_4_4_4_4
+    { 2, true }, // GL_UNSIGNED_SHORT_5_5_5_1
+    { 2, true }, // GL_UNSIGNED_SHORT_4_4_4_4_REV_EXT
+    { 2, true }, // GL_UNSIGNED_SHORT_1_5_5_5_REV_EXT
+    { 4, true }, // GL_UNSIGNED_INT_2_10_10_10_REV
+    { 4, true }, // GL_UNSIGNED_INT_24_8
+    { 4, true }, // GL_UNSIGNED_INT_10F_11F_11F_REV
+    { 4, true }, // GL_UNSIGNED_INT_5_9_9_9_REV
+    { 8, true }, // GL_FLOAT_32_UNSIGNED_INT_24_8_REV
+};
+
+size_t GetTypeTableIndex(GLenum type)
+{
+    switch (type)
+    {
+      case GL_UNSIGNED_BYTE: return 1;
+      case GL_BYTE: return 2;
+      case GL_UNSIGNED_SHORT: return 3;
+      case GL_SHORT: return 4;
+      case GL_UNSIGNED_INT: return 5;
+      case GL_INT: return 6;
+      case GL_HALF_FLOAT: return 7;
+      case GL_HALF_FLOAT_OES: return 8;
+      case GL_FLOAT: return 9;
+      case GL_UNSIGNED_SHORT_5_6_5: return 10;
+      case GL_UNSIGNED_SHORT_4_4_4_4: return 11;
+      case GL_UNSIGNED_SHORT_5_5_5_1: return 12;
+      case GL_UNSIGNED_SHORT_4_4_4_4_REV_EXT: return 13;
+      case GL_UNSIGNED_SHORT_1_5_5_5_REV_EXT: return 14;
+      case GL_UNSIGNED_INT_2_10_10_10_REV: return 15;
+      case GL_UNSIGNED_INT_24_8: return 16;
+      case GL_UNSIGNED_INT_10F_11F_11F_REV: return 17;
+      case GL_UNSIGNED_INT_5_9_9_9_REV: return 18;
+      case GL_FLOAT_32_UNSIGNED_INT_24_8_REV: return 19;
+      default: return 0;
+    }
+}
+
+// Entry 0 is GL_NONE, which is also returned for unknown internal formats.
+const InternalFormat InternalFormatTable[] =
+{
+    // Red, green, blue, luminance, alpha, shared, depth and stencil bits, pixel bytes, component count,
+    // compressed, block width and height, format, type, component type, color encoding, and the
+    // texture, render and filter support checks.
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, false, 0, 0, GL_NONE, GL_NONE, GL_NONE, GL_NONE, NeverSupported, NeverSupported, NeverSupported }, // GL_NONE
+    { 8, 0, 0, 0, 0, 0, 0, 0, 1, 1, false, 0, 0, GL_RED, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireESOrExt<3, &Extensions::textureRG>, RequireESOrExt<3, &Extensions::textureRG>, AlwaysSupported }, // GL_R8
+    { 8, 0, 0, 0, 0, 0, 0, 0, 1, 1, false, 0, 0, GL_RED, GL_BYTE, GL_SIGNED_NORMALIZED, GL_LINEAR, RequireES<3>, NeverSupported, AlwaysSupported }, // GL_R8_SNORM
+    { 8, 8, 0, 0, 0, 0, 0, 0, 2, 2, false, 0, 0, GL_RG, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireESOrExt<3, &Extensions::textureRG>, RequireESOrExt<3, &Extensions::textureRG>, AlwaysSupported }, // GL_RG8
+    { 8, 8, 0, 0, 0, 0, 0, 0, 2, 2, false, 0, 0, GL_RG, GL_BYTE, GL_SIGNED_NORMALIZED, GL_LINEAR, RequireES<3>, NeverSupported, AlwaysSupported }, // GL_RG8_SNORM
+    { 8, 8, 8, 0, 0, 0, 0, 0, 3, 3, false, 0, 0, GL_RGB, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireESOrExt<3, &Extensions::rgb8rgba8>, RequireESOrExt<3, &Extensions::rgb8rgba8>, AlwaysSupported }, // GL_RGB8
+    { 8, 8, 8, 0, 0, 0, 0, 0, 3, 3, false, 0, 0, GL_RGB, GL_BYTE, GL_SIGNED_NORMALIZED, GL_LINEAR, RequireES<3>, NeverSupported, AlwaysSupported }, // GL_RGB8_SNORM
+    { 5, 6, 5, 0, 0, 0, 0, 0, 2, 3, false, 0, 0, GL_RGB, GL_UNSIGNED_SHORT_5_6_5, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<2>, RequireES<2>, AlwaysSupported }, // GL_RGB565
+    { 4, 4, 4, 0, 4, 0, 0, 0, 2, 4, false, 0, 0, GL_RGBA, GL_UNSIGNED_SHORT_4_4_4_4, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<2>, RequireES<2>, AlwaysSupported }, // GL_RGBA4
+    { 5, 5, 5, 0, 1, 0, 0, 0, 2, 4, false, 0, 0, GL_RGBA, GL_UNSIGNED_SHORT_5_5_5_1, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<2>, RequireES<2>, AlwaysSupported }, // GL_RGB5_A1
+    { 8, 8, 8, 0, 8, 0, 0, 0, 4, 4, false, 0, 0, GL_RGBA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireESOrExt<3, &Extensions::rgb8rgba8>, RequireESOrExt<3, &Extensions::rgb8rgba8>, AlwaysSupported }, // GL_RGBA8
+    { 8, 8, 8, 0, 8, 0, 0, 0, 4, 4, false, 0, 0, GL_RGBA, GL_BYTE, GL_SIGNED_NORMALIZED, GL_LINEAR, RequireES<3>, NeverSupported, AlwaysSupported }, // GL_RGBA8_SNORM
+    { 10, 10, 10, 0, 2, 0, 0, 0, 4, 4, false, 0, 0, GL_RGBA, GL_UNSIGNED_INT_2_10_10_10_REV, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<3>, RequireES<3>, AlwaysSupported }, // GL_RGB10_A2
+    { 10, 10, 10, 0, 2, 0, 0, 0, 4, 4, false, 0, 0, GL_RGBA_INTEGER, GL_UNSIGNED_INT_2_10_10_10_REV, GL_UNSIGNED_INT, GL_LINEAR, RequireES<3>, NeverSupported, NeverSupported }, // GL_RGB10_A2UI
+    { 8, 8, 8, 0, 0, 0, 0, 0, 3, 3, false, 0, 0, GL_RGB, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_SRGB, RequireESOrExt<3, &Extensions::sRGB>, NeverSupported, AlwaysSupported }, // GL_SRGB8
+    { 8, 8, 8, 0, 8, 0, 0, 0, 4, 4, false, 0, 0, GL_RGBA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_SRGB, RequireESOrExt<3, &Extensions::sRGB>, RequireESOrExt<3, &Extensions::sRGB>, AlwaysSupported }, // GL_SRGB8_ALPHA8
+    { 11, 11, 10, 0, 0, 0, 0, 0, 4, 3, false, 0, 0, GL_RGB, GL_UNSIGNED_INT_10F_11F_11F_REV, GL_FLOAT, GL_LINEAR, RequireES<3>, RequireExt<&Extensions::colorBufferFloat>, AlwaysSupported }, // GL_R11F_G11F_B10F
+    { 9, 9, 9, 0, 0, 5, 0, 0, 4, 3, false, 0, 0, GL_RGB, GL_UNSIGNED_INT_5_9_9_9_REV, GL_FLOAT, GL_LINEAR, RequireES<3>, NeverSupported, AlwaysSupported }, // GL_RGB9_E5
+    { 8, 0, 0, 0, 0, 0, 0, 0, 1, 1, false, 0, 0, GL_RED_INTEGER, GL_BYTE, GL_INT, GL_LINEAR, RequireES<3>, RequireES<3>, NeverSupported }, // GL_R8I
+    { 8, 0, 0, 0, 0, 0, 0, 0, 1, 1, false, 0, 0, GL_RED_INTEGER, GL_UNSIGNED_BYTE, GL_UNSIGNED_INT, GL_LINEAR, RequireES<3>, RequireES<3>, NeverSupported }, // GL_R8UI
+    { 16, 0, 0, 0, 0, 0, 0, 0, 2, 1, false, 0, 0, GL_RED_INTEGER, GL_SHORT, GL_INT, GL_LINEAR, RequireES<3>, RequireES<3>, NeverSupported }, // GL_R16I
+    { 16, 0, 0, 0, 0, 0, 0, 0, 2, 1, false, 0, 0, GL_RED_INTEGER, GL_UNSIGNED_SHORT, GL_UNSIGNED_INT, GL_LINEAR, RequireES<3>, RequireES<3>, NeverSupported }, // GL_R16UI
+    { 32, 0, 0, 0, 0, 0, 0, 0, 4, 1, false, 0, 0, GL_RED_INTEGER, GL_INT, GL_INT, GL_LINEAR, RequireES<3>, RequireES<3>, NeverSupported }, // GL_R32I
+    { 32, 0, 0, 0, 0, 0, 0, 0, 4, 1, false, 0, 0, GL_RED_INTEGER, GL_UNSIGNED_INT, GL_UNSIGNED_INT, GL_LINEAR, RequireES<3>, RequireES<3>, NeverSupported }, // GL_R32UI
+    { 8, 8, 0, 0, 0, 0, 0, 0, 2, 2, false, 0, 0, GL_RG_INTEGER, GL_BYTE, GL_INT, GL_LINEAR, RequireES<3>, RequireES<3>, NeverSupported }, // GL_RG8I
+    { 8, 8, 0, 0, 0, 0, 0, 0, 2, 2, false, 0, 0, GL_RG_INTEGER, GL_UNSIGNED_BYTE, GL_UNSIGNED_INT, GL_LINEAR, RequireES<3>, RequireES<3>, NeverSupported }, // GL_RG8UI
+    { 16, 16, 0, 0, 0, 0, 0, 0, 4, 2, false, 0, 0, GL_RG_INTEGER, GL_SHORT, GL_INT, GL_LINEAR, RequireES<3>, RequireES<3>, NeverSupported }, // GL_RG16I
+    { 16, 16, 0, 0, 0, 0, 0, 0, 4, 2, false, 0, 0, GL_RG_INTEGER, GL_UNSIGNED_SHORT, GL_UNSIGNED_INT, GL_LINEAR, RequireES<3>, RequireES<3>, NeverSupported }, // GL_RG16UI
+    { 32, 32, 0, 0, 0, 0, 0, 0, 8, 2, false, 0, 0, GL_RG_INTEGER, GL_INT, GL_INT, GL_LINEAR, RequireES<3>, RequireES<3>, NeverSupported }, // GL_RG32I
+    { 32, 32, 0, 0, 0, 0, 0, 0, 8, 2, false, 0, 0, GL_RG_INTEGER, GL_UNSIGNED_INT, GL_UNSIGNED_INT, GL_LINEAR, RequireES<3>, RequireES<3>, NeverSupported }, // GL_RG32UI
+    { 8, 8, 8, 0, 0, 0, 0, 0, 3, 3, false, 0, 0, GL_RGB_INTEGER, GL_BYTE, GL_INT, GL_LINEAR, RequireES<3>, NeverSupported, NeverSupported }, // GL_RGB8I
+    { 8, 8, 8, 0, 0, 0, 0, 0, 3, 3, false, 0, 0, GL_RGB_INTEGER, GL_UNSIGNED_BYTE, GL_UNSIGNED_INT, GL_LINEAR, RequireES<3>, NeverSupported, NeverSupported }, // GL_RGB8UI
+    { 16, 16, 16, 0, 0, 0, 0, 0, 6, 3, false, 0, 0, GL_RGB_INTEGER, GL_SHORT, GL_INT, GL_LINEAR, RequireES<3>, NeverSupported, NeverSupported }, // GL_RGB16I
+    { 16, 16, 16, 0, 0, 0, 0, 0, 6, 3, false, 0, 0, GL_RGB_INTEGER, GL_UNSIGNED_SHORT, GL_UNSIGNED_INT, GL_LINEAR, RequireES<3>, NeverSupported, NeverSupported }, // GL_RGB16UI
+    { 32, 32, 32, 0, 0, 0, 0, 0, 12, 3, false, 0, 0, GL_RGB_INTEGER, GL_INT, GL_INT, GL_LINEAR, RequireES<3>, NeverSupported, NeverSupported }, // GL_RGB32I
+    { 32, 32, 32, 0, 0, 0, 0, 0, 12, 3, false, 0, 0, GL_RGB_INTEGER, GL_UNSIGNED_INT, GL_UNSIGNED_INT, GL_LINEAR, RequireES<3>, NeverSupported, NeverSupported }, // GL_RGB32UI
+    { 8, 8, 8, 0, 8, 0, 0, 0, 4, 4, false, 0, 0, GL_RGBA_INTEGER, GL_BYTE, GL_INT, GL_LINEAR, RequireES<3>, RequireES<3>, NeverSupported }, // GL_RGBA8I
+    { 8, 8, 8, 0, 8, 0, 0, 0, 4, 4, false, 0, 0, GL_RGBA_INTEGER, GL_UNSIGNED_BYTE, GL_UNSIGNED_INT, GL_LINEAR, RequireES<3>, RequireES<3>, NeverSupported }, // GL_RGBA8UI
+    { 16, 16, 16, 0, 16, 0, 0, 0, 8, 4, false, 0, 0, GL_RGBA_INTEGER, GL_SHORT, GL_INT, GL_LINEAR, RequireES<3>, RequireES<3>, NeverSupported }, // GL_RGBA16I
+    { 16, 16, 16, 0, 16, 0, 0, 0, 8, 4, false, 0, 0, GL_RGBA_INTEGER, GL_UNSIGNED_SHORT, GL_UNSIGNED_INT, GL_LINEAR, RequireES<3>, RequireES<3>, NeverSupported }, // GL_RGBA16UI
+    { 32, 32, 32, 0, 32, 0, 0, 0, 16, 4, false, 0, 0, GL_RGBA_INTEGER, GL_INT, GL_INT, GL_LINEAR, RequireES<3>, RequireES<3>, NeverSupported }, // GL_RGBA32I
+    { 32, 32, 32, 0, 32, 0, 0, 0, 16, 4, false, 0, 0, GL_RGBA_INTEGER, GL_UNSIGNED_INT, GL_UNSIGNED_INT, GL_LINEAR, RequireES<3>, RequireES<3>, NeverSupported }, // GL_RGBA32UI
+    { 8, 8, 8, 0, 8, 0, 0, 0, 4, 4, false, 0, 0, GL_BGRA_EXT, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::textureFormatBGRA8888>, RequireExt<&Extensions::textureFormatBGRA8888>, AlwaysSupported }, // GL_BGRA8_EXT
+    { 4, 4, 4, 0, 4, 0, 0, 0, 2, 4, false, 0, 0, GL_BGRA_EXT, GL_UNSIGNED_SHORT_4_4_4_4_REV_EXT, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::textureFormatBGRA8888>, RequireExt<&Extensions::textureFormatBGRA8888>, AlwaysSupported }, // GL_BGRA4_ANGLEX
+    { 5, 5, 5, 0, 1, 0, 0, 0, 2, 4, false, 0, 0, GL_BGRA_EXT, GL_UNSIGNED_SHORT_1_5_5_5_REV_EXT, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::textureFormatBGRA8888>, RequireExt<&Extensions::textureFormatBGRA8888>, AlwaysSupported }, // GL_BGR5_A1_ANGLEX
+    { 16, 0, 0, 0, 0, 0, 0, 0, 2, 1, false, 0, 0, GL_RED, GL_HALF_FLOAT, GL_FLOAT, GL_LINEAR, RequireESOrExtAndExt<3, &Extensions::textureHalfFloat, &Extensions::textureRG>, RequireESOrExtAndExt<3, &Extensions::textureHalfFloat, &Extensions::textureRG>, RequireExt<&Extensions::textureHalfFloatLinear> }, // GL_R16F
+    { 16, 16, 0, 0, 0, 0, 0, 0, 4, 2, false, 0, 0, GL_RG, GL_HALF_FLOAT, GL_FLOAT, GL_LINEAR, RequireESOrExtAndExt<3, &Extensions::textureHalfFloat, &Extensions::textureRG>, RequireESOrExtAndExt<3, &Extensions::textureHalfFloat, &Extensions::textureRG>, RequireExt<&Extensions::textureHalfFloatLinear> }, // GL_RG16F
+    { 16, 16, 16, 0, 0, 0, 0, 0, 6, 3, false, 0, 0, GL_RGB, GL_HALF_FLOAT, GL_FLOAT, GL_LINEAR, RequireESOrExt<3, &Extensions::textureHalfFloat>, RequireESOrExt<3, &Extensions::textureHalfFloat>, RequireExt<&Extensions::textureHalfFloatLinear> }, // GL_RGB16F
+    { 16, 16, 16, 0, 16, 0, 0, 0, 8, 4, false, 0, 0, GL_RGBA, GL_HALF_FLOAT, GL_FLOAT, GL_LINEAR, RequireESOrExt<3, &Extensions::textureHalfFloat>, RequireESOrExt<3, &Extensions::textureHalfFloat>, RequireExt<&Extensions::textureHalfFloatLinear> }, // GL_RGBA16F
+    { 32, 0, 0, 0, 0, 0, 0, 0, 4, 1, false, 0, 0, GL_RED, GL_FLOAT, GL_FLOAT, GL_LINEAR, RequireESOrExtAndExt<3, &Extensions::textureFloat, &Extensions::textureRG>, RequireESOrExtAndExt<3, &Extensions::textureFloat, &Extensions::textureRG>, RequireExt<&Extensions::textureFloatLinear> }, // GL_R32F
+    { 32, 32, 0, 0, 0, 0, 0, 0, 8, 2, false, 0, 0, GL_RG, GL_FLOAT, GL_FLOAT, GL_LINEAR, RequireESOrExtAndExt<3, &Extensions::textureFloat, &Extensions::textureRG>, RequireESOrExtAndExt<3, &Extensions::textureFloat, &Extensions::textureRG>, RequireExt<&Extensions::textureFloatLinear> }, // GL_RG32F
+    { 32, 32, 32, 0, 0, 0, 0, 0, 12, 3, false, 0, 0, GL_RGB, GL_FLOAT, GL_FLOAT, GL_LINEAR, RequireESOrExt<3, &Extensions::textureFloat>, RequireESOrExt<3, &Extensions::textureFloat>, RequireExt<&Extensions::textureFloatLinear> }, // GL_RGB32F
+    { 32, 32, 32, 0, 32, 0, 0, 0, 16, 4, false, 0, 0, GL_RGBA, GL_FLOAT, GL_FLOAT, GL_LINEAR, RequireESOrExt<3, &Extensions::textureFloat>, RequireESOrExt<3, &Extensions::textureFloat>, RequireExt<&Extensions::textureFloatLinear> }, // GL_RGBA32F
+    { 0, 0, 0, 0, 0, 0, 16, 0, 2, 1, false, 0, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_SHORT, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<2>, RequireES<2>, RequireESOrExt<3, &Extensions::depthTextures> }, // GL_DEPTH_COMPONENT16
+    { 0, 0, 0, 0, 0, 0, 24, 0, 3, 1, false, 0, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<3>, RequireES<3>, RequireESOrExt<3, &Extensions::depthTextures> }, // GL_DEPTH_COMPONENT24
+    { 0, 0, 0, 0, 0, 0, 32, 0, 4, 1, false, 0, 0, GL_DEPTH_COMPONENT, GL_FLOAT, GL_FLOAT, GL_LINEAR, RequireES<3>, RequireES<3>, RequireESOrExt<3, &Extensions::depthTextures> }, // GL_DEPTH_COMPONENT32F
+    { 0, 0, 0, 0, 0, 0, 32, 0, 4, 1, false, 0, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::depthTextures>, RequireExt<&Extensions::depthTextures>, AlwaysSupported }, // GL_DEPTH_COMPONENT32_OES
+    { 0, 0, 0, 0, 0, 0, 24, 8, 4, 2, false, 0, 0, GL_DEPTH_STENCIL, GL_UNSIGNED_INT_24_8, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireESOrExt<3, &Extensions::depthTextures>, RequireESOrExtOrExt<3, &Extensions::depthTextures, &Extensions::packedDepthStencil>, AlwaysSupported }, // GL_DEPTH24_STENCIL8
+    { 0, 0, 0, 0, 0, 0, 32, 8, 8, 2, false, 0, 0, GL_DEPTH_STENCIL, GL_FLOAT_32_UNSIGNED_INT_24_8_REV, GL_FLOAT, GL_LINEAR, RequireES<3>, RequireES<3>, AlwaysSupported }, // GL_DEPTH32F_STENCIL8
+    { 0, 0, 0, 0, 8, 0, 0, 0, 1, 1, false, 0, 0, GL_ALPHA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::textureStorage>, NeverSupported, AlwaysSupported }, // GL_ALPHA8_EXT
+    { 0, 0, 0, 8, 0, 0, 0, 0, 1, 1, false, 0, 0, GL_LUMINANCE, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::textureStorage>, NeverSupported, AlwaysSupported }, // GL_LUMINANCE8_EXT
+    { 0, 0, 0, 0, 32, 0, 0, 0, 4, 1, false, 0, 0, GL_ALPHA, GL_FLOAT, GL_FLOAT, GL_LINEAR, RequireExtAndExt<&Extensions::textureStorage, &Extensions::textureFloat>, NeverSupported, AlwaysSupported }, // GL_ALPHA32F_EXT
+    { 0, 0, 0, 32, 0, 0, 0, 0, 4, 1, false, 0, 0, GL_LUMINANCE, GL_FLOAT, GL_FLOAT, GL_LINEAR, RequireExtAndExt<&Extensions::textureStorage, &Extensions::textureFloat>, NeverSupported, AlwaysSupported }, // GL_LUMINANCE32F_EXT
+    { 0, 0, 0, 0, 16, 0, 0, 0, 2, 1, false, 0, 0, GL_ALPHA, GL_HALF_FLOAT, GL_FLOAT, GL_LINEAR, RequireExtAndExt<&Extensions::textureStorage, &Extensions::textureHalfFloat>, NeverSupported, AlwaysSupported }, // GL_ALPHA16F_EXT
+    { 0, 0, 0, 16, 0, 0, 0, 0, 2, 1, false, 0, 0, GL_LUMINANCE, GL_HALF_FLOAT, GL_FLOAT, GL_LINEAR, RequireExtAndExt<&Extensions::textureStorage, &Extensions::textureHalfFloat>, NeverSupported, AlwaysSupported }, // GL_LUMINANCE16F_EXT
+    { 0, 0, 0, 8, 8, 0, 0, 0, 2, 2, false, 0, 0, GL_LUMINANCE_ALPHA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::textureStorage>, NeverSupported, AlwaysSupported }, // GL_LUMINANCE8_ALPHA8_EXT
+    { 0, 0, 0, 32, 32, 0, 0, 0, 8, 2, false, 0, 0, GL_LUMINANCE_ALPHA, GL_FLOAT, GL_FLOAT, GL_LINEAR, RequireExtAndExt<&Extensions::textureStorage, &Extensions::textureFloat>, NeverSupported, AlwaysSupported }, // GL_LUMINANCE_ALPHA32F_EXT
+    { 0, 0, 0, 16, 16, 0, 0, 0, 4, 2, false, 0, 0, GL_LUMINANCE_ALPHA, GL_HALF_FLOAT, GL_FLOAT, GL_LINEAR, RequireExtAndExt<&Extensions::textureStorage, &Extensions::textureHalfFloat>, NeverSupported, AlwaysSupported }, // GL_LUMINANCE_ALPHA16F_EXT
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, false, 0, 0, GL_ALPHA, GL_NONE, GL_NONE, GL_NONE, RequireES<2>, NeverSupported, AlwaysSupported }, // GL_ALPHA
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, false, 0, 0, GL_LUMINANCE, GL_NONE, GL_NONE, GL_NONE, RequireES<2>, NeverSupported, AlwaysSupported }, // GL_LUMINANCE
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, false, 0, 0, GL_LUMINANCE_ALPHA, GL_NONE, GL_NONE, GL_NONE, RequireES<2>, NeverSupported, AlwaysSupported }, // GL_LUMINANCE_ALPHA
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, false, 0, 0, GL_RED, GL_NONE, GL_NONE, GL_NONE, RequireESOrExt<3, &Extensions::textureRG>, NeverSupported, AlwaysSupported }, // GL_RED
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, false, 0, 0, GL_RG, GL_NONE, GL_NONE, GL_NONE, RequireESOrExt<3, &Extensions::textureRG>, NeverSupported, AlwaysSupported }, // GL_RG
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, false, 0, 0, GL_RGB, GL_NONE, GL_NONE, GL_NONE, RequireES<2>, RequireES<2>, AlwaysSupported }, // GL_RGB
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, false, 0, 0, GL_RGBA, GL_NONE, GL_NONE, GL_NONE, RequireES<2>, RequireES<2>, AlwaysSupported }, // GL_RGBA
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, false, 0, 0, GL_RED_INTEGER, GL_NONE, GL_NONE, GL_NONE, RequireES<3>, NeverSupported, NeverSupported }, // GL_RED_INTEGER
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, false, 0, 0, GL_RG_INTEGER, GL_NONE, GL_NONE, GL_NONE, RequireES<3>, NeverSupported, NeverSupported }, // GL_RG_INTEGER
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, false, 0, 0, GL_RGB_INTEGER, GL_NONE, GL_NONE, GL_NONE, RequireES<3>, NeverSupported, NeverSupported }, // GL_RGB_INTEGER
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, false, 0, 0, GL_RGBA_INTEGER, GL_NONE, GL_NONE, GL_NONE, RequireES<3>, NeverSupported, NeverSupported }, // GL_RGBA_INTEGER
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, false, 0, 0, GL_BGRA_EXT, GL_NONE, GL_NONE, GL_NONE, RequireExt<&Extensions::textureFormatBGRA8888>, RequireExt<&Extensions::textureFormatBGRA8888>, AlwaysSupported }, // GL_BGRA_EXT
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, false, 0, 0, GL_DEPTH_COMPONENT, GL_NONE, GL_NONE, GL_NONE, RequireES<2>, RequireES<2>, AlwaysSupported }, // GL_DEPTH_COMPONENT
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, false, 0, 0, GL_DEPTH_STENCIL, GL_NONE, GL_NONE, GL_NONE, RequireESOrExt<3, &Extensions::packedDepthStencil>, RequireESOrExt<3, &Extensions::packedDepthStencil>, AlwaysSupported }, // GL_DEPTH_STENCIL
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, false, 0, 0, GL_RGB, GL_NONE, GL_NONE, GL_NONE, RequireESOrExt<3, &Extensions::sRGB>, NeverSupported, AlwaysSupported }, // GL_SRGB_EXT
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, false, 0, 0, GL_RGBA, GL_NONE, GL_NONE, GL_NONE, RequireESOrExt<3, &Extensions::sRGB>, RequireESOrExt<3, &Extensions::sRGB>, AlwaysSupported }, // GL_SRGB_ALPHA_EXT
+    { 0, 0, 0, 0, 0, 0, 0, 0, 8, 1, true, 4, 4, GL_COMPRESSED_R11_EAC, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<3>, NeverSupported, AlwaysSupported }, // GL_COMPRESSED_R11_EAC
+    { 0, 0, 0, 0, 0, 0, 0, 0, 8, 1, true, 4, 4, GL_COMPRESSED_SIGNED_R11_EAC, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<3>, NeverSupported, AlwaysSupported }, // GL_COMPRESSED_SIGNED_R11_EAC
+    { 0, 0, 0, 0, 0, 0, 0, 0, 16, 2, true, 4, 4, GL_COMPRESSED_RG11_EAC, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<3>, NeverSupported, AlwaysSupported }, // GL_COMPRESSED_RG11_EAC
+    { 0, 0, 0, 0, 0, 0, 0, 0, 16, 2, true, 4, 4, GL_COMPRESSED_SIGNED_RG11_EAC, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<3>, NeverSupported, AlwaysSupported }, // GL_COMPRESSED_SIGNED_RG11_EAC
+    { 0, 0, 0, 0, 0, 0, 0, 0, 8, 3, true, 4, 4, GL_COMPRESSED_RGB8_ETC2, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<3>, NeverSupported, AlwaysSupported }, // GL_COMPRESSED_RGB8_ETC2
+    { 0, 0, 0, 0, 0, 0, 0, 0, 8, 3, true, 4, 4, GL_COMPRESSED_SRGB8_ETC2, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_SRGB, RequireES<3>, NeverSupported, AlwaysSupported }, // GL_COMPRESSED_SRGB8_ETC2
+    { 0, 0, 0, 0, 0, 0, 0, 0, 8, 3, true, 4, 4, GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<3>, NeverSupported, AlwaysSupported }, // GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2
+    { 0, 0, 0, 0, 0, 0, 0, 0, 8, 3, true, 4, 4, GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_SRGB, RequireES<3>, NeverSupported, AlwaysSupported }, // GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2
+    { 0, 0, 0, 0, 0, 0, 0, 0, 16, 4, true, 4, 4, GL_COMPRESSED_RGBA8_ETC2_EAC, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<3>, NeverSupported, AlwaysSupported }, // GL_COMPRESSED_RGBA8_ETC2_EAC
+    { 0, 0, 0, 0, 0, 0, 0, 0, 16, 4, true, 4, 4, GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_SRGB, RequireES<3>, NeverSupported, AlwaysSupported }, // GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC
+    { 0, 0, 0, 0, 0, 0, 0, 0, 8, 3, true, 4, 4, GL_COMPRESSED_RGB_S3TC_DXT1_EXT, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::textureCompressionDXT1>, NeverSupported, AlwaysSupported }, // GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+    { 0, 0, 0, 0, 0, 0, 0, 0, 8, 4, true, 4, 4, GL_COMPRESSED_RGBA_S3TC_DXT1_EXT, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::textureCompressionDXT1>, NeverSupported, AlwaysSupported }, // GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
+    { 0, 0, 0, 0, 0, 0, 0, 0, 16, 4, true, 4, 4, GL_COMPRESSED_RGBA_S3TC_DXT3_ANGLE, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::textureCompressionDXT5>, NeverSupported, AlwaysSupported }, // GL_COMPRESSED_RGBA_S3TC_DXT3_ANGLE
+    { 0, 0, 0, 0, 0, 0, 0, 0, 16, 4, true, 4, 4, GL_COMPRESSED_RGBA_S3TC_DXT5_ANGLE, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::textureCompressionDXT5>, NeverSupported, AlwaysSupported }, // GL_COMPRESSED_RGBA_S3TC_DXT5_ANGLE
+    // STENCIL_INDEX8 uses a normalized component type: multisampled buffers are disallowed for
+    // non-normalized integer component types, all other stencil formats are float or normalized, and it
+    // only affects validation of internalformat in RenderbufferStorageMultisample.
+    { 0, 0, 0, 0, 0, 0, 0, 8, 1, 1, false, 0, 0, GL_DEPTH_STENCIL, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<2>, RequireES<2>, NeverSupported }, // GL_STENCIL_INDEX8
+};
+
+size_t GetInternalFormatTableIndex(GLenum internalFormat)
+{
+    switch (internalFormat)
+    {
+      case GL_R8: return 1;
+      case GL_R8_SNORM: return 2;
+      case GL_RG8: return 3;
+      case GL_RG8_SNORM: return 4;
+      case GL_RGB8: return 5;
+      case GL_RGB8_SNORM: return 6;
+      case GL_RGB565: return 7;
+      case GL_RGBA4: return 8;
+      case GL_RGB5_A1: return 9;
+      case GL_RGBA8: return 10;
+      case GL_RGBA8_SNORM: return 11;
+      case GL_RGB10_A2: return 12;
+      case GL_RGB10_A2UI: return 13;
+      case GL_SRGB8: return 14;
+      case GL_SRGB8_ALPHA8: return 15;
+      case GL_R11F_G11F_B10F: return 16;
+      case GL_RGB9_E5: return 17;
+      case GL_R8I: return 18;
+      case GL_R8UI: return 19;
+      case GL_R16I: return 20;
+      case GL_R16UI: return 21;
+      case GL_R32I: return 22;
+      case GL_R32UI: return 23;
+      case GL_RG8I: return 24;
+      case GL_RG8UI: return 25;
+      case GL_RG16I: return 26;
+      case GL_RG16UI: return 27;
+      case GL_RG32I: return 28;
+      case GL_RG32UI: return 29;
+      case GL_RGB8I: return 30;
+      case GL_RGB8UI: return 31;
+      case GL_RGB16I: return 32;
+      case GL_RGB16UI: return 33;
+      case GL_RGB32I: return 34;
+      case GL_RGB32UI: return 35;
+      case GL_RGBA8I: return 36;
+      case GL_RGBA8UI: return 37;
+      case GL_RGBA16I: return 38;
+      case GL_RGBA16UI: return 39;
+      case GL_RGBA32I: return 40;
+      case GL_RGBA32UI: return 41;
+      case GL_BGRA8_EXT: return 42;
+      case GL_BGRA4_ANGLEX: return 43;
+      case GL_BGR5_A1_ANGLEX: return 44;
+      case GL_R16F: return 45;
+      case GL_RG16F: return 46;
+      case GL_RGB16F: return 47;
+      case GL_RGBA16F: return 48;
+      case GL_R32F: return 49;
+      case GL_RG32F: return 50;
+      case GL_RGB32F: return 51;
+      case GL_RGBA32F: return 52;
+      case GL_DEPTH_COMPONENT16: return 53;
+      case GL_DEPTH_COMPONENT24: return 54;
+      case GL_DEPTH_COMPONENT32F: return 55;
+      case GL_DEPTH_COMPONENT32_OES: return 56;
+      case GL_DEPTH24_STENCIL8: return 57;
+      case GL_DEPTH32F_STENCIL8: return 58;
+      case GL_ALPHA8_EXT: return 59;
+      case GL_LUMINANCE8_EXT: return 60;
+      case GL_ALPHA32F_EXT: return 61;
+      case GL_LUMINANCE32F_EXT: return 62;
+      case GL_ALPHA16F_EXT: return 63;
+      case GL_LUMINANCE16F_EXT: return 64;
+      case GL_LUMINANCE8_ALPHA8_EXT: return 65;
+      case GL_LUMINANCE_ALPHA32F_EXT: return 66;
+      case GL_LUMINANCE_ALPHA16F_EXT: return 67;
+      case GL_ALPHA: return 68;
+      case GL_LUMINANCE: return 69;
+      case GL_LUMINANCE_ALPHA: return 70;
+      case GL_RED: return 71;
+      case GL_RG: return 72;
+      case GL_RGB: return 73;
+      case GL_RGBA: return 74;
+      case GL_RED_INTEGER: return 75;
+      case GL_RG_INTEGER: return 76;
+      case GL_RGB_INTEGER: return 77;
+      case GL_RGBA_INTEGER: return 78;
+      case GL_BGRA_EXT: return 79;
+      case GL_DEPTH_COMPONENT: return 80;
+      case GL_DEPTH_STENCIL: return 81;
+      case GL_SRGB_EXT: return 82;
+      case GL_SRGB_ALPHA_EXT: return 83;
+      case GL_COMPRESSED_R11_EAC: return 84;
+      case GL_COMPRESSED_SIGNED_R11_EAC: return 85;
+      case GL_COMPRESSED_RG11_EAC: return 86;
+      case GL_COMPRESSED_SIGNED_RG11_EAC: return 87;
+      case GL_COMPRESSED_RGB8_ETC2: return 88;
+      case GL_COMPRESSED_SRGB8_ETC2: return 89;
+      case GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2: return 90;
+      case GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2: return 91;
+      case GL_COMPRESSED_RGBA8_ETC2_EAC: return 92;
+      case GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC: return 93;
+      case GL_COMPRESSED_RGB_S3TC_DXT1_EXT: return 94;
+      case GL_COMPRESSED_RGBA_S3TC_DXT1_EXT: return 95;
+      case GL_COMPRESSED_RGBA_S3TC_DXT3_ANGLE: return 96;
+      case GL_COMPRESSED_RGBA_S3TC_DXT5_ANGLE: return 97;
+      case GL_STENCIL_INDEX8: return 98;
+      default: return 0;
+    }
+}
+
+// The internal format chosen for an unsized format and type pair, or GL_NONE if the pair is invalid.
+GLenum GetUnsizedFormatTypeInternalFormat(GLenum format, GLenum type)
+{
+    switch (format)
+    {
+      case GL_RGBA:
+        switch (type)
+        {
+          case GL_UNSIGNED_BYTE: return GL_RGBA8;
+          case GL_BYTE: return GL_RGBA8_SNORM;
+          case GL_UNSIGNED_SHORT_4_4_4_4: return GL_RGBA4;
+          case GL_UNSIGNED_SHORT_5_5_5_1: return GL_RGB5_A1;
+          case GL_UNSIGNED_INT_2_10_10_10_REV: return GL_RGB10_A2;
+          case GL_FLOAT: return GL_RGBA32F;
+          case GL_HALF_FLOAT: return GL_RGBA16F;
+          case GL_HALF_FLOAT_OES: return GL_RGBA16F;
+          default: break;
+        }
+        break;
+      case GL_RGBA_INTEGER:
+        switch (type)
+        {
+          case GL_UNSIGNED_BYTE: return GL_RGBA8UI;
+          case GL_BYTE: return GL_RGBA8I;
+          case GL_UNSIGNED_SHORT: return GL_RGBA16UI;
+          case GL_SHORT: return GL_RGBA16I;
+          case GL_UNSIGNED_INT: return GL_RGBA32UI;
+          case GL_INT: return GL_RGBA32I;
+          case GL_UNSIGNED_INT_2_10_10_10_REV: return GL_RGB10_A2UI;
+          default: break;
+        }
+        break;
+      case GL_RGB:
+        switch (type)
+        {
+          case GL_UNSIGNED_BYTE: return GL_RGB8;
+          case GL_BYTE: return GL_RGB8_SNORM;
+          case GL_UNSIGNED_SHORT_5_6_5: return GL_RGB565;
+          case GL_UNSIGNED_INT_10F_11F_11F_REV: return GL_R11F_G11F_B10F;
+          case GL_UNSIGNED_INT_5_9_9_9_REV: return GL_RGB9_E5;
+          case GL_FLOAT: return GL_RGB32F;
+          case GL_HALF_FLOAT: return GL_RGB16F;
+          case GL_HALF_FLOAT_OES: return GL_RGB16F;
+          default: break;
+        }
+        break;
+      case GL_RGB_INTEGER:
+        switch (type)
+        {
+          case GL_UNSIGNED_BYTE: return GL_RGB8UI;
+          case GL_BYTE: return GL_RGB8I;
+          case GL_UNSIGNED_SHORT: return GL_RGB16UI;
+          case GL_SHORT: return GL_RGB16I;
+          case GL_UNSIGNED_INT: return GL_RGB32UI;
+          case GL_INT: return GL_RGB32I;
+          default: break;
+        }
+        break;
+      case GL_RG:
+        switch (type)
+        {
+          case GL_UNSIGNED_BYTE: return GL_RG8;
+          case GL_BYTE: return GL_RG8_SNORM;
+          case GL_FLOAT: return GL_RG32F;
+          case GL_HALF_FLOAT: return GL_RG16F;
+          case GL_HALF_FLOAT_OES: return GL_RG16F;
+          default: break;
+        }
+        break;
+      case GL_RG_INTEGER:
+        switch (type)
+        {
+          case GL_UNSIGNED_BYTE: return GL_RG8UI;
+          case GL_BYTE: return GL_RG8I;
+          case GL_UNSIGNED_SHORT: return GL_RG16UI;
+          case GL_SHORT: return GL_RG16I;
+          case GL_UNSIGNED_INT: return GL_RG32UI;
+          case GL_INT: return GL_RG32I;
+          default: break;
+        }
+        break;
+      case GL_RED:
+        switch (type)
+        {
+          case GL_UNSIGNED_BYTE: return GL_R8;
+          case GL_BYTE: return GL_R8_SNORM;
+          case GL_FLOAT: return GL_R32F;
+          case GL_HALF_FLOAT: return GL_R16F;
+          case GL_HALF_FLOAT_OES: return GL_R16F;
+          default: break;
+        }
+        break;
+      case GL_RED_INTEGER:
+        switch (type)
+        {
+          case GL_UNSIGNED_BYTE: return GL_R8UI;
+          case GL_BYTE: return GL_R8I;
+          case GL_UNSIGNED_SHORT: return GL_R16UI;
+          case GL_SHORT: return GL_R16I;
+          case GL_UNSIGNED_INT: return GL_R32UI;
+          case GL_INT: return GL_R32I;
+          default: break;
+        }
+        break;
+      case GL_LUMINANCE_ALPHA:
+        switch (type)
+        {
+          case GL_UNSIGNED_BYTE: return GL_LUMINANCE8_ALPHA8_EXT;
+          case GL_FLOAT: return GL_LUMINANCE_ALPHA32F_EXT;
+          case GL_HALF_FLOAT: return GL_LUMINANCE_ALPHA16F_EXT;
+          case GL_HALF_FLOAT_OES: return GL_LUMINANCE_ALPHA16F_EXT;
+          default: break;
+        }
+        break;
+      case GL_LUMINANCE:
+        switch (type)
+        {
+          case GL_UNSIGNED_BYTE: return GL_LUMINANCE8_EXT;
+          case GL_FLOAT: return GL_LUMINANCE32F_EXT;
+          case GL_HALF_FLOAT: return GL_LUMINANCE16F_EXT;
+          case GL_HALF_FLOAT_OES: return GL_LUMINANCE16F_EXT;
+          default: break;
+        }
+        break;
+      case GL_ALPHA:
+        switch (type)
+        {
+          case GL_UNSIGNED_BYTE: return GL_ALPHA8_EXT;
+          case GL_FLOAT: return GL_ALPHA32F_EXT;
+          case GL_HALF_FLOAT: return GL_ALPHA16F_EXT;
+          case GL_HALF_FLOAT_OES: return GL_ALPHA16F_EXT;
+          default: break;
+        }
+        break;
+      case GL_BGRA_EXT:
+        switch (type)
+        {
+          case GL_UNSIGNED_BYTE: return GL_BGRA8_EXT;
+          case GL_UNSIGNED_SHORT_4_4_4_4_REV_EXT: return GL_BGRA4_ANGLEX;
+          case GL_UNSIGNED_SHORT_1_5_5_5_REV_EXT: return GL_BGR5_A1_ANGLEX;
+          default: break;
+        }
+        break;
+      case GL_SRGB_EXT:
+        switch (type)
+        {
+          case GL_UNSIGNED_BYTE: return GL_SRGB8;
+          default: break;
+        }
+        break;
+      case GL_SRGB_ALPHA_EXT:
+        switch (type)
+        {
+          case GL_UNSIGNED_BYTE: return GL_SRGB8_ALPHA8;
+          default: break;
+        }
+        break;
+      case GL_COMPRESSED_RGB_S3TC_DXT1_EXT:
+        switch (type)
+        {
+          case GL_UNSIGNED_BYTE: return GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+          default: break;
+        }
+        break;
+      case GL_COMPRESSED_RGBA_S3TC_DXT1_EXT:
+        switch (type)
+        {
+          case GL_UNSIGNED_BYTE: return GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
+          default: break;
+        }
+        break;
+      case GL_COMPRESSED_RGBA_S3TC_DXT3_ANGLE:
+        switch (type)
+        {
+          case GL_UNSIGNED_BYTE: return GL_COMPRESSED_RGBA_S3TC_DXT3_ANGLE;
+          default: break;
+        }
+        break;
+      case GL_COMPRESSED_RGBA_S3TC_DXT5_ANGLE:
+        switch (type)
+        {
+          case GL_UNSIGNED_BYTE: return GL_COMPRESSED_RGBA_S3TC_DXT5_ANGLE;
+          default: break;
+        }
+        break;
+      case GL_DEPTH_COMPONENT:
+        switch (type)
+        {
+          case GL_UNSIGNED_SHORT: return GL_DEPTH_COMPONENT16;
+          case GL_UNSIGNED_INT: return GL_DEPTH_COMPONENT32_OES;
+          case GL_FLOAT: return GL_DEPTH_COMPONENT32F;
+          default: break;
+        }
+        break;
+      case GL_STENCIL:
+        switch (type)
+        {
+          case GL_UNSIGNED_BYTE: return GL_STENCIL_INDEX8;
+          default: break;
+        }
+        break;
+      case GL_DEPTH_STENCIL:
+        switch (type)
+        {
+          case GL_UNSIGNED_INT_24_8: return GL_DEPTH24_STENCIL8;
+          case GL_FLOAT_32_UNSIGNED_INT_24_8_REV: return GL_DEPTH32F_STENCIL8;
+          default: break;
+        }
+        break;
+      default:
+        break;
+    }
+
+    return GL_NONE;
+}
+
+const GLenum SizedInternalFormats[] =
+{
+    GL_R8,
+    GL_R8_SNORM,
+    GL_RG8,
+    GL_RG8_SNORM,
+    GL_RGB8,
+    GL_RGB8_SNORM,
+    GL_RGB565,
+    GL_RGBA4,
+    GL_RGB5_A1,
+    GL_RGBA8,
+    GL_RGBA8_SNORM,
+    GL_RGB10_A2,
+    GL_RGB10_A2UI,
+    GL_SRGB8,
+    GL_SRGB8_ALPHA8,
+    GL_R11F_G11F_B10F,
+    GL_RGB9_E5,
+    GL_R8I,
+    GL_R8UI,
+    GL_R16I,
+    GL_R16UI,
+    GL_R32I,
+    GL_R32UI,
+    GL_RG8I,
+    GL_RG8UI,
+    GL_RG16I,
+    GL_RG16UI,
+    GL_RG32I,
+    GL_RG32UI,
+    GL_RGB8I,
+    GL_RGB8UI,
+    GL_RGB16I,
+    GL_RGB16UI,
+    GL_RGB32I,
+    GL_RGB32UI,
+    GL_RGBA8I,
+    GL_RGBA8UI,
+    GL_RGBA16I,
+    GL_RGBA16UI,
+    GL_RGBA32I,
+    GL_RGBA32UI,
+    GL_BGRA8_EXT,
+    GL_BGRA4_ANGLEX,
+    GL_BGR5_A1_ANGLEX,
+    GL_R16F,
+    GL_RG16F,
+    GL_RGB16F,
+    GL_RGBA16F,
+    GL_R32F,
+    GL_RG32F,
+    GL_RGB32F,
+    GL_RGBA32F,
+    GL_DEPTH_COMPONENT16,
+    GL_DEPTH_COMPONENT24,
+    GL_DEPTH_COMPONENT32F,
+    GL_DEPTH_COMPONENT32_OES,
+    GL_DEPTH24_STENCIL8,
+    GL_DEPTH32F_STENCIL8,
+    GL_ALPHA8_EXT,
+    GL_LUMINANCE8_EXT,
+    GL_ALPHA32F_EXT,
+    GL_LUMINANCE32F_EXT,
+    GL_ALPHA16F_EXT,
+    GL_LUMINANCE16F_EXT,
+    GL_LUMINANCE8_ALPHA8_EXT,
+    GL_LUMINANCE_ALPHA32F_EXT,
+    GL_LUMINANCE_ALPHA16F_EXT,
+    GL_COMPRESSED_R11_EAC,
+    GL_COMPRESSED_SIGNED_R11_EAC,
+    GL_COMPRESSED_RG11_EAC,
+    GL_COMPRESSED_SIGNED_RG11_EAC,
+    GL_COMPRESSED_RGB8_ETC2,
+    GL_COMPRESSED_SRGB8_ETC2,
+    GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2,
+    GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2,
+    GL_COMPRESSED_RGBA8_ETC2_EAC,
+    GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC,
+    GL_COMPRESSED_RGB_S3TC_DXT1_EXT,
+    GL_COMPRESSED_RGBA_S3TC_DXT1_EXT,
+    GL_COMPRESSED_RGBA_S3TC_DXT3_ANGLE,
+    GL_COMPRESSED_RGBA_S3TC_DXT5_ANGLE,
+    GL_STENCIL_INDEX8,
+};
+
+}
+
+}
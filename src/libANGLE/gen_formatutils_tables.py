@@ -0,0 +1,189 @@
+# Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+# Use of this source code is governed by a BSD-style license that can be
+# found in the LICENSE file.
+#
+
+# This script generates formatutils_autogen.inl from formatutils_data.json.
+# The output holds the GL type and internal format tables as statically
+# initialized arrays, with switch statements mapping enums to table entries,
+# so that format queries need neither map lookups nor static constructors.
+#
+# Run it from this directory after editing formatutils_data.json and commit
+# both files.
+
+import json
+import os
+import textwrap
+from collections import OrderedDict
+
+script_dir = os.path.dirname(os.path.abspath(__file__))
+data_path = os.path.join(script_dir, 'formatutils_data.json')
+output_path = os.path.join(script_dir, 'formatutils_autogen.inl')
+
+template = """//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// formatutils_autogen.inl: Tables of GL types and internal formats.
+// This file is automatically generated by gen_formatutils_tables.py from
+// formatutils_data.json. Do not edit it by hand.
+
+namespace gl
+{{
+
+namespace
+{{
+
+// Entry 0 is returned for unknown types.
+const Type TypeTable[] =
+{{
+    // Bytes, special interpretation
+{type_rows}
+}};
+
+size_t GetTypeTableIndex(GLenum type)
+{{
+    switch (type)
+    {{
+{type_cases}
+      default: return 0;
+    }}
+}}
+
+// Entry 0 is GL_NONE, which is also returned for unknown internal formats.
+const InternalFormat InternalFormatTable[] =
+{{
+    // Red, green, blue, luminance, alpha, shared, depth and stencil bits, pixel bytes, component count,
+    // compressed, block width and height, format, type, component type, color encoding, and the
+    // texture, render and filter support checks.
+{format_rows}
+}};
+
+size_t GetInternalFormatTableIndex(GLenum internalFormat)
+{{
+    switch (internalFormat)
+    {{
+{format_cases}
+      default: return 0;
+    }}
+}}
+
+// The internal format chosen for an unsized format and type pair, or GL_NONE if the pair is invalid.
+GLenum GetUnsizedFormatTypeInternalFormat(GLenum format, GLenum type)
+{{
+    switch (format)
+    {{
+{unsized_cases}
+      default:
+        break;
+    }}
+
+    return GL_NONE;
+}}
+
+const GLenum SizedInternalFormats[] =
+{{
+{sized_formats}
+}};
+
+}}
+
+}}
+"""
+
+def load_data():
+    with open(data_path) as data_file:
+        return json.load(data_file, object_pairs_hook=OrderedDict)
+
+def generate_types(types):
+    rows = ['    {{ {0}, {1} }}, // Unknown types'.format(0, 'false')]
+    cases = []
+    for index, info in enumerate(types, 1):
+        special = 'true' if info['specialInterpretation'] else 'false'
+        rows.append('    {{ {0}, {1} }}, // {2}'.format(info['bytes'], special, info['type']))
+        cases.append('      case {0}: return {1};'.format(info['type'], index))
+    return '\n'.join(rows), '\n'.join(cases)
+
+def format_row(info):
+    bits = info.get('bits', {})
+    channels = ['red', 'green', 'blue', 'luminance', 'alpha', 'shared', 'depth', 'stencil']
+    values = [bits.get(channel, 0) for channel in channels]
+
+    block = info.get('compressedBlock')
+    if block:
+        pixel_bytes = block['bits'] // 8
+        component_count = info['componentCount']
+    else:
+        pixel_bytes = (sum(values) + bits.get('unused', 0)) // 8
+        component_count = len([channel for channel in channels if channel != 'shared' and bits.get(channel, 0) > 0])
+
+    sized = 'type' in info
+    if block:
+        component_type = 'GL_UNSIGNED_NORMALIZED'
+    else:
+        component_type = info.get('componentType', 'GL_NONE')
+
+    if not sized:
+        encoding = 'GL_NONE'
+    elif info.get('srgb', False):
+        encoding = 'GL_SRGB'
+    else:
+        encoding = 'GL_LINEAR'
+
+    fields = [str(value) for value in values]
+    fields += [str(pixel_bytes), str(component_count)]
+    fields += ['true' if block else 'false', str(block['width'] if block else 0), str(block['height'] if block else 0)]
+    fields += [info['format'], info.get('type', 'GL_NONE'), component_type, encoding]
+    fields += [info['textureSupport'], info['renderSupport'], info['filterSupport']]
+    return '{ ' + ', '.join(fields) + ' }', pixel_bytes
+
+def generate_internal_formats(formats):
+    rows = ['    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, false, 0, 0, GL_NONE, GL_NONE, GL_NONE, GL_NONE, '
+            'NeverSupported, NeverSupported, NeverSupported }, // GL_NONE']
+    cases = []
+    sized = []
+    for index, info in enumerate(formats, 1):
+        row, pixel_bytes = format_row(info)
+        if 'comment' in info:
+            rows += ['    // ' + line for line in textwrap.wrap(info['comment'], 100, break_on_hyphens=False)]
+        rows.append('    {0}, // {1}'.format(row, info['internalFormat']))
+        cases.append('      case {0}: return {1};'.format(info['internalFormat'], index))
+        if pixel_bytes > 0:
+            sized.append('    {0},'.format(info['internalFormat']))
+    return '\n'.join(rows), '\n'.join(cases), '\n'.join(sized)
+
+def generate_unsized(pairs):
+    by_format = OrderedDict()
+    for pair in pairs:
+        by_format.setdefault(pair['format'], []).append(pair)
+
+    cases = []
+    for format, format_pairs in by_format.items():
+        cases.append('      case {0}:'.format(format))
+        cases.append('        switch (type)')
+        cases.append('        {')
+        for pair in format_pairs:
+            cases.append('          case {0}: return {1};'.format(pair['type'], pair['internalFormat']))
+        cases.append('          default: break;')
+        cases.append('        }')
+        cases.append('        break;')
+    return '\n'.join(cases)
+
+def main():
+    data = load_data()
+
+    type_rows, type_cases = generate_types(data['types'])
+    format_rows, format_cases, sized_formats = generate_internal_formats(data['internalFormats'])
+    unsized_cases = generate_unsized(data['unsizedFormatTypes'])
+
+    output = template.format(type_rows=type_rows, type_cases=type_cases,
+                             format_rows=format_rows, format_cases=format_cases,
+                             unsized_cases=unsized_cases, sized_formats=sized_formats)
+
+    with open(output_path, 'w') as output_file:
+        output_file.write(output)
+
+if __name__ == '__main__':
+    main()
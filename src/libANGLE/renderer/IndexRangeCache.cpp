@@ -15,6 +15,25 @@
 namespace rx
 {
 
+namespace
+{
+
+// Upper bound on the number of ranges cached per buffer.
+const size_t DefaultMaxEntries = 1024;
+
+size_t GetSummaryIndex(GLenum type)
+{
+    switch (type)
+    {
+      case GL_UNSIGNED_BYTE:  return 0;
+      case GL_UNSIGNED_SHORT: return 1;
+      case GL_UNSIGNED_INT:   return 2;
+      default: UNREACHABLE(); return 0;
+    }
+}
+
+}
+
 template <class IndexType>
 static RangeUI ComputeTypedRange(const IndexType *indices, GLsizei count)
 {
@@ -30,8 +49,48 @@ static RangeUI ComputeTypedRange(const IndexType *indices, GLsizei count)
     return RangeUI(minIndex, maxIndex);
 }
 
-RangeUI IndexRangeCache::ComputeRange(GLenum type, const GLvoid *indices, GLsizei count)
+template <class IndexType>
+static RangeUI ComputeTypedRangeWithRestart(const IndexType *indices, GLsizei count)
 {
+    const IndexType restartIndex = std::numeric_limits<IndexType>::max();
+
+    unsigned int minIndex = std::numeric_limits<unsigned int>::max();
+    unsigned int maxIndex = 0;
+    bool foundIndex = false;
+
+    for (GLsizei i = 0; i < count; i++)
+    {
+        if (indices[i] != restartIndex)
+        {
+            if (minIndex > indices[i]) minIndex = indices[i];
+            if (maxIndex < indices[i]) maxIndex = indices[i];
+            foundIndex = true;
+        }
+    }
+
+    // A draw made only of restart indices uses no vertices.
+    return foundIndex ? RangeUI(minIndex, maxIndex) : RangeUI(0, 0);
+}
+
+RangeUI IndexRangeCache::ComputeRange(GLenum type, const GLvoid *indices, GLsizei count,
+                                      bool primitiveRestartEnabled)
+{
+    if (primitiveRestartEnabled)
+    {
+        switch (type)
+        {
+          case GL_UNSIGNED_BYTE:
+            return ComputeTypedRangeWithRestart(static_cast<const GLubyte*>(indices), count);
+          case GL_UNSIGNED_INT:
+            return ComputeTypedRangeWithRestart(static_cast<const GLuint*>(indices), count);
+          case GL_UNSIGNED_SHORT:
+            return ComputeTypedRangeWithRestart(static_cast<const GLushort*>(indices), count);
+          default:
+            UNREACHABLE();
+            return RangeUI();
+        }
+    }
+
     switch (type)
     {
       case GL_UNSIGNED_BYTE:
@@ -46,42 +105,119 @@ RangeUI IndexRangeCache::ComputeRange(GLenum type, const GLvoid *indices, GLsize
     }
 }
 
-void IndexRangeCache::addRange(GLenum type, unsigned int offset, GLsizei count, const RangeUI &range,
-                               unsigned int streamOffset)
+IndexRangeCache::IndexRangeCache()
+    : mMaxEntries(DefaultMaxEntries),
+      mPrioritySeed(0x9E3779B9u),
+      mTreeRoot(NULL),
+      mLRUHead(NULL),
+      mLRUTail(NULL)
+{
+}
+
+IndexRangeCache::IndexRangeCache(size_t maxEntries)
+    : mMaxEntries(maxEntries),
+      mPrioritySeed(0x9E3779B9u),
+      mTreeRoot(NULL),
+      mLRUHead(NULL),
+      mLRUTail(NULL)
+{
+    ASSERT(mMaxEntries > 0);
+}
+
+IndexRangeCache::~IndexRangeCache()
 {
-    mIndexRangeCache[IndexRange(type, offset, count)] = IndexBounds(range, streamOffset);
+}
+
+void IndexRangeCache::addRange(GLenum type, unsigned int offset, GLsizei count, bool primitiveRestartEnabled,
+                               const RangeUI &range, unsigned int streamOffset)
+{
+    IndexRange key(type, offset, count, primitiveRestartEnabled);
+
+    IndexRangeMap::iterator existing = mIndexRangeCache.find(key);
+    if (existing != mIndexRangeCache.end())
+    {
+        removeEntry(&existing->second);
+    }
+
+    Entry &entry = mIndexRangeCache[key];
+    entry.key = key;
+    entry.bounds = IndexBounds(range, streamOffset);
+    entry.start = streamOffset;
+    entry.end = streamOffset + (gl::GetTypeInfo(type).bytes * count);
+
+    // Xorshift keeps the treap balanced in expectation regardless of insertion order.
+    mPrioritySeed ^= mPrioritySeed << 13;
+    mPrioritySeed ^= mPrioritySeed >> 17;
+    mPrioritySeed ^= mPrioritySeed << 5;
+    entry.priority = mPrioritySeed;
+
+    Insert(&mTreeRoot, &entry);
+    touchEntry(&entry);
+
+    while (mIndexRangeCache.size() > mMaxEntries)
+    {
+        // The list only holds const entries, so the tail is looked up for removal.
+        removeEntry(&mIndexRangeCache.find(mLRUTail->key)->second);
+    }
+}
+
+RangeUI IndexRangeCache::computeBufferRange(GLenum type, const uint8_t *bufferData, size_t bufferSize,
+                                            unsigned int offset, GLsizei count,
+                                            bool primitiveRestartEnabled) const
+{
+    unsigned int typeBytes = gl::GetTypeInfo(type).bytes;
+
+    // Short or unaligned ranges are cheaper to scan than to summarize. The summary does not
+    // know about restart indices, so those ranges are scanned as well.
+    if (static_cast<size_t>(count) < IndexRangeSummary::BlockSize * 4 || offset % typeBytes != 0 ||
+        primitiveRestartEnabled)
+    {
+        return ComputeRange(type, bufferData + offset, count, primitiveRestartEnabled);
+    }
+
+    IndexRangeSummary &summary = mSummaries[GetSummaryIndex(type)];
+    if (!summary.isBuilt(type))
+    {
+        summary.build(type, bufferData, bufferSize);
+    }
+
+    return summary.query(bufferData, offset / typeBytes, count);
 }
 
 void IndexRangeCache::invalidateRange(unsigned int offset, unsigned int size)
 {
+    if (size == 0)
+    {
+        return;
+    }
+
+    for (size_t summaryIndex = 0; summaryIndex < IndexTypeCount; summaryIndex++)
+    {
+        mSummaries[summaryIndex].invalidate(offset, size);
+    }
+
     unsigned int invalidateStart = offset;
     unsigned int invalidateEnd = offset + size;
 
-    IndexRangeMap::iterator i = mIndexRangeCache.begin();
-    while (i != mIndexRangeCache.end())
-    {
-        unsigned int rangeStart = i->second.streamOffset;
-        unsigned int rangeEnd = i->second.streamOffset + (gl::GetTypeInfo(i->first.type).bytes * i->first.count);
+    std::vector<Entry*> overlaps;
+    CollectOverlaps(mTreeRoot, invalidateStart, invalidateEnd, &overlaps);
 
-        if (invalidateEnd < rangeStart || invalidateStart > rangeEnd)
-        {
-            ++i;
-        }
-        else
-        {
-            mIndexRangeCache.erase(i++);
-        }
+    for (size_t i = 0; i < overlaps.size(); i++)
+    {
+        removeEntry(overlaps[i]);
     }
 }
 
-bool IndexRangeCache::findRange(GLenum type, unsigned int offset, GLsizei count,
+bool IndexRangeCache::findRange(GLenum type, unsigned int offset, GLsizei count, bool primitiveRestartEnabled,
                                 RangeUI *outRange, unsigned int *outStreamOffset) const
 {
-    IndexRangeMap::const_iterator i = mIndexRangeCache.find(IndexRange(type, offset, count));
+    IndexRangeMap::const_iterator i = mIndexRangeCache.find(IndexRange(type, offset, count, primitiveRestartEnabled));
     if (i != mIndexRangeCache.end())
     {
-        if (outRange)        *outRange = i->second.range;
-        if (outStreamOffset) *outStreamOffset = i->second.streamOffset;
+        touchEntry(&i->second);
+
+        if (outRange)        *outRange = i->second.bounds.range;
+        if (outStreamOffset) *outStreamOffset = i->second.bounds.streamOffset;
         return true;
     }
     else
@@ -95,15 +231,201 @@ bool IndexRangeCache::findRange(GLenum type, unsigned int offset, GLsizei count,
 void IndexRangeCache::clear()
 {
     mIndexRangeCache.clear();
+    mTreeRoot = NULL;
+    mLRUHead = NULL;
+    mLRUTail = NULL;
+
+    for (size_t summaryIndex = 0; summaryIndex < IndexTypeCount; summaryIndex++)
+    {
+        mSummaries[summaryIndex].reset();
+    }
+}
+
+void IndexRangeCache::removeEntry(Entry *entry)
+{
+    Erase(&mTreeRoot, entry);
+    unlinkEntry(entry);
+
+    // Erasing from the map destroys the entry, so copy the key out first.
+    IndexRange key = entry->key;
+    mIndexRangeCache.erase(key);
+}
+
+void IndexRangeCache::touchEntry(const Entry *entry) const
+{
+    if (mLRUHead == entry)
+    {
+        return;
+    }
+
+    unlinkEntry(entry);
+
+    entry->lruPrev = NULL;
+    entry->lruNext = mLRUHead;
+    if (mLRUHead)
+    {
+        mLRUHead->lruPrev = entry;
+    }
+    mLRUHead = entry;
+
+    if (!mLRUTail)
+    {
+        mLRUTail = entry;
+    }
+}
+
+void IndexRangeCache::unlinkEntry(const Entry *entry) const
+{
+    if (entry->lruPrev)
+    {
+        entry->lruPrev->lruNext = entry->lruNext;
+    }
+    else if (mLRUHead == entry)
+    {
+        mLRUHead = entry->lruNext;
+    }
+
+    if (entry->lruNext)
+    {
+        entry->lruNext->lruPrev = entry->lruPrev;
+    }
+    else if (mLRUTail == entry)
+    {
+        mLRUTail = entry->lruPrev;
+    }
+
+    entry->lruPrev = NULL;
+    entry->lruNext = NULL;
+}
+
+void IndexRangeCache::UpdateMaxEnd(Entry *node)
+{
+    node->maxEnd = node->end;
+    if (node->left && node->left->maxEnd > node->maxEnd)
+    {
+        node->maxEnd = node->left->maxEnd;
+    }
+    if (node->right && node->right->maxEnd > node->maxEnd)
+    {
+        node->maxEnd = node->right->maxEnd;
+    }
+}
+
+bool IndexRangeCache::EntryLess(const Entry *lhs, const Entry *rhs)
+{
+    // Several entries may share a start offset, so ties are broken on the entry address.
+    if (lhs->start != rhs->start) return lhs->start < rhs->start;
+    return lhs < rhs;
+}
+
+void IndexRangeCache::Split(Entry *node, const Entry *key, Entry **leftOut, Entry **rightOut)
+{
+    if (!node)
+    {
+        *leftOut = NULL;
+        *rightOut = NULL;
+    }
+    else if (EntryLess(node, key))
+    {
+        Split(node->right, key, &node->right, rightOut);
+        *leftOut = node;
+        UpdateMaxEnd(node);
+    }
+    else
+    {
+        Split(node->left, key, leftOut, &node->left);
+        *rightOut = node;
+        UpdateMaxEnd(node);
+    }
+}
+
+IndexRangeCache::Entry *IndexRangeCache::Merge(Entry *left, Entry *right)
+{
+    if (!left) return right;
+    if (!right) return left;
+
+    if (left->priority > right->priority)
+    {
+        left->right = Merge(left->right, right);
+        UpdateMaxEnd(left);
+        return left;
+    }
+    else
+    {
+        right->left = Merge(left, right->left);
+        UpdateMaxEnd(right);
+        return right;
+    }
+}
+
+void IndexRangeCache::Insert(Entry **root, Entry *node)
+{
+    if (!*root)
+    {
+        node->left = NULL;
+        node->right = NULL;
+        UpdateMaxEnd(node);
+        *root = node;
+    }
+    else if (node->priority > (*root)->priority)
+    {
+        Split(*root, node, &node->left, &node->right);
+        UpdateMaxEnd(node);
+        *root = node;
+    }
+    else
+    {
+        Insert(EntryLess(node, *root) ? &(*root)->left : &(*root)->right, node);
+        UpdateMaxEnd(*root);
+    }
+}
+
+void IndexRangeCache::Erase(Entry **root, Entry *node)
+{
+    ASSERT(*root);
+
+    if (*root == node)
+    {
+        *root = Merge(node->left, node->right);
+        node->left = NULL;
+        node->right = NULL;
+    }
+    else
+    {
+        Erase(EntryLess(node, *root) ? &(*root)->left : &(*root)->right, node);
+        UpdateMaxEnd(*root);
+    }
+}
+
+void IndexRangeCache::CollectOverlaps(Entry *node, unsigned int start, unsigned int end,
+                                      std::vector<Entry*> *overlapsOut)
+{
+    // No interval in this subtree reaches the queried range.
+    if (!node || node->maxEnd <= start)
+    {
+        return;
+    }
+
+    CollectOverlaps(node->left, start, end, overlapsOut);
+
+    // Everything in the right subtree starts at or after this node.
+    if (node->start < end)
+    {
+        if (node->end > start)
+        {
+            overlapsOut->push_back(node);
+        }
+        CollectOverlaps(node->right, start, end, overlapsOut);
+    }
 }
 
 IndexRangeCache::IndexRange::IndexRange()
-    : type(GL_NONE), offset(0), count(0)
+    : type(GL_NONE), offset(0), count(0), primitiveRestartEnabled(false)
 {
 }
 
-IndexRangeCache::IndexRange::IndexRange(GLenum typ, intptr_t off, GLsizei c)
-    : type(typ), offset(off), count(c)
+IndexRangeCache::IndexRange::IndexRange(GLenum typ, intptr_t off, GLsizei c, bool primitiveRestart)
+    : type(typ), offset(off), count(c), primitiveRestartEnabled(primitiveRestart)
 {
 }
 
@@ -111,7 +433,8 @@ bool IndexRangeCache::IndexRange::operator<(const IndexRange& rhs) const
 {
     if (type != rhs.type) return type < rhs.type;
     if (offset != rhs.offset) return offset < rhs.offset;
-    return count < rhs.count;
+    if (count != rhs.count) return count < rhs.count;
+    return primitiveRestartEnabled < rhs.primitiveRestartEnabled;
 }
 
 IndexRangeCache::IndexBounds::IndexBounds()
@@ -125,4 +448,18 @@ IndexRangeCache::IndexBounds::IndexBounds(const RangeUI &rangeIn, unsigned int o
 {
 }
 
+IndexRangeCache::Entry::Entry()
+    : key(),
+      bounds(),
+      start(0),
+      end(0),
+      maxEnd(0),
+      priority(0),
+      left(NULL),
+      right(NULL),
+      lruPrev(NULL),
+      lruNext(NULL)
+{
+}
+
 }
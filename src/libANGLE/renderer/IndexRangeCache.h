@@ -12,36 +12,60 @@
 
 #include "common/angleutils.h"
 #include "common/mathutil.h"
+#include "libANGLE/renderer/IndexRangeSummary.h"
 
 #include "angle_gl.h"
 
 #include <map>
+#include <vector>
 
 namespace rx
 {
 
+// Cached ranges are looked up by (type, offset, count) through a map, and are also kept in an
+// interval treap ordered by stream offset so that invalidating a byte range only visits the
+// entries that overlap it. The number of entries is bounded; the least recently used entry is
+// evicted when the bound is exceeded.
 class IndexRangeCache
 {
   public:
-    void addRange(GLenum type, unsigned int offset, GLsizei count, const RangeUI &range,
-                  unsigned int streamOffset);
-    bool findRange(GLenum type, unsigned int offset, GLsizei count, RangeUI *rangeOut,
-                   unsigned int *outStreamOffset) const;
+    IndexRangeCache();
+    explicit IndexRangeCache(size_t maxEntries);
+    ~IndexRangeCache();
+
+    void addRange(GLenum type, unsigned int offset, GLsizei count, bool primitiveRestartEnabled,
+                  const RangeUI &range, unsigned int streamOffset);
+    bool findRange(GLenum type, unsigned int offset, GLsizei count, bool primitiveRestartEnabled,
+                   RangeUI *rangeOut, unsigned int *outStreamOffset) const;
+
+    // Computes the range of |count| indices at |offset| in |bufferData|, which must be the storage
+    // that this cache tracks. Large queries go through a block summary built on first use.
+    RangeUI computeBufferRange(GLenum type, const uint8_t *bufferData, size_t bufferSize,
+                               unsigned int offset, GLsizei count,
+                               bool primitiveRestartEnabled) const;
 
     void invalidateRange(unsigned int offset, unsigned int size);
     void clear();
 
-    static RangeUI ComputeRange(GLenum type, const GLvoid *indices, GLsizei count);
+    size_t size() const { return mIndexRangeCache.size(); }
+    size_t getMaxEntries() const { return mMaxEntries; }
+
+    // When primitive restart is enabled, the restart index is left out of the range.
+    static RangeUI ComputeRange(GLenum type, const GLvoid *indices, GLsizei count,
+                                bool primitiveRestartEnabled);
 
   private:
+    DISALLOW_COPY_AND_ASSIGN(IndexRangeCache);
+
     struct IndexRange
     {
         GLenum type;
         unsigned int offset;
         GLsizei count;
+        bool primitiveRestartEnabled;
 
         IndexRange();
-        IndexRange(GLenum type, intptr_t offset, GLsizei count);
+        IndexRange(GLenum type, intptr_t offset, GLsizei count, bool primitiveRestartEnabled);
 
         bool operator<(const IndexRange& rhs) const;
     };
@@ -55,8 +79,54 @@ class IndexRangeCache
         IndexBounds(const RangeUI &range, unsigned int offset);
     };
 
-    typedef std::map<IndexRange, IndexBounds> IndexRangeMap;
+    struct Entry
+    {
+        Entry();
+
+        IndexRange key;
+        IndexBounds bounds;
+
+        // Byte interval [start, end) covered by the indices, and the largest end in this subtree.
+        unsigned int start;
+        unsigned int end;
+        unsigned int maxEnd;
+
+        unsigned int priority;
+        Entry *left;
+        Entry *right;
+
+        // Most recently used entries are at the head of the list. Lookups reorder it, so it is
+        // linked through const entries.
+        mutable const Entry *lruPrev;
+        mutable const Entry *lruNext;
+    };
+
+    void removeEntry(Entry *entry);
+    void touchEntry(const Entry *entry) const;
+    void unlinkEntry(const Entry *entry) const;
+
+    static void UpdateMaxEnd(Entry *node);
+    static bool EntryLess(const Entry *lhs, const Entry *rhs);
+    static void Split(Entry *node, const Entry *key, Entry **leftOut, Entry **rightOut);
+    static Entry *Merge(Entry *left, Entry *right);
+    static void Insert(Entry **root, Entry *node);
+    static void Erase(Entry **root, Entry *node);
+    static void CollectOverlaps(Entry *node, unsigned int start, unsigned int end,
+                                std::vector<Entry*> *overlapsOut);
+
+    typedef std::map<IndexRange, Entry> IndexRangeMap;
     IndexRangeMap mIndexRangeCache;
+
+    size_t mMaxEntries;
+    unsigned int mPrioritySeed;
+    Entry *mTreeRoot;
+    mutable const Entry *mLRUHead;
+    mutable const Entry *mLRUTail;
+
+    // One summary per index type, so that a buffer drawn with several types is not re-summarized
+    // whenever the type changes.
+    static const size_t IndexTypeCount = 3;
+    mutable IndexRangeSummary mSummaries[IndexTypeCount];
 };
 
 }
@@ -0,0 +1,205 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// IndexRangeSummary.cpp: Implements the rx::IndexRangeSummary class, a segment tree of per-block
+// index ranges used to answer range queries over an index buffer without rescanning it.
+
+#include "libANGLE/renderer/IndexRangeSummary.h"
+#include "libANGLE/renderer/IndexRangeCache.h"
+#include "libANGLE/formatutils.h"
+
+#include "common/debug.h"
+
+#include <algorithm>
+
+namespace rx
+{
+
+namespace
+{
+
+// Identity element for combining ranges, used for padding leaves. It is built field by field
+// because the Range constructor rejects start > end.
+RangeUI MakeEmptyRange()
+{
+    RangeUI range;
+    range.start = std::numeric_limits<unsigned int>::max();
+    range.end = 0;
+    return range;
+}
+
+RangeUI CombineRanges(const RangeUI &a, const RangeUI &b)
+{
+    RangeUI range;
+    range.start = std::min(a.start, b.start);
+    range.end = std::max(a.end, b.end);
+    return range;
+}
+
+}
+
+const size_t IndexRangeSummary::BlockSize;
+
+IndexRangeSummary::IndexRangeSummary()
+    : mType(GL_NONE),
+      mTypeBytes(0),
+      mIndexCount(0),
+      mLeafCount(0),
+      mDirtyBegin(0),
+      mDirtyEnd(0)
+{
+}
+
+void IndexRangeSummary::build(GLenum type, const uint8_t *data, size_t dataSize)
+{
+    mType = type;
+    mTypeBytes = gl::GetTypeInfo(type).bytes;
+    mIndexCount = dataSize / mTypeBytes;
+
+    size_t blockCount = (mIndexCount + BlockSize - 1) / BlockSize;
+    mLeafCount = 1;
+    while (mLeafCount < blockCount)
+    {
+        mLeafCount *= 2;
+    }
+
+    mTree.assign(mLeafCount * 2, MakeEmptyRange());
+
+    mDirtyBegin = 0;
+    mDirtyEnd = blockCount;
+    refreshDirtyBlocks(data);
+}
+
+void IndexRangeSummary::reset()
+{
+    mType = GL_NONE;
+    mTypeBytes = 0;
+    mIndexCount = 0;
+    mLeafCount = 0;
+    mTree.clear();
+    mDirtyBegin = 0;
+    mDirtyEnd = 0;
+}
+
+void IndexRangeSummary::invalidate(size_t byteOffset, size_t byteSize)
+{
+    if (mType == GL_NONE || byteSize == 0)
+    {
+        return;
+    }
+
+    size_t blockBytes = BlockSize * mTypeBytes;
+    size_t blockCount = (mIndexCount + BlockSize - 1) / BlockSize;
+
+    size_t begin = byteOffset / blockBytes;
+    size_t end = std::min((byteOffset + byteSize + blockBytes - 1) / blockBytes, blockCount);
+    if (begin >= end)
+    {
+        return;
+    }
+
+    if (mDirtyBegin == mDirtyEnd)
+    {
+        mDirtyBegin = begin;
+        mDirtyEnd = end;
+    }
+    else
+    {
+        mDirtyBegin = std::min(mDirtyBegin, begin);
+        mDirtyEnd = std::max(mDirtyEnd, end);
+    }
+}
+
+RangeUI IndexRangeSummary::query(const uint8_t *data, size_t firstIndex, size_t count)
+{
+    ASSERT(mType != GL_NONE);
+    ASSERT(count > 0 && firstIndex + count <= mIndexCount);
+
+    refreshDirtyBlocks(data);
+
+    size_t lastIndex = firstIndex + count;
+    size_t firstFullBlock = (firstIndex + BlockSize - 1) / BlockSize;
+    size_t lastFullBlock = lastIndex / BlockSize;
+
+    if (firstFullBlock >= lastFullBlock)
+    {
+        return IndexRangeCache::ComputeRange(mType, data + firstIndex * mTypeBytes,
+                                             static_cast<GLsizei>(count), false);
+    }
+
+    RangeUI result = MakeEmptyRange();
+
+    // Partial blocks at either end are scanned directly.
+    size_t headEnd = firstFullBlock * BlockSize;
+    if (firstIndex < headEnd)
+    {
+        result = CombineRanges(result, IndexRangeCache::ComputeRange(mType, data + firstIndex * mTypeBytes,
+                                                                     static_cast<GLsizei>(headEnd - firstIndex), false));
+    }
+
+    size_t tailStart = lastFullBlock * BlockSize;
+    if (tailStart < lastIndex)
+    {
+        result = CombineRanges(result, IndexRangeCache::ComputeRange(mType, data + tailStart * mTypeBytes,
+                                                                     static_cast<GLsizei>(lastIndex - tailStart), false));
+    }
+
+    // Bottom-up walk over the full blocks [firstFullBlock, lastFullBlock).
+    size_t left = firstFullBlock + mLeafCount;
+    size_t right = lastFullBlock + mLeafCount;
+    while (left < right)
+    {
+        if (left & 1)
+        {
+            result = CombineRanges(result, mTree[left++]);
+        }
+        if (right & 1)
+        {
+            result = CombineRanges(result, mTree[--right]);
+        }
+        left /= 2;
+        right /= 2;
+    }
+
+    return result;
+}
+
+void IndexRangeSummary::refreshDirtyBlocks(const uint8_t *data)
+{
+    if (mDirtyBegin == mDirtyEnd)
+    {
+        return;
+    }
+
+    for (size_t block = mDirtyBegin; block < mDirtyEnd; block++)
+    {
+        mTree[mLeafCount + block] = computeBlockRange(data, block);
+    }
+
+    size_t begin = (mLeafCount + mDirtyBegin) / 2;
+    size_t end = (mLeafCount + mDirtyEnd - 1) / 2;
+    while (begin > 0)
+    {
+        for (size_t node = begin; node <= end; node++)
+        {
+            mTree[node] = CombineRanges(mTree[node * 2], mTree[node * 2 + 1]);
+        }
+        begin /= 2;
+        end /= 2;
+    }
+
+    mDirtyBegin = 0;
+    mDirtyEnd = 0;
+}
+
+RangeUI IndexRangeSummary::computeBlockRange(const uint8_t *data, size_t block) const
+{
+    size_t first = block * BlockSize;
+    size_t count = std::min(BlockSize, mIndexCount - first);
+    return IndexRangeCache::ComputeRange(mType, data + first * mTypeBytes, static_cast<GLsizei>(count), false);
+}
+
+}
@@ -0,0 +1,61 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// IndexRangeSummary.h: Defines the rx::IndexRangeSummary class, a segment tree of per-block
+// index ranges used to answer range queries over an index buffer without rescanning it.
+
+#ifndef LIBANGLE_RENDERER_INDEXRANGESUMMARY_H_
+#define LIBANGLE_RENDERER_INDEXRANGESUMMARY_H_
+
+#include "common/angleutils.h"
+#include "common/mathutil.h"
+
+#include "angle_gl.h"
+
+#include <vector>
+
+namespace rx
+{
+
+class IndexRangeSummary
+{
+  public:
+    IndexRangeSummary();
+
+    // Number of indices summarized by each leaf of the tree.
+    static const size_t BlockSize = 256;
+
+    bool isBuilt(GLenum type) const { return mType == type; }
+
+    // Summarizes the whole of |data| interpreted as indices of |type|.
+    void build(GLenum type, const uint8_t *data, size_t dataSize);
+    void reset();
+
+    // Marks the blocks touching the given bytes for recomputation on the next query.
+    void invalidate(size_t byteOffset, size_t byteSize);
+
+    // |data| must be the same storage that was summarized, with any invalidated bytes updated.
+    RangeUI query(const uint8_t *data, size_t firstIndex, size_t count);
+
+  private:
+    void refreshDirtyBlocks(const uint8_t *data);
+    RangeUI computeBlockRange(const uint8_t *data, size_t block) const;
+
+    GLenum mType;
+    size_t mTypeBytes;
+    size_t mIndexCount;
+    size_t mLeafCount;
+
+    // Implicit binary tree: node i has children 2i and 2i+1, leaves start at mLeafCount.
+    std::vector<RangeUI> mTree;
+
+    size_t mDirtyBegin;
+    size_t mDirtyEnd;
+};
+
+}
+
+#endif // LIBANGLE_RENDERER_INDEXRANGESUMMARY_H_
@@ -67,7 +67,17 @@ class Renderer
                                  GLint first, GLsizei count, GLsizei instances) = 0;
     virtual gl::Error drawElements(const gl::Data &data, GLenum mode, GLsizei count, GLenum type,
                                    const GLvoid *indices, GLsizei instances,
-                                   const RangeUI &indexRange) = 0;
+                                   const DrawIndexRange &indexRange) = 0;
+
+    // Draw batches of drawCount draws that share all state but their vertices, validated as one
+    // command. instanceCounts is NULL for batches of non-instanced draws.
+    virtual gl::Error multiDrawArrays(const gl::Data &data, GLenum mode, const GLint *firsts,
+                                      const GLsizei *counts, const GLsizei *instanceCounts,
+                                      GLsizei drawCount) = 0;
+    virtual gl::Error multiDrawElements(const gl::Data &data, GLenum mode, const GLsizei *counts,
+                                        GLenum type, const GLvoid *const *indices,
+                                        const GLsizei *instanceCounts, const DrawIndexRange *indexRanges,
+                                        GLsizei drawCount) = 0;
 
     // Shader creation
     virtual CompilerImpl *createCompiler(const gl::Data &data) = 0;
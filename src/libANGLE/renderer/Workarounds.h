@@ -29,7 +29,8 @@ struct Workarounds
         : mrtPerfWorkaround(false),
           setDataFasterThanImageUpload(false),
           zeroMaxLodWorkaround(false),
-          useInstancedPointSpriteEmulation(false)
+          useInstancedPointSpriteEmulation(false),
+          asyncImageLoads(false)
     {}
 
     bool mrtPerfWorkaround;
@@ -47,6 +48,10 @@ struct Workarounds
     // To work around this, D3D11 FL9_3 has to use a different pointsprite
     // emulation that is implemented using instanced quads.
     bool useInstancedPointSpriteEmulation;
+
+    // Large texture uploads can copy the client data and convert it into the staging image on worker
+    // threads. The GL thread only waits for the conversion when the image is next used.
+    bool asyncImageLoads;
 };
 
 }
@@ -14,12 +14,20 @@
 namespace rx
 {
 
+namespace
+{
+    // Bounds the number of converted copies of a buffer, which are empty until first used and so
+    // don't count against the memory budget until then
+    enum { MAX_STATIC_VERTEX_BUFFERS = 100 };
+}
+
 unsigned int BufferD3D::mNextSerial = 1;
 
 BufferD3D::BufferD3D()
     : BufferImpl(),
-      mStaticIndexBuffer(NULL),
-      mUseStaticBuffers(false)
+      mUseStaticBuffers(false),
+      mStaticVertexBufferCache(MAX_STATIC_VERTEX_BUFFERS),
+      mStaticIndexBuffer(NULL)
 {
     updateSerial();
 }
@@ -28,8 +36,12 @@ BufferD3D::~BufferD3D()
 {
     SafeDelete(mStaticIndexBuffer);
 
-    // Clean up the static buffers for each attribute too.
-    for (StaticBufferIteratorType i = mStaticVertexBufferForAttributeMap.begin(); i != mStaticVertexBufferForAttributeMap.end(); i++)
+    for (TranslatedIndexBufferMap::iterator i = mStaticRestartIndexBuffers.begin(); i != mStaticRestartIndexBuffers.end(); i++)
+    {
+        SafeDelete(i->second);
+    }
+
+    for (TranslatedIndexBufferMap::iterator i = mStaticPrimitiveIndexBuffers.begin(); i != mStaticPrimitiveIndexBuffers.end(); i++)
     {
         SafeDelete(i->second);
     }
@@ -46,22 +58,13 @@ void BufferD3D::updateSerial()
     mSerial = mNextSerial++;
 }
 
-StaticVertexBufferInterface *BufferD3D::findStaticVertexBufferForAttribute(const gl::VertexAttribute &attrib)
+StaticVertexBufferInterface *BufferD3D::findStaticVertexBufferForAttribute(const gl::VertexAttribute &attrib) const
 {
-    AttribElement element = CreateAttribElementFromAttrib(attrib);
-
-    StaticBufferIteratorType mapElement = mStaticVertexBufferForAttributeMap.find(element);
-
-    // If we've already created a StaticVertexBufferInterface for this attribute, then we return it
-    if (mapElement != mStaticVertexBufferForAttributeMap.end())
-    {
-        return mapElement->second;
-    }
-
-    return NULL;
+    return mStaticVertexBufferCache.find(CreateAttribElementFromAttrib(attrib));
 }
 
-StaticVertexBufferInterface *BufferD3D::getStaticVertexBufferForAttribute(const gl::VertexAttribute &attrib)
+StaticVertexBufferInterface *BufferD3D::getStaticVertexBufferForAttribute(const gl::VertexAttribute &attrib,
+                                                                          unsigned int drawSerial)
 {
     if (!mUseStaticBuffers)
         return NULL;
@@ -69,41 +72,39 @@ StaticVertexBufferInterface *BufferD3D::getStaticVertexBufferForAttribute(const
     if (attrib.type == GL_NONE)
         return NULL;
 
-    StaticVertexBufferInterface *bufferForAttribute = findStaticVertexBufferForAttribute(attrib);
+    StaticVertexBufferInterface *bufferForAttribute = mStaticVertexBufferCache.lookup(CreateAttribElementFromAttrib(attrib),
+                                                                                      drawSerial);
     if (bufferForAttribute != NULL)
     {
         return bufferForAttribute;
     }
 
-    // If we have too many static buffers (using up a lot of memory) then we should revert to streaming buffers.
-    // The exact memory usage of the static buffers is difficult to measure.
-    // Each static vertex buffer will say they are of size 0 until they are first used (which is when they are populated with data)
-    // We therefore use two metrics to try to limit the memory usage of these static buffers:
-    //      - If some of the static vertex buffers are populated with data, then we sum up their total size, and we don't create another
-    //        static buffer if their total size is 3x larger than the original buffer's size. "3x" could be made lower to save memory.
-    //      - We also set a high upper bound for the number of static vertex buffers that each buffer can create, to cover the case when
-    //        a lot of static buffers are created before many of them are populated with data.
-    if (mStaticVertexBufferForAttributeMap.size() <= 100)
-    {
-        size_t totalStaticBufferSize = 0;
-        for (StaticBufferIteratorType i = mStaticVertexBufferForAttributeMap.begin(); i != mStaticVertexBufferForAttributeMap.end(); i++)
-        {
-            // ASSERT against overflow
-            ASSERT(totalStaticBufferSize + i->second->getBufferSize() >= totalStaticBufferSize);
-            totalStaticBufferSize += i->second->getBufferSize();
-        }
+    // Only make a copy if it fits, so that a layout seen once doesn't push out the ones in use;
+    // promoteStaticVertexUsageForAttrib evicts for layouts that keep being streamed
+    return createStaticVertexBufferForAttribute(attrib, false, drawSerial);
+}
 
-        if (totalStaticBufferSize <= 3 * getSize())
-        {
-            AttribElement element = CreateAttribElementFromAttrib(attrib);
-            bufferForAttribute = new StaticVertexBufferInterface(getRenderer());
-            mStaticVertexBufferForAttributeMap[element] = bufferForAttribute;
-        }
+StaticVertexBufferInterface *BufferD3D::createStaticVertexBufferForAttribute(const gl::VertexAttribute &attrib,
+                                                                             bool allowEviction,
+                                                                             unsigned int drawSerial)
+{
+    // The converted copies are limited to 3x the size of the buffer. They are empty until first
+    // used, so the entry count is bounded as well for copies made before any is populated.
+    if (!mStaticVertexBufferCache.makeRoom(3 * getSize(), allowEviction, drawSerial))
+    {
+        return NULL;
     }
 
+    StaticVertexBufferInterface *bufferForAttribute = new StaticVertexBufferInterface(getRenderer());
+    mStaticVertexBufferCache.insert(CreateAttribElementFromAttrib(attrib), bufferForAttribute, drawSerial);
     return bufferForAttribute;
 }
 
+const StaticBufferCacheStats &BufferD3D::getStaticVertexBufferCacheStats() const
+{
+    return mStaticVertexBufferCache.getStats();
+}
+
 void BufferD3D::enableStaticData()
 {
     mUseStaticBuffers = true;
@@ -114,6 +115,65 @@ void BufferD3D::enableStaticData()
     }
 }
 
+StaticIndexBufferInterface *BufferD3D::getStaticRestartIndexBuffer(GLenum mode, GLenum type, unsigned int offset,
+                                                                    GLsizei count)
+{
+    TranslatedIndexElement element = { mode, type, offset, count };
+    return getStaticTranslatedIndexBuffer(&mStaticRestartIndexBuffers, element);
+}
+
+StaticIndexBufferInterface *BufferD3D::getStaticPrimitiveIndexBuffer(GLenum mode, GLenum type, unsigned int offset,
+                                                                      GLsizei count)
+{
+    TranslatedIndexElement element = { mode, type, offset, count };
+    return getStaticTranslatedIndexBuffer(&mStaticPrimitiveIndexBuffers, element);
+}
+
+StaticIndexBufferInterface *BufferD3D::getStaticTranslatedIndexBuffer(TranslatedIndexBufferMap *translations,
+                                                                       const TranslatedIndexElement &element)
+{
+    // Only buffers that already qualified for static index data keep their translations.
+    if (!mStaticIndexBuffer)
+    {
+        return NULL;
+    }
+
+    TranslatedIndexBufferMap::iterator existing = translations->find(element);
+    if (existing != translations->end())
+    {
+        return existing->second;
+    }
+
+    // Bound the memory used by translations the same way as static vertex buffers.
+    if (mStaticRestartIndexBuffers.size() + mStaticPrimitiveIndexBuffers.size() >= 100)
+    {
+        return NULL;
+    }
+
+    if (getStaticTranslatedIndexDataSize() > 3 * getSize())
+    {
+        return NULL;
+    }
+
+    StaticIndexBufferInterface *translatedBuffer = new StaticIndexBufferInterface(getRenderer());
+    (*translations)[element] = translatedBuffer;
+    return translatedBuffer;
+}
+
+size_t BufferD3D::getStaticTranslatedIndexDataSize() const
+{
+    size_t totalStaticBufferSize = 0;
+    for (TranslatedIndexBufferMap::const_iterator i = mStaticRestartIndexBuffers.begin(); i != mStaticRestartIndexBuffers.end(); i++)
+    {
+        totalStaticBufferSize += i->second->getBufferSize();
+    }
+    for (TranslatedIndexBufferMap::const_iterator i = mStaticPrimitiveIndexBuffers.begin(); i != mStaticPrimitiveIndexBuffers.end(); i++)
+    {
+        totalStaticBufferSize += i->second->getBufferSize();
+    }
+    return totalStaticBufferSize;
+}
+
 void BufferD3D::invalidateStaticIndexData()
 {
     if (mStaticIndexBuffer && mStaticIndexBuffer->getBufferSize() != 0)
@@ -121,6 +181,18 @@ void BufferD3D::invalidateStaticIndexData()
         SafeDelete(mStaticIndexBuffer);
     }
 
+    for (TranslatedIndexBufferMap::iterator i = mStaticRestartIndexBuffers.begin(); i != mStaticRestartIndexBuffers.end(); i++)
+    {
+        SafeDelete(i->second);
+    }
+    mStaticRestartIndexBuffers.clear();
+
+    for (TranslatedIndexBufferMap::iterator i = mStaticPrimitiveIndexBuffers.begin(); i != mStaticPrimitiveIndexBuffers.end(); i++)
+    {
+        SafeDelete(i->second);
+    }
+    mStaticPrimitiveIndexBuffers.clear();
+
     mUnmodifiedIndexDataUse = 0;
 }
 
@@ -138,8 +210,21 @@ void BufferD3D::promoteStaticIndexUsage(int dataSize)
     }
 }
 
-void BufferD3D::promoteStaticVertexUsageForAttrib(const gl::VertexAttribute &attrib, int dataSize)
+bool BufferD3D::TranslatedIndexElement::operator<(const TranslatedIndexElement &other) const
+{
+    if (mode != other.mode) return mode < other.mode;
+    if (type != other.type) return type < other.type;
+    if (offset != other.offset) return offset < other.offset;
+    return count < other.count;
+}
+
+void BufferD3D::promoteStaticVertexUsageForAttrib(const gl::VertexAttribute &attrib, int dataSize, unsigned int drawSerial)
 {
+    if (!mUseStaticBuffers || attrib.type == GL_NONE)
+    {
+        return;
+    }
+
     StaticVertexBufferInterface* bufferForAttribute = findStaticVertexBufferForAttribute(attrib);
 
     if (bufferForAttribute == NULL)
@@ -153,9 +238,13 @@ void BufferD3D::promoteStaticVertexUsageForAttrib(const gl::VertexAttribute &att
 
         mUnmodifiedVertexDataUseMap[element] += dataSize;
 
-        if (mUnmodifiedVertexDataUseMap[element] > 3 * getSize())
+        // A layout that has streamed more than a few times the buffer's size is worth converting,
+        // even at the cost of evicting less recently used copies. Having to earn it again after
+        // each eviction keeps layouts that alternate from converting the buffer on every draw.
+        if (mUnmodifiedVertexDataUseMap[element] > 3 * getSize() &&
+            createStaticVertexBufferForAttribute(attrib, true, drawSerial) != NULL)
         {
-            getStaticVertexBufferForAttribute(attrib);
+            mUnmodifiedVertexDataUseMap.erase(element);
         }
     }
 }
@@ -10,6 +10,7 @@
 #define LIBANGLE_RENDERER_D3D_BUFFERD3D_H_
 
 #include "libANGLE/renderer/BufferImpl.h"
+#include "libANGLE/renderer/d3d/StaticBufferCache.h"
 #include "libANGLE/angletypes.h"
 
 #include <stdint.h>
@@ -33,13 +34,21 @@ class BufferD3D : public BufferImpl
     virtual bool supportsDirectVertexBindingForAttrib(const gl::VertexAttribute &attrib) = 0;
     virtual RendererD3D *getRenderer() = 0;
 
-    StaticVertexBufferInterface *getStaticVertexBufferForAttribute(const gl::VertexAttribute &attrib);
+    // Returns the converted copy of this buffer for attrib, making one if the cache has room, and
+    // counts the lookup as a hit or a miss. Copies used at drawSerial are kept for that draw.
+    StaticVertexBufferInterface *getStaticVertexBufferForAttribute(const gl::VertexAttribute &attrib,
+                                                                   unsigned int drawSerial);
+    StaticVertexBufferInterface *findStaticVertexBufferForAttribute(const gl::VertexAttribute &attrib) const;
     StaticIndexBufferInterface *getStaticIndexBuffer() { return mStaticIndexBuffer; }
+    StaticIndexBufferInterface *getStaticRestartIndexBuffer(GLenum mode, GLenum type, unsigned int offset, GLsizei count);
+    StaticIndexBufferInterface *getStaticPrimitiveIndexBuffer(GLenum mode, GLenum type, unsigned int offset, GLsizei count);
 
     void enableStaticData();
     void invalidateStaticIndexData();
     void promoteStaticIndexUsage(int dataSize);
-    void promoteStaticVertexUsageForAttrib(const gl::VertexAttribute &attrib, int dataSize);
+    void promoteStaticVertexUsageForAttrib(const gl::VertexAttribute &attrib, int dataSize, unsigned int drawSerial);
+
+    const StaticBufferCacheStats &getStaticVertexBufferCacheStats() const;
 
   protected:
     unsigned int mSerial;
@@ -47,8 +56,8 @@ class BufferD3D : public BufferImpl
 
     void updateSerial();
 
-    StaticVertexBufferInterface *findStaticVertexBufferForAttribute(const gl::VertexAttribute &attrib);
-
+    // The converted data depends on the format, stride and offset within a vertex, but not on the
+    // divisor or the draw range, since the whole buffer is converted
     struct AttribElement
     {
         GLenum type;
@@ -70,14 +79,39 @@ class BufferD3D : public BufferImpl
 
     static AttribElement CreateAttribElementFromAttrib(const gl::VertexAttribute &attrib);
 
+    StaticVertexBufferInterface *createStaticVertexBufferForAttribute(const gl::VertexAttribute &attrib,
+                                                                      bool allowEviction,
+                                                                      unsigned int drawSerial);
+
     bool mUseStaticBuffers;
-    typedef std::map<AttribElement, StaticVertexBufferInterface*>::iterator StaticBufferIteratorType;
-    std::map<AttribElement, StaticVertexBufferInterface*> mStaticVertexBufferForAttributeMap;
+    StaticBufferCache<AttribElement, StaticVertexBufferInterface> mStaticVertexBufferCache;
     std::map<AttribElement, unsigned int> mUnmodifiedVertexDataUseMap;
 
     StaticIndexBufferInterface *mStaticIndexBuffer;
     unsigned int mUnmodifiedIndexDataUse;
 
+    // Index data translated for draws the renderer can't do natively, one buffer per draw range.
+    struct TranslatedIndexElement
+    {
+        GLenum mode;
+        GLenum type;
+        unsigned int offset;
+        GLsizei count;
+
+        bool operator<(const TranslatedIndexElement &other) const;
+    };
+
+    typedef std::map<TranslatedIndexElement, StaticIndexBufferInterface*> TranslatedIndexBufferMap;
+
+    StaticIndexBufferInterface *getStaticTranslatedIndexBuffer(TranslatedIndexBufferMap *translations,
+                                                               const TranslatedIndexElement &element);
+    size_t getStaticTranslatedIndexDataSize() const;
+
+    // Lists for primitive restart emulation
+    TranslatedIndexBufferMap mStaticRestartIndexBuffers;
+    // Line strips and triangle lists drawing line loops and triangle fans
+    TranslatedIndexBufferMap mStaticPrimitiveIndexBuffers;
+
 };
 
 }
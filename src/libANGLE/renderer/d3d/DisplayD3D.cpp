@@ -150,8 +150,9 @@ egl::Error DisplayD3D::createContext(const egl::Config *config, const gl::Contex
     EGLint clientVersion = attribs.get(EGL_CONTEXT_CLIENT_VERSION, 1);
     bool notifyResets = (attribs.get(EGL_CONTEXT_OPENGL_RESET_NOTIFICATION_STRATEGY_EXT, EGL_NO_RESET_NOTIFICATION_EXT) == EGL_LOSE_CONTEXT_ON_RESET_EXT);
     bool robustAccess = (attribs.get(EGL_CONTEXT_OPENGL_ROBUST_ACCESS_EXT, EGL_FALSE) == EGL_TRUE);
+    bool coalesceDraws = (attribs.get(EGL_CONTEXT_DRAW_COALESCING_ANGLE, EGL_FALSE) == EGL_TRUE);
 
-    *outContext = new gl::Context(config, clientVersion, shareContext, mRenderer, notifyResets, robustAccess);
+    *outContext = new gl::Context(config, clientVersion, shareContext, mRenderer, notifyResets, robustAccess, coalesceDraws);
     return egl::Error(EGL_SUCCESS);
 }
 
@@ -247,6 +248,7 @@ void DisplayD3D::generateExtensions(egl::DisplayExtensions *outExtensions) const
     }
 
     outExtensions->createContext = true;
+    outExtensions->createContextDrawCoalescing = true;
 }
 
 std::string DisplayD3D::getVendorString() const
@@ -52,6 +52,14 @@ class ImageD3D
     virtual bool redefine(GLenum target, GLenum internalformat, const gl::Extents &size, bool forceRelease) = 0;
 
     virtual gl::Error loadData(const gl::Box &area, const gl::PixelUnpackState &unpack, GLenum type, const void *input) = 0;
+
+    // Like loadData, but the conversion may still be running on worker threads when this returns.
+    // It completes before the image data is next accessed.
+    virtual gl::Error loadDataAsync(const gl::Box &area, const gl::PixelUnpackState &unpack, GLenum type, const void *input)
+    {
+        return loadData(area, unpack, type, input);
+    }
+
     virtual gl::Error loadCompressedData(const gl::Box &area, const void *input) = 0;
 
     virtual gl::Error setManagedSurface2D(TextureStorage *storage, int level) { return gl::Error(GL_NO_ERROR); };
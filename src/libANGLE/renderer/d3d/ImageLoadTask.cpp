@@ -0,0 +1,126 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// ImageLoadTask.cpp: Implements the rx::ImageLoadTask class.
+
+#include "libANGLE/renderer/d3d/ImageLoadTask.h"
+
+#include "common/debug.h"
+
+#include <algorithm>
+#include <string.h>
+
+namespace rx
+{
+
+namespace
+{
+
+// Loads reading less client data than this are converted on the calling thread, where the
+// conversion costs less than copying the input and starting the workers.
+const size_t AsyncLoadMinimumBytes = 256 * 1024;
+const size_t AsyncLoadMaxThreads = 4;
+
+}
+
+ImageLoadTask::ImageLoadTask()
+    : mLoadFunction(NULL),
+      mWidth(0),
+      mHeight(0),
+      mDepth(0),
+      mInputRowPitch(0),
+      mInputDepthPitch(0),
+      mOutput(NULL),
+      mOutputRowPitch(0),
+      mOutputDepthPitch(0)
+{
+}
+
+ImageLoadTask::~ImageLoadTask()
+{
+    wait();
+}
+
+bool ImageLoadTask::ShouldRunAsync(size_t inputBytes)
+{
+    return inputBytes >= AsyncLoadMinimumBytes && std::thread::hardware_concurrency() > 1;
+}
+
+void ImageLoadTask::start(ScratchMemoryPool *scratchPool, LoadImageFunction loadFunction, size_t width, size_t height, size_t depth,
+                          const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch, size_t inputRowBytes,
+                          uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    wait();
+
+    if (width == 0 || height == 0 || depth == 0)
+    {
+        return;
+    }
+
+    // The client may reuse its memory as soon as the upload call returns, so keep a copy. The
+    // last row is only as long as its pixels, since unpack padding after it may not exist.
+    size_t inputBytes = (depth - 1) * inputDepthPitch + (height - 1) * inputRowPitch + inputRowBytes;
+    if (!scratchPool->lease(inputBytes, &mInput))
+    {
+        loadFunction(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                     output, outputRowPitch, outputDepthPitch);
+        return;
+    }
+    memcpy(mInput.data(), input, inputBytes);
+
+    mLoadFunction = loadFunction;
+    mWidth = width;
+    mHeight = height;
+    mDepth = depth;
+    mInputRowPitch = inputRowPitch;
+    mInputDepthPitch = inputDepthPitch;
+    mOutput = output;
+    mOutputRowPitch = outputRowPitch;
+    mOutputDepthPitch = outputDepthPitch;
+
+    // Rows of every slice are numbered one after the other and split into one band per worker
+    size_t rowCount = height * depth;
+    size_t threadCount = std::min<size_t>(std::min<size_t>(std::thread::hardware_concurrency(), AsyncLoadMaxThreads), rowCount);
+    threadCount = std::max<size_t>(threadCount, 1);
+
+    for (size_t thread = 0; thread < threadCount; thread++)
+    {
+        mWorkers.push_back(std::thread(LoadRows, this, rowCount * thread / threadCount,
+                                       rowCount * (thread + 1) / threadCount));
+    }
+}
+
+void ImageLoadTask::wait()
+{
+    for (size_t thread = 0; thread < mWorkers.size(); thread++)
+    {
+        mWorkers[thread].join();
+    }
+    mWorkers.clear();
+
+    mInput.release();
+    mOutput = NULL;
+}
+
+void ImageLoadTask::LoadRows(const ImageLoadTask *task, size_t firstRow, size_t lastRow)
+{
+    size_t row = firstRow;
+    while (row < lastRow)
+    {
+        size_t z = row / task->mHeight;
+        size_t y = row % task->mHeight;
+        size_t rows = std::min(task->mHeight - y, lastRow - row);
+
+        const uint8_t *input = task->mInput.data() + z * task->mInputDepthPitch + y * task->mInputRowPitch;
+        uint8_t *output = task->mOutput + z * task->mOutputDepthPitch + y * task->mOutputRowPitch;
+        task->mLoadFunction(task->mWidth, rows, 1, input, task->mInputRowPitch, task->mInputDepthPitch,
+                            output, task->mOutputRowPitch, task->mOutputDepthPitch);
+
+        row += rows;
+    }
+}
+
+}
@@ -0,0 +1,68 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// ImageLoadTask.h: Defines the rx::ImageLoadTask class, which runs a format's load function on
+// worker threads so that large texture uploads do not block the calling thread.
+
+#ifndef LIBANGLE_RENDERER_D3D_IMAGELOADTASK_H_
+#define LIBANGLE_RENDERER_D3D_IMAGELOADTASK_H_
+
+#include "libANGLE/renderer/d3d/formatutilsD3D.h"
+
+#include "common/ScratchMemoryPool.h"
+#include "common/angleutils.h"
+
+#include <thread>
+#include <vector>
+
+namespace rx
+{
+
+class ImageLoadTask
+{
+  public:
+    ImageLoadTask();
+    ~ImageLoadTask();
+
+    // Whether a load reading inputBytes of client data is large enough to be worth the copy and
+    // the worker threads.
+    static bool ShouldRunAsync(size_t inputBytes);
+
+    // Copies the input rows into memory leased from scratchPool and starts converting them into
+    // output in row bands on worker threads. inputRowBytes is the unpadded size of an input row.
+    // The output must stay valid and must not be accessed until wait() returns. If the copy can't
+    // be allocated, the load runs on the calling thread instead.
+    void start(ScratchMemoryPool *scratchPool, LoadImageFunction loadFunction, size_t width, size_t height, size_t depth,
+               const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch, size_t inputRowBytes,
+               uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch);
+
+    // Blocks until the conversion from the last call to start has finished.
+    void wait();
+
+    bool isPending() const { return !mWorkers.empty(); }
+
+  private:
+    DISALLOW_COPY_AND_ASSIGN(ImageLoadTask);
+
+    static void LoadRows(const ImageLoadTask *task, size_t firstRow, size_t lastRow);
+
+    LoadImageFunction mLoadFunction;
+    size_t mWidth;
+    size_t mHeight;
+    size_t mDepth;
+    ScratchMemoryLease mInput;
+    size_t mInputRowPitch;
+    size_t mInputDepthPitch;
+    uint8_t *mOutput;
+    size_t mOutputRowPitch;
+    size_t mOutputDepthPitch;
+
+    std::vector<std::thread> mWorkers;
+};
+
+}
+
+#endif // LIBANGLE_RENDERER_D3D_IMAGELOADTASK_H_
@@ -130,7 +130,9 @@ gl::Error IndexBufferInterface::setBufferSize(unsigned int bufferSize, GLenum in
     }
 }
 
-StreamingIndexBufferInterface::StreamingIndexBufferInterface(RendererD3D *renderer) : IndexBufferInterface(renderer, true)
+StreamingIndexBufferInterface::StreamingIndexBufferInterface(RendererD3D *renderer)
+    : IndexBufferInterface(renderer, true),
+      mRing(renderer)
 {
 }
 
@@ -140,32 +142,49 @@ StreamingIndexBufferInterface::~StreamingIndexBufferInterface()
 
 gl::Error StreamingIndexBufferInterface::reserveBufferSpace(unsigned int size, GLenum indexType)
 {
-    unsigned int curBufferSize = getBufferSize();
-    unsigned int writePos = getWritePosition();
-    if (size > curBufferSize)
+    unsigned int writePosition = 0;
+    RingReservation reservation = RING_RESERVED;
+    gl::Error error = mRing.reserve(getWritePosition(), size, &writePosition, &reservation);
+    if (error.isError())
+    {
+        return error;
+    }
+
+    if (reservation != RING_RESERVED)
     {
-        gl::Error error = setBufferSize(std::max(size, 2 * curBufferSize), indexType);
+        if (reservation == RING_NEEDS_GROWTH)
+        {
+            error = setBufferSize(std::max(size, 2 * getBufferSize()), indexType);
+        }
+        else
+        {
+            error = discard();
+        }
         if (error.isError())
         {
             return error;
         }
-        setWritePosition(0);
-    }
-    else if (writePos + size > curBufferSize || writePos + size < writePos)
-    {
-        gl::Error error = discard();
+
+        // The new or discarded buffer isn't in use, so the space is at its start
+        mRing.reset(getBufferSize());
+        error = mRing.reserve(0, size, &writePosition, &reservation);
         if (error.isError())
         {
             return error;
         }
-        setWritePosition(0);
+        ASSERT(reservation == RING_RESERVED);
     }
 
+    setWritePosition(writePosition);
+
     return gl::Error(GL_NO_ERROR);
 }
 
 
-StaticIndexBufferInterface::StaticIndexBufferInterface(RendererD3D *renderer) : IndexBufferInterface(renderer, false)
+StaticIndexBufferInterface::StaticIndexBufferInterface(RendererD3D *renderer)
+    : IndexBufferInterface(renderer, false),
+      mTranslated(false),
+      mTranslatedCount(0)
 {
 }
 
@@ -196,4 +215,10 @@ IndexRangeCache *StaticIndexBufferInterface::getIndexRangeCache()
     return &mIndexRangeCache;
 }
 
+void StaticIndexBufferInterface::setTranslatedCount(GLsizei count)
+{
+    mTranslated = true;
+    mTranslatedCount = count;
+}
+
 }
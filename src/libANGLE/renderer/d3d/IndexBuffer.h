@@ -13,6 +13,7 @@
 #include "common/angleutils.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/renderer/IndexRangeCache.h"
+#include "libANGLE/renderer/d3d/RingBufferAllocator.h"
 
 namespace rx
 {
@@ -91,6 +92,9 @@ class StreamingIndexBufferInterface : public IndexBufferInterface
     ~StreamingIndexBufferInterface();
 
     virtual gl::Error reserveBufferSpace(unsigned int size, GLenum indexType);
+
+  private:
+    StreamingBufferRing mRing;
 };
 
 class StaticIndexBufferInterface : public IndexBufferInterface
@@ -103,8 +107,17 @@ class StaticIndexBufferInterface : public IndexBufferInterface
 
     IndexRangeCache *getIndexRangeCache();
 
+    // Buffers holding a translation of one draw's indices record how many indices it produced,
+    // which may be none, so that the translation is looked up rather than redone.
+    bool isTranslated() const { return mTranslated; }
+    GLsizei getTranslatedCount() const { return mTranslatedCount; }
+    void setTranslatedCount(GLsizei count);
+
   private:
     IndexRangeCache mIndexRangeCache;
+
+    bool mTranslated;
+    GLsizei mTranslatedCount;
 };
 
 }
@@ -9,6 +9,7 @@
 
 #include "libANGLE/renderer/d3d/IndexDataManager.h"
 #include "libANGLE/renderer/d3d/BufferD3D.h"
+#include "libANGLE/renderer/d3d/convertindices.h"
 #include "libANGLE/renderer/d3d/IndexBuffer.h"
 #include "libANGLE/renderer/d3d/RendererD3D.h"
 #include "libANGLE/Buffer.h"
@@ -17,43 +18,136 @@
 namespace rx
 {
 
-static void ConvertIndices(GLenum sourceType, GLenum destinationType, const void *input, GLsizei count, void *output)
+static GLenum GetPrimitiveRestartListMode(GLenum mode)
 {
-    if (sourceType == GL_UNSIGNED_BYTE)
+    switch (mode)
     {
-        ASSERT(destinationType == GL_UNSIGNED_SHORT);
-        const GLubyte *in = static_cast<const GLubyte*>(input);
-        GLushort *out = static_cast<GLushort*>(output);
+      case GL_POINTS:
+        return GL_POINTS;
+      case GL_LINES:
+      case GL_LINE_LOOP:
+      case GL_LINE_STRIP:
+        return GL_LINES;
+      case GL_TRIANGLES:
+      case GL_TRIANGLE_STRIP:
+      case GL_TRIANGLE_FAN:
+        return GL_TRIANGLES;
+      default:
+        UNREACHABLE();
+        return GL_NONE;
+    }
+}
 
-        for (GLsizei i = 0; i < count; i++)
+// Writes the independent primitives of one restart-free run of indices and returns how many
+// indices they take. Nothing is written when |out| is NULL.
+template <class InT, class OutT>
+static GLsizei TranslatePrimitiveRestartSegment(GLenum mode, const InT *in, GLsizei count, OutT *out)
+{
+    switch (mode)
+    {
+      case GL_POINTS:
+      case GL_LINES:
+      case GL_TRIANGLES:
         {
-            out[i] = in[i];
+            // Incomplete trailing primitives are dropped.
+            GLsizei verticesPerPrimitive = (mode == GL_POINTS) ? 1 : ((mode == GL_LINES) ? 2 : 3);
+            GLsizei outCount = count - (count % verticesPerPrimitive);
+            for (GLsizei i = 0; out && i < outCount; i++)
+            {
+                out[i] = in[i];
+            }
+            return outCount;
         }
-    }
-    else if (sourceType == GL_UNSIGNED_INT)
-    {
-        ASSERT(destinationType == GL_UNSIGNED_INT);
-        memcpy(output, input, count * sizeof(GLuint));
-    }
-    else if (sourceType == GL_UNSIGNED_SHORT)
-    {
-        if (destinationType == GL_UNSIGNED_SHORT)
+
+      case GL_LINE_STRIP:
+      case GL_LINE_LOOP:
         {
-            memcpy(output, input, count * sizeof(GLushort));
+            if (count < 2)
+            {
+                return 0;
+            }
+
+            GLsizei lineCount = (mode == GL_LINE_LOOP) ? count : count - 1;
+            for (GLsizei i = 0; out && i < lineCount; i++)
+            {
+                out[i * 2 + 0] = in[i];
+                out[i * 2 + 1] = in[(i + 1) % count];
+            }
+            return lineCount * 2;
         }
-        else if (destinationType == GL_UNSIGNED_INT)
+
+      case GL_TRIANGLE_STRIP:
+      case GL_TRIANGLE_FAN:
         {
-            const GLushort *in = static_cast<const GLushort*>(input);
-            GLuint *out = static_cast<GLuint*>(output);
+            if (count < 3)
+            {
+                return 0;
+            }
 
-            for (GLsizei i = 0; i < count; i++)
+            GLsizei triangleCount = count - 2;
+            for (GLsizei i = 0; out && i < triangleCount; i++)
             {
-                out[i] = in[i];
+                if (mode == GL_TRIANGLE_FAN)
+                {
+                    out[i * 3 + 0] = in[0];
+                    out[i * 3 + 1] = in[i + 1];
+                }
+                else
+                {
+                    // Every other strip triangle is flipped to keep a consistent winding.
+                    out[i * 3 + 0] = in[i + (i % 2)];
+                    out[i * 3 + 1] = in[i + 1 - (i % 2)];
+                }
+                out[i * 3 + 2] = in[i + 2];
             }
+            return triangleCount * 3;
+        }
+
+      default:
+        UNREACHABLE();
+        return 0;
+    }
+}
+
+template <class InT, class OutT>
+static GLsizei TranslatePrimitiveRestartIndices(GLenum mode, const InT *in, GLsizei count, OutT *out)
+{
+    const InT restartIndex = std::numeric_limits<InT>::max();
+
+    GLsizei outCount = 0;
+    GLsizei segmentStart = 0;
+    for (GLsizei i = 0; i <= count; i++)
+    {
+        if (i == count || in[i] == restartIndex)
+        {
+            outCount += TranslatePrimitiveRestartSegment(mode, in + segmentStart, i - segmentStart,
+                                                         out ? out + outCount : NULL);
+            segmentStart = i + 1;
         }
-        else UNREACHABLE();
     }
-    else UNREACHABLE();
+
+    return outCount;
+}
+
+// Returns the number of indices written, or needed when |output| is NULL.
+static GLsizei TranslatePrimitiveRestartIndices(GLenum mode, GLenum sourceType, const void *input, GLsizei count,
+                                                void *output)
+{
+    switch (sourceType)
+    {
+      case GL_UNSIGNED_BYTE:
+        return TranslatePrimitiveRestartIndices(mode, static_cast<const GLubyte*>(input), count,
+                                                static_cast<GLushort*>(output));
+      case GL_UNSIGNED_SHORT:
+        return TranslatePrimitiveRestartIndices(mode, static_cast<const GLushort*>(input), count,
+                                                static_cast<GLushort*>(output));
+      case GL_UNSIGNED_INT:
+        return TranslatePrimitiveRestartIndices(mode, static_cast<const GLuint*>(input), count,
+                                                static_cast<GLuint*>(output));
+      default:
+        UNREACHABLE();
+        return 0;
+    }
 }
 
 IndexDataManager::IndexDataManager(RendererD3D *renderer)
@@ -69,8 +163,17 @@ IndexDataManager::~IndexDataManager()
     SafeDelete(mStreamingBufferInt);
 }
 
-gl::Error IndexDataManager::prepareIndexData(GLenum type, GLsizei count, gl::Buffer *buffer, const GLvoid *indices, TranslatedIndexData *translated)
+gl::Error IndexDataManager::prepareIndexData(GLenum type, GLsizei count, gl::Buffer *buffer, const GLvoid *indices,
+                                             GLenum mode, bool primitiveRestartEnabled, TranslatedIndexData *translated)
 {
+    if (primitiveRestartEnabled && !usesNativePrimitiveRestart(mode))
+    {
+        return preparePrimitiveRestartIndexData(type, count, buffer, indices, mode, translated);
+    }
+
+    translated->mode = mode;
+    translated->count = count;
+
     const gl::Type &typeInfo = gl::GetTypeInfo(type);
 
     GLenum destinationIndexType = (type == GL_UNSIGNED_INT) ? GL_UNSIGNED_INT : GL_UNSIGNED_SHORT;
@@ -107,6 +210,12 @@ gl::Error IndexDataManager::prepareIndexData(GLenum type, GLsizei count, gl::Buf
     }
 
     StaticIndexBufferInterface *staticBuffer = storage ? storage->getStaticIndexBuffer() : NULL;
+
+    // The static buffer holds byte indices widened without restart values, leave it untouched.
+    if (primitiveRestartEnabled && type == GL_UNSIGNED_BYTE)
+    {
+        staticBuffer = NULL;
+    }
     IndexBufferInterface *indexBuffer = NULL;
     bool directStorage = alignedOffset && storage && storage->supportsDirectIndexBinding() &&
                          destinationIndexType == type;
@@ -114,27 +223,35 @@ gl::Error IndexDataManager::prepareIndexData(GLenum type, GLsizei count, gl::Buf
 
     if (directStorage)
     {
+        ASSERT(translated->indexRangeResolved);
         streamOffset = offset;
 
-        if (!buffer->getIndexRangeCache()->findRange(type, offset, count, NULL, NULL))
+        if (!buffer->getIndexRangeCache()->findRange(type, offset, count, primitiveRestartEnabled, NULL, NULL))
         {
-            buffer->getIndexRangeCache()->addRange(type, offset, count, translated->indexRange, offset);
+            buffer->getIndexRangeCache()->addRange(type, offset, count, primitiveRestartEnabled,
+                                                   translated->indexRange, offset);
         }
     }
     else if (staticBuffer && staticBuffer->getBufferSize() != 0 && staticBuffer->getIndexType() == type && alignedOffset)
     {
+        ASSERT(translated->indexRangeResolved);
         indexBuffer = staticBuffer;
 
-        if (!staticBuffer->getIndexRangeCache()->findRange(type, offset, count, NULL, &streamOffset))
+        if (!staticBuffer->getIndexRangeCache()->findRange(type, offset, count, primitiveRestartEnabled, NULL,
+                                                           &streamOffset))
         {
             streamOffset = (offset / typeInfo.bytes) * gl::GetTypeInfo(destinationIndexType).bytes;
-            staticBuffer->getIndexRangeCache()->addRange(type, offset, count, translated->indexRange, streamOffset);
+            staticBuffer->getIndexRangeCache()->addRange(type, offset, count, primitiveRestartEnabled,
+                                                         translated->indexRange, streamOffset);
         }
     }
 
     // Avoid D3D11's primitive restart index value
     // see http://msdn.microsoft.com/en-us/library/windows/desktop/bb205124(v=vs.85).aspx
-    if (translated->indexRange.end == 0xFFFF && type == GL_UNSIGNED_SHORT && mRenderer->getMajorShaderModel() > 3)
+    // An unresolved range is only found by the conversion below, so those indices are widened
+    // whether or not they hold the restart value, rather than converted a second time.
+    if (!primitiveRestartEnabled && type == GL_UNSIGNED_SHORT && mRenderer->getMajorShaderModel() > 3 &&
+        (!translated->indexRangeResolved || translated->indexRange.end == 0xFFFF))
     {
         destinationIndexType = GL_UNSIGNED_INT;
         directStorage = false;
@@ -198,7 +315,8 @@ gl::Error IndexDataManager::prepareIndexData(GLenum type, GLsizei count, gl::Buf
                 return error;
             }
         }
-        ConvertIndices(type, destinationIndexType, dataPointer, convertCount, output);
+        RangeUI convertedRange = ConvertIndices(type, destinationIndexType, dataPointer, convertCount, output,
+                                                primitiveRestartEnabled);
 
         error = indexBuffer->unmapBuffer();
         if (error.isError())
@@ -206,10 +324,22 @@ gl::Error IndexDataManager::prepareIndexData(GLenum type, GLsizei count, gl::Buf
             return error;
         }
 
+        if (!translated->indexRangeResolved)
+        {
+            // Validation leaves the range of some client memory indices to this conversion
+            ASSERT(!storage);
+            translated->indexRange = convertedRange;
+            translated->indexRangeResolved = true;
+        }
+
         if (staticBuffer)
         {
             streamOffset = (offset / typeInfo.bytes) * destTypeInfo.bytes;
-            staticBuffer->getIndexRangeCache()->addRange(type, offset, count, translated->indexRange, streamOffset);
+            staticBuffer->getIndexRangeCache()->addRange(type, offset, count, primitiveRestartEnabled,
+                                                         translated->indexRange, streamOffset);
+
+            // The whole buffer was converted, so draws of all of it won't need to scan it for their range
+            buffer->getIndexRangeCache()->addRange(type, 0, convertCount, primitiveRestartEnabled, convertedRange, 0);
         }
     }
 
@@ -228,6 +358,132 @@ gl::Error IndexDataManager::prepareIndexData(GLenum type, GLsizei count, gl::Buf
     return gl::Error(GL_NO_ERROR);
 }
 
+gl::Error IndexDataManager::preparePrimitiveRestartIndexData(GLenum type, GLsizei count, gl::Buffer *buffer,
+                                                             const GLvoid *indices, GLenum mode,
+                                                             TranslatedIndexData *translated)
+{
+    const gl::Type &typeInfo = gl::GetTypeInfo(type);
+
+    GLenum destinationIndexType = (type == GL_UNSIGNED_INT) ? GL_UNSIGNED_INT : GL_UNSIGNED_SHORT;
+    const gl::Type &destTypeInfo = gl::GetTypeInfo(destinationIndexType);
+
+    unsigned int offset = 0;
+    BufferD3D *storage = NULL;
+
+    if (buffer != NULL)
+    {
+        offset = static_cast<unsigned int>(reinterpret_cast<uintptr_t>(indices));
+        storage = GetImplAs<BufferD3D>(buffer);
+
+        ASSERT(typeInfo.bytes * static_cast<unsigned int>(count) + offset <= storage->getSize());
+    }
+
+    translated->mode = GetPrimitiveRestartListMode(mode);
+    translated->storage = NULL;
+    translated->indexType = destinationIndexType;
+
+    // Translations of static buffers are kept around like static index buffers are.
+    StaticIndexBufferInterface *staticBuffer =
+        storage ? storage->getStaticRestartIndexBuffer(mode, type, offset, count) : NULL;
+    IndexBufferInterface *indexBuffer = staticBuffer;
+    unsigned int streamOffset = 0;
+
+    if (staticBuffer && staticBuffer->isTranslated())
+    {
+        translated->count = staticBuffer->getTranslatedCount();
+    }
+    else
+    {
+        if (storage)
+        {
+            const uint8_t *bufferData = NULL;
+            gl::Error error = storage->getData(&bufferData);
+            if (error.isError())
+            {
+                return error;
+            }
+
+            indices = bufferData + offset;
+        }
+
+        translated->count = TranslatePrimitiveRestartIndices(mode, type, indices, count, NULL);
+
+        if (translated->count > 0)
+        {
+            if (!staticBuffer)
+            {
+                gl::Error error = getStreamingIndexBuffer(destinationIndexType, &indexBuffer);
+                if (error.isError())
+                {
+                    return error;
+                }
+            }
+
+            if (static_cast<unsigned int>(translated->count) > std::numeric_limits<unsigned int>::max() / destTypeInfo.bytes)
+            {
+                return gl::Error(GL_OUT_OF_MEMORY, "Reserving %u indices of %u bytes each exceeds the maximum buffer size.",
+                                 static_cast<unsigned int>(translated->count), destTypeInfo.bytes);
+            }
+
+            unsigned int bufferSizeRequired = translated->count * destTypeInfo.bytes;
+            gl::Error error = indexBuffer->reserveBufferSpace(bufferSizeRequired, destinationIndexType);
+            if (error.isError())
+            {
+                return error;
+            }
+
+            void *output = NULL;
+            error = indexBuffer->mapBuffer(bufferSizeRequired, &output, &streamOffset);
+            if (error.isError())
+            {
+                return error;
+            }
+
+            TranslatePrimitiveRestartIndices(mode, type, indices, count, output);
+
+            error = indexBuffer->unmapBuffer();
+            if (error.isError())
+            {
+                return error;
+            }
+        }
+
+        if (staticBuffer)
+        {
+            staticBuffer->setTranslatedCount(translated->count);
+        }
+    }
+
+    if (storage)
+    {
+        storage->promoteStaticIndexUsage(count * typeInfo.bytes);
+    }
+
+    // Nothing is left to draw, for example when every index is the restart index.
+    if (translated->count == 0)
+    {
+        translated->indexBuffer = NULL;
+        translated->serial = 0;
+        translated->startIndex = 0;
+        translated->startOffset = 0;
+        return gl::Error(GL_NO_ERROR);
+    }
+
+    translated->indexBuffer = indexBuffer->getIndexBuffer();
+    translated->serial = indexBuffer->getSerial();
+    translated->startIndex = streamOffset / destTypeInfo.bytes;
+    translated->startOffset = streamOffset;
+
+    return gl::Error(GL_NO_ERROR);
+}
+
+bool IndexDataManager::usesNativePrimitiveRestart(GLenum mode) const
+{
+    // D3D10+ cuts strips at the maximum index value of the index format. Other primitive types,
+    // and strips on D3D9, have their indices translated to lists.
+    return (mode == GL_LINE_STRIP || mode == GL_TRIANGLE_STRIP) && mRenderer->getMajorShaderModel() > 3;
+}
+
 gl::Error IndexDataManager::getStreamingIndexBuffer(GLenum destinationIndexType, IndexBufferInterface **outBuffer)
 {
     ASSERT(outBuffer);
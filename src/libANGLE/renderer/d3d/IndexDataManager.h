@@ -37,7 +37,9 @@ class RendererD3D;
 
 struct TranslatedIndexData
 {
+    // Unresolved until prepareIndexData converts client memory indices validation didn't scan
     RangeUI indexRange;
+    bool indexRangeResolved;
     unsigned int startIndex;
     unsigned int startOffset;   // In bytes
 
@@ -45,6 +47,11 @@ struct TranslatedIndexData
     BufferD3D *storage;
     GLenum indexType;
     unsigned int serial;
+
+    // Mode and index count to draw with. These only differ from the draw call's own when
+    // primitive restart is emulated by translating the indices into a restart-free list.
+    GLenum mode;
+    GLsizei count;
 };
 
 class IndexDataManager
@@ -53,9 +60,14 @@ class IndexDataManager
     explicit IndexDataManager(RendererD3D *renderer);
     virtual ~IndexDataManager();
 
-    gl::Error prepareIndexData(GLenum type, GLsizei count, gl::Buffer *arrayElementBuffer, const GLvoid *indices, TranslatedIndexData *translated);
+    gl::Error prepareIndexData(GLenum type, GLsizei count, gl::Buffer *arrayElementBuffer, const GLvoid *indices,
+                               GLenum mode, bool primitiveRestartEnabled, TranslatedIndexData *translated);
 
   private:
+    gl::Error preparePrimitiveRestartIndexData(GLenum type, GLsizei count, gl::Buffer *arrayElementBuffer,
+                                               const GLvoid *indices, GLenum mode, TranslatedIndexData *translated);
+    bool usesNativePrimitiveRestart(GLenum mode) const;
+
      gl::Error getStreamingIndexBuffer(GLenum destinationIndexType, IndexBufferInterface **outBuffer);
 
     DISALLOW_COPY_AND_ASSIGN(IndexDataManager);
@@ -127,6 +127,60 @@ struct AttributeSorter
     const ProgramImpl::SemanticIndexArray &originalIndices;
 };
 
+// Copies registers [firstRegister, firstRegister + registerCount) of a default block uniform into one
+// stage's storage, starting at baseRegister. Only the last register of a uniform can share space with
+// a packed neighbour, so it is written component-wise. Shader model 3 has no integer registers.
+void CopyUniformRegisters(UniformStorageD3D *storage, unsigned int baseRegister, const gl::LinkedUniform &uniform,
+                          unsigned int firstRegister, unsigned int registerCount, bool floatRegistersOnly)
+{
+    ASSERT(uniform.registerElement == 0 || uniform.registerCount == 1);
+
+    const GLenum componentType = gl::VariableComponentType(uniform.type);
+    const bool convertToFloat = (floatRegistersOnly && componentType != GL_FLOAT);
+
+    const unsigned int lastRegister = uniform.registerCount - 1;
+    const unsigned int endRegister = firstRegister + registerCount;
+    const unsigned int fullRegisterEnd = std::min(endRegister, lastRegister);
+
+    const GLint *data = reinterpret_cast<const GLint*>(uniform.data);
+    unsigned int registerIndex = firstRegister;
+
+    if (!convertToFloat && registerIndex < fullRegisterEnd)
+    {
+        storage->setRegisters(baseRegister + registerIndex, data + registerIndex * 4, fullRegisterEnd - registerIndex);
+        registerIndex = fullRegisterEnd;
+    }
+
+    for (; registerIndex < endRegister; registerIndex++)
+    {
+        const GLint *intSource = data + registerIndex * 4;
+        const void *source = intSource;
+
+        GLfloat converted[4];
+        if (convertToFloat)
+        {
+            for (unsigned int component = 0; component < 4; component++)
+            {
+                converted[component] = (componentType == GL_BOOL) ? ((intSource[component] == GL_FALSE) ? 0.0f : 1.0f)
+                                                                  : static_cast<GLfloat>(intSource[component]);
+            }
+            source = converted;
+        }
+
+        if (registerIndex == lastRegister)
+        {
+            unsigned int componentCount = (gl::IsMatrixType(uniform.type) ? gl::VariableColumnCount(uniform.type)
+                                                                          : gl::VariableComponentCount(uniform.type));
+            componentCount = std::min(componentCount, 4 - uniform.registerElement);
+            storage->setRegisterComponents(baseRegister + registerIndex, uniform.registerElement, source, componentCount);
+        }
+        else
+        {
+            storage->setRegisters(baseRegister + registerIndex, source, 1);
+        }
+    }
+}
+
 }
 
 ProgramD3D::VertexExecutable::VertexExecutable(const gl::VertexFormat inputLayout[],
@@ -291,47 +345,42 @@ void ProgramD3D::updateSamplerMapping()
     mDirtySamplerMapping = false;
 
     // Retrieve sampler uniform values
-    for (size_t uniformIndex = 0; uniformIndex < mUniforms.size(); uniformIndex++)
+    for (size_t uniformIndex = 0; uniformIndex < mSamplerUniforms.size(); uniformIndex++)
     {
-        gl::LinkedUniform *targetUniform = mUniforms[uniformIndex];
+        gl::LinkedUniform *targetUniform = mSamplerUniforms[uniformIndex];
+        ASSERT(gl::IsSamplerType(targetUniform->type));
 
-        if (targetUniform->dirty)
+        int count = targetUniform->elementCount();
+        GLint (*v)[4] = reinterpret_cast<GLint(*)[4]>(targetUniform->data);
+
+        if (targetUniform->isReferencedByFragmentShader())
         {
-            if (gl::IsSamplerType(targetUniform->type))
+            unsigned int firstIndex = targetUniform->psRegisterIndex;
+
+            for (int i = 0; i < count; i++)
             {
-                int count = targetUniform->elementCount();
-                GLint (*v)[4] = reinterpret_cast<GLint(*)[4]>(targetUniform->data);
+                unsigned int samplerIndex = firstIndex + i;
 
-                if (targetUniform->isReferencedByFragmentShader())
+                if (samplerIndex < mSamplersPS.size())
                 {
-                    unsigned int firstIndex = targetUniform->psRegisterIndex;
-
-                    for (int i = 0; i < count; i++)
-                    {
-                        unsigned int samplerIndex = firstIndex + i;
-
-                        if (samplerIndex < mSamplersPS.size())
-                        {
-                            ASSERT(mSamplersPS[samplerIndex].active);
-                            mSamplersPS[samplerIndex].logicalTextureUnit = v[i][0];
-                        }
-                    }
+                    ASSERT(mSamplersPS[samplerIndex].active);
+                    mSamplersPS[samplerIndex].logicalTextureUnit = v[i][0];
                 }
+            }
+        }
 
-                if (targetUniform->isReferencedByVertexShader())
-                {
-                    unsigned int firstIndex = targetUniform->vsRegisterIndex;
+        if (targetUniform->isReferencedByVertexShader())
+        {
+            unsigned int firstIndex = targetUniform->vsRegisterIndex;
 
-                    for (int i = 0; i < count; i++)
-                    {
-                        unsigned int samplerIndex = firstIndex + i;
+            for (int i = 0; i < count; i++)
+            {
+                unsigned int samplerIndex = firstIndex + i;
 
-                        if (samplerIndex < mSamplersVS.size())
-                        {
-                            ASSERT(mSamplersVS[samplerIndex].active);
-                            mSamplersVS[samplerIndex].logicalTextureUnit = v[i][0];
-                        }
-                    }
+                if (samplerIndex < mSamplersVS.size())
+                {
+                    ASSERT(mSamplersVS[samplerIndex].active);
+                    mSamplersVS[samplerIndex].logicalTextureUnit = v[i][0];
                 }
             }
         }
@@ -1104,14 +1153,19 @@ void ProgramD3D::getInputLayoutSignature(const gl::VertexFormat inputLayout[], G
 
 void ProgramD3D::initializeUniformStorage()
 {
-    // Compute total default block size
+    // Compute total default block size, and gather the sampler uniforms for updateSamplerMapping
     unsigned int vertexRegisters = 0;
     unsigned int fragmentRegisters = 0;
+    mSamplerUniforms.clear();
     for (size_t uniformIndex = 0; uniformIndex < mUniforms.size(); uniformIndex++)
     {
         const gl::LinkedUniform &uniform = *mUniforms[uniformIndex];
 
-        if (!gl::IsSamplerType(uniform.type))
+        if (gl::IsSamplerType(uniform.type))
+        {
+            mSamplerUniforms.push_back(mUniforms[uniformIndex]);
+        }
+        else
         {
             if (uniform.isReferencedByVertexShader())
             {
@@ -1132,16 +1186,14 @@ gl::Error ProgramD3D::applyUniforms()
 {
     updateSamplerMapping();
 
-    gl::Error error = mRenderer->applyUniforms(*this, mUniforms);
+    gl::Error error = mRenderer->applyUniforms(*this);
     if (error.isError())
     {
         return error;
     }
 
-    for (size_t uniformIndex = 0; uniformIndex < mUniforms.size(); uniformIndex++)
-    {
-        mUniforms[uniformIndex]->dirty = false;
-    }
+    mVertexUniformStorage->markClean();
+    mFragmentUniformStorage->markClean();
 
     return gl::Error(GL_NO_ERROR);
 }
@@ -1223,10 +1275,30 @@ bool ProgramD3D::assignUniformBlockRegister(gl::InfoLog &infoLog, gl::UniformBlo
 
 void ProgramD3D::dirtyAllUniforms()
 {
-    unsigned int numUniforms = mUniforms.size();
-    for (unsigned int index = 0; index < numUniforms; index++)
+    mVertexUniformStorage->markAllDirty();
+    mFragmentUniformStorage->markAllDirty();
+}
+
+void ProgramD3D::updateUniformStorage(const gl::LinkedUniform &uniform, unsigned int firstElement,
+                                      unsigned int elementCount)
+{
+    ASSERT(!uniform.isSampler());
+
+    const unsigned int registersPerElement = uniform.registerCount / uniform.elementCount();
+    const unsigned int firstRegister = firstElement * registersPerElement;
+    const unsigned int registerCount = elementCount * registersPerElement;
+    const bool floatRegistersOnly = (mRenderer->getMajorShaderModel() < 4);
+
+    if (uniform.isReferencedByVertexShader())
+    {
+        CopyUniformRegisters(mVertexUniformStorage, uniform.vsRegisterIndex, uniform, firstRegister, registerCount,
+                             floatRegistersOnly);
+    }
+
+    if (uniform.isReferencedByFragmentShader())
     {
-        mUniforms[index]->dirty = true;
+        CopyUniformRegisters(mFragmentUniformStorage, uniform.psRegisterIndex, uniform, firstRegister, registerCount,
+                             floatRegistersOnly);
     }
 }
 
@@ -1516,6 +1588,7 @@ void ProgramD3D::setUniform(GLint location, GLsizei count, const T* v, GLenum ta
     int elementCount = targetUniform->elementCount();
 
     count = std::min(elementCount - (int)mUniformIndex[location].element, count);
+    bool dirty = false;
 
     if (targetUniform->type == targetUniformType)
     {
@@ -1528,11 +1601,11 @@ void ProgramD3D::setUniform(GLint location, GLsizei count, const T* v, GLenum ta
 
             for (int c = 0; c < components; c++)
             {
-                SetIfDirty(dest + c, source[c], &targetUniform->dirty);
+                SetIfDirty(dest + c, source[c], &dirty);
             }
             for (int c = components; c < 4; c++)
             {
-                SetIfDirty(dest + c, T(0), &targetUniform->dirty);
+                SetIfDirty(dest + c, T(0), &dirty);
             }
         }
     }
@@ -1547,11 +1620,11 @@ void ProgramD3D::setUniform(GLint location, GLsizei count, const T* v, GLenum ta
 
             for (int c = 0; c < components; c++)
             {
-                SetIfDirty(dest + c, (source[c] == static_cast<T>(0)) ? GL_FALSE : GL_TRUE, &targetUniform->dirty);
+                SetIfDirty(dest + c, (source[c] == static_cast<T>(0)) ? GL_FALSE : GL_TRUE, &dirty);
             }
             for (int c = components; c < 4; c++)
             {
-                SetIfDirty(dest + c, GL_FALSE, &targetUniform->dirty);
+                SetIfDirty(dest + c, GL_FALSE, &dirty);
             }
         }
     }
@@ -1561,25 +1634,30 @@ void ProgramD3D::setUniform(GLint location, GLsizei count, const T* v, GLenum ta
 
         GLint *target = reinterpret_cast<GLint*>(targetUniform->data) + mUniformIndex[location].element * 4;
 
-        bool wasDirty = targetUniform->dirty;
-
         for (int i = 0; i < count; i++)
         {
             GLint *dest = target + (i * 4);
             const GLint *source = reinterpret_cast<const GLint*>(v) + (i * components);
 
-            SetIfDirty(dest + 0, source[0], &targetUniform->dirty);
-            SetIfDirty(dest + 1, 0, &targetUniform->dirty);
-            SetIfDirty(dest + 2, 0, &targetUniform->dirty);
-            SetIfDirty(dest + 3, 0, &targetUniform->dirty);
+            SetIfDirty(dest + 0, source[0], &dirty);
+            SetIfDirty(dest + 1, 0, &dirty);
+            SetIfDirty(dest + 2, 0, &dirty);
+            SetIfDirty(dest + 3, 0, &dirty);
         }
 
-        if (!wasDirty && targetUniform->dirty)
+        if (dirty)
         {
             mDirtySamplerMapping = true;
         }
+
+        return;
     }
     else UNREACHABLE();
+
+    if (dirty)
+    {
+        updateUniformStorage(*targetUniform, mUniformIndex[location].element, count);
+    }
 }
 
 template<typename T>
@@ -1660,21 +1738,27 @@ void ProgramD3D::setUniformMatrixfv(GLint location, GLsizei count, GLboolean tra
     count = std::min(elementCount - (int)mUniformIndex[location].element, count);
     const unsigned int targetMatrixStride = (4 * rows);
     GLfloat *target = (GLfloat*)(targetUniform->data + mUniformIndex[location].element * sizeof(GLfloat) * targetMatrixStride);
+    bool dirty = false;
 
     for (int i = 0; i < count; i++)
     {
         // Internally store matrices as transposed versions to accomodate HLSL matrix indexing
         if (transpose == GL_FALSE)
         {
-            targetUniform->dirty = transposeMatrix<GLfloat>(target, value, 4, rows, rows, cols) || targetUniform->dirty;
+            dirty = transposeMatrix<GLfloat>(target, value, 4, rows, rows, cols) || dirty;
         }
         else
         {
-            targetUniform->dirty = expandMatrix<GLfloat>(target, value, 4, rows, cols, rows) || targetUniform->dirty;
+            dirty = expandMatrix<GLfloat>(target, value, 4, rows, cols, rows) || dirty;
         }
         target += targetMatrixStride;
         value += cols * rows;
     }
+
+    if (dirty)
+    {
+        updateUniformStorage(*targetUniform, mUniformIndex[location].element, count);
+    }
 }
 
 template <typename T>
@@ -1983,6 +2067,7 @@ void ProgramD3D::reset()
 
     mSamplersPS.clear();
     mSamplersVS.clear();
+    mSamplerUniforms.clear();
 
     mUsedVertexSamplerRange = 0;
     mUsedPixelSamplerRange = 0;
@@ -182,6 +182,8 @@ class ProgramD3D : public ProgramImpl
     static bool assignSamplers(unsigned int startSamplerIndex, GLenum samplerType, unsigned int samplerCount,
                                std::vector<Sampler> &outSamplers, GLuint *outUsedRange);
 
+    void updateUniformStorage(const gl::LinkedUniform &uniform, unsigned int firstElement, unsigned int elementCount);
+
     template <typename T>
     void setUniform(GLint location, GLsizei count, const T* v, GLenum targetUniformType);
 
@@ -220,6 +222,7 @@ class ProgramD3D : public ProgramImpl
 
     std::vector<Sampler> mSamplersPS;
     std::vector<Sampler> mSamplersVS;
+    std::vector<gl::LinkedUniform*> mSamplerUniforms;
     GLuint mUsedVertexSamplerRange;
     GLuint mUsedPixelSamplerRange;
     bool mDirtySamplerMapping;
@@ -8,7 +8,6 @@
 
 #include "libANGLE/renderer/d3d/RendererD3D.h"
 
-#include "common/MemoryBuffer.h"
 #include "common/utilities.h"
 #include "libANGLE/Display.h"
 #include "libANGLE/Framebuffer.h"
@@ -20,21 +19,21 @@
 #include "libANGLE/renderer/d3d/DisplayD3D.h"
 #include "libANGLE/renderer/d3d/IndexDataManager.h"
 
+#include "third_party/trace_event/trace_event.h"
+
 namespace rx
 {
 
 namespace
 {
-// If we request a scratch buffer requesting a smaller size this many times,
-// release and recreate the scratch buffer. This ensures we don't have a
-// degenerate case where we are stuck hogging memory.
-const int ScratchMemoryBufferLifetime = 1000;
+// Returned scratch buffers beyond this size are freed instead of being kept for reuse.
+const size_t ScratchMemoryMaxRetainedBytes = 64 * 1024 * 1024;
 }
 
 RendererD3D::RendererD3D(egl::Display *display)
     : mDisplay(display),
       mDeviceLost(false),
-      mScratchMemoryBufferResetCounter(0)
+      mScratchMemoryPool(ScratchMemoryMaxRetainedBytes)
 {
 }
 
@@ -45,7 +44,7 @@ RendererD3D::~RendererD3D()
 
 void RendererD3D::cleanup()
 {
-    mScratchMemoryBuffer.resize(0);
+    mScratchMemoryPool.clear();
     for (auto &incompleteTexture : mIncompleteTextures)
     {
         incompleteTexture.second.set(NULL);
@@ -63,14 +62,8 @@ RendererD3D *RendererD3D::makeRendererD3D(Renderer *renderer)
 gl::Error RendererD3D::drawElements(const gl::Data &data,
                                     GLenum mode, GLsizei count, GLenum type,
                                     const GLvoid *indices, GLsizei instances,
-                                    const RangeUI &indexRange)
+                                    const DrawIndexRange &indexRange)
 {
-    if (data.state->isPrimitiveRestartEnabled())
-    {
-        UNIMPLEMENTED();
-        return gl::Error(GL_INVALID_OPERATION, "Primitive restart not implemented");
-    }
-
     gl::Program *program = data.state->getProgram();
     ASSERT(program != NULL);
 
@@ -101,18 +94,30 @@ gl::Error RendererD3D::drawElements(const gl::Data &data,
 
     gl::VertexArray *vao = data.state->getVertexArray();
     TranslatedIndexData indexInfo;
-    indexInfo.indexRange = indexRange;
-    error = applyIndexBuffer(indices, vao->getElementArrayBuffer(), count, mode, type, &indexInfo);
+    indexInfo.indexRange = indexRange.range;
+    indexInfo.indexRangeResolved = indexRange.resolved;
+    error = applyIndexBuffer(indices, vao->getElementArrayBuffer(), count, mode, type,
+                             data.state->isPrimitiveRestartEnabled(), &indexInfo);
     if (error.isError())
     {
         return error;
     }
 
+    // Emulated primitive restart draws a list of a different size instead.
+    if (indexInfo.mode != mode || indexInfo.count != count)
+    {
+        if (!applyPrimitiveType(indexInfo.mode, indexInfo.count, program->usesPointSize()))
+        {
+            return gl::Error(GL_NO_ERROR);
+        }
+    }
+
     applyTransformFeedbackBuffers(*data.state);
     // Transform feedback is not allowed for DrawElements, this error should have been caught at the API validation
     // layer.
     ASSERT(!data.state->isTransformFeedbackActiveUnpaused());
 
+    ASSERT(indexInfo.indexRangeResolved);
     GLsizei vertexCount = indexInfo.indexRange.length() + 1;
     error = applyVertexBuffer(*data.state, mode, indexInfo.indexRange.start, vertexCount, instances);
     if (error.isError())
@@ -140,7 +145,7 @@ gl::Error RendererD3D::drawElements(const gl::Data &data,
 
     if (!skipDraw(data, mode))
     {
-        error = drawElements(mode, count, type, indices, vao->getElementArrayBuffer(), indexInfo, instances);
+        error = drawElements(indexInfo.mode, indexInfo.count, type, indices, vao->getElementArrayBuffer(), indexInfo, instances);
         if (error.isError())
         {
             return error;
@@ -225,6 +230,182 @@ gl::Error RendererD3D::drawArrays(const gl::Data &data,
     return gl::Error(GL_NO_ERROR);
 }
 
+gl::Error RendererD3D::multiDrawArrays(const gl::Data &data, GLenum mode, const GLint *firsts,
+                                       const GLsizei *counts, const GLsizei *instanceCounts,
+                                       GLsizei drawCount)
+{
+    // Transform feedback offsets and the point sprite passes are applied around each draw, so
+    // batches drawn with transform feedback take the path of single draws.
+    if (data.state->isTransformFeedbackActiveUnpaused())
+    {
+        for (GLsizei drawIndex = 0; drawIndex < drawCount; drawIndex++)
+        {
+            GLsizei instances = (instanceCounts ? instanceCounts[drawIndex] : 0);
+            if (counts[drawIndex] == 0 || (instanceCounts && instances == 0))
+            {
+                continue;
+            }
+
+            gl::Error error = drawArrays(data, mode, firsts[drawIndex], counts[drawIndex], instances);
+            if (error.isError())
+            {
+                return error;
+            }
+        }
+
+        return gl::Error(GL_NO_ERROR);
+    }
+
+    gl::Error error = applyBatchState(data, mode);
+    if (error.isError())
+    {
+        return error;
+    }
+
+    if (skipDraw(data, mode))
+    {
+        return gl::Error(GL_NO_ERROR);
+    }
+
+    bool usesPointSize = data.state->getProgram()->usesPointSize();
+    for (GLsizei drawIndex = 0; drawIndex < drawCount; drawIndex++)
+    {
+        GLsizei count = counts[drawIndex];
+        GLsizei instances = (instanceCounts ? instanceCounts[drawIndex] : 0);
+        if ((instanceCounts && instances == 0) || !applyPrimitiveType(mode, count, usesPointSize))
+        {
+            continue;
+        }
+
+        error = applyVertexBuffer(*data.state, mode, firsts[drawIndex], count, instances);
+        if (error.isError())
+        {
+            return error;
+        }
+
+        error = drawArrays(data, mode, count, instances, usesPointSize);
+        if (error.isError())
+        {
+            return error;
+        }
+    }
+
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error RendererD3D::multiDrawElements(const gl::Data &data, GLenum mode, const GLsizei *counts,
+                                         GLenum type, const GLvoid *const *indices,
+                                         const GLsizei *instanceCounts, const DrawIndexRange *indexRanges,
+                                         GLsizei drawCount)
+{
+    // Transform feedback is not allowed for DrawElements, this error should have been caught at the API validation
+    // layer.
+    ASSERT(!data.state->isTransformFeedbackActiveUnpaused());
+
+    gl::Error error = applyBatchState(data, mode);
+    if (error.isError())
+    {
+        return error;
+    }
+
+    if (skipDraw(data, mode))
+    {
+        return gl::Error(GL_NO_ERROR);
+    }
+
+    bool usesPointSize = data.state->getProgram()->usesPointSize();
+    gl::Buffer *elementArrayBuffer = data.state->getVertexArray()->getElementArrayBuffer();
+    for (GLsizei drawIndex = 0; drawIndex < drawCount; drawIndex++)
+    {
+        GLsizei count = counts[drawIndex];
+        GLsizei instances = (instanceCounts ? instanceCounts[drawIndex] : 0);
+        if ((instanceCounts && instances == 0) || !applyPrimitiveType(mode, count, usesPointSize))
+        {
+            continue;
+        }
+
+        TranslatedIndexData indexInfo;
+        indexInfo.indexRange = indexRanges[drawIndex].range;
+        indexInfo.indexRangeResolved = indexRanges[drawIndex].resolved;
+        error = applyIndexBuffer(indices[drawIndex], elementArrayBuffer, count, mode, type,
+                                 data.state->isPrimitiveRestartEnabled(), &indexInfo);
+        if (error.isError())
+        {
+            return error;
+        }
+
+        // Emulated primitive restart draws a list of a different size instead.
+        if (indexInfo.mode != mode || indexInfo.count != count)
+        {
+            if (!applyPrimitiveType(indexInfo.mode, indexInfo.count, usesPointSize))
+            {
+                continue;
+            }
+        }
+
+        ASSERT(indexInfo.indexRangeResolved);
+        GLsizei vertexCount = indexInfo.indexRange.length() + 1;
+        error = applyVertexBuffer(*data.state, mode, indexInfo.indexRange.start, vertexCount, instances);
+        if (error.isError())
+        {
+            return error;
+        }
+
+        error = drawElements(indexInfo.mode, indexInfo.count, type, indices[drawIndex], elementArrayBuffer,
+                             indexInfo, instances);
+        if (error.isError())
+        {
+            return error;
+        }
+    }
+
+    return gl::Error(GL_NO_ERROR);
+}
+
+// Applies everything the draws of a batch share, which is all state but their vertices and
+// indices. The shaders don't depend on the vertex buffers, only on the input layout of the state.
+gl::Error RendererD3D::applyBatchState(const gl::Data &data, GLenum drawMode)
+{
+    gl::Program *program = data.state->getProgram();
+    ASSERT(program != NULL);
+
+    program->updateSamplerMapping();
+
+    gl::Error error = generateSwizzles(data);
+    if (error.isError())
+    {
+        return error;
+    }
+
+    error = applyRenderTarget(data, drawMode, false);
+    if (error.isError())
+    {
+        return error;
+    }
+
+    error = applyState(data, drawMode);
+    if (error.isError())
+    {
+        return error;
+    }
+
+    applyTransformFeedbackBuffers(*data.state);
+
+    error = applyShaders(data);
+    if (error.isError())
+    {
+        return error;
+    }
+
+    error = applyTextures(data);
+    if (error.isError())
+    {
+        return error;
+    }
+
+    return applyUniformBuffers(data);
+}
+
 gl::Error RendererD3D::generateSwizzles(const gl::Data &data, gl::SamplerType type)
 {
     gl::Program *program = data.state->getProgram();
@@ -620,34 +801,24 @@ std::string RendererD3D::getVendorString() const
     return std::string("");
 }
 
-gl::Error RendererD3D::getScratchMemoryBuffer(size_t requestedSize, MemoryBuffer **bufferOut)
+gl::Error RendererD3D::getScratchMemory(size_t requestedSize, ScratchMemoryLease *leaseOut)
 {
-    if (mScratchMemoryBuffer.size() == requestedSize)
-    {
-        mScratchMemoryBufferResetCounter = ScratchMemoryBufferLifetime;
-        *bufferOut = &mScratchMemoryBuffer;
-        return gl::Error(GL_NO_ERROR);
-    }
-
-    if (mScratchMemoryBuffer.size() > requestedSize)
+    if (!mScratchMemoryPool.lease(requestedSize, leaseOut))
     {
-        mScratchMemoryBufferResetCounter--;
+        return gl::Error(GL_OUT_OF_MEMORY, "Failed to allocate internal buffer.");
     }
 
-    if (mScratchMemoryBufferResetCounter <= 0 || mScratchMemoryBuffer.size() < requestedSize)
-    {
-        mScratchMemoryBuffer.resize(0);
-        if (!mScratchMemoryBuffer.resize(requestedSize))
-        {
-            return gl::Error(GL_OUT_OF_MEMORY, "Failed to allocate internal buffer.");
-        }
-        mScratchMemoryBufferResetCounter = ScratchMemoryBufferLifetime;
-    }
+    return gl::Error(GL_NO_ERROR);
+}
 
-    ASSERT(mScratchMemoryBuffer.size() >= requestedSize);
+void RendererD3D::onSwap()
+{
+    mScratchMemoryPool.endFrame();
 
-    *bufferOut = &mScratchMemoryBuffer;
-    return gl::Error(GL_NO_ERROR);
+    const ScratchMemoryPool::FrameStats &stats = mScratchMemoryPool.getLastFrameStats();
+    TRACE_COUNTER2("gpu", "ScratchMemoryLeases", "leases", stats.leases, "allocations", stats.allocations);
+    TRACE_COUNTER2("gpu", "ScratchMemoryBytes", "highWater", stats.highWaterBytes,
+                   "retained", mScratchMemoryPool.getRetainedBytes());
 }
 
 }
@@ -9,7 +9,7 @@
 #ifndef LIBANGLE_RENDERER_D3D_RENDERERD3D_H_
 #define LIBANGLE_RENDERER_D3D_RENDERERD3D_H_
 
-#include "common/MemoryBuffer.h"
+#include "common/ScratchMemoryPool.h"
 #include "libANGLE/Data.h"
 #include "libANGLE/renderer/Renderer.h"
 #include "libANGLE/renderer/d3d/formatutilsD3D.h"
@@ -67,7 +67,16 @@ class RendererD3D : public Renderer
     gl::Error drawElements(const gl::Data &data,
                            GLenum mode, GLsizei count, GLenum type,
                            const GLvoid *indices, GLsizei instances,
-                           const RangeUI &indexRange) override;
+                           const DrawIndexRange &indexRange) override;
+
+    gl::Error multiDrawArrays(const gl::Data &data, GLenum mode, const GLint *firsts,
+                              const GLsizei *counts, const GLsizei *instanceCounts,
+                              GLsizei drawCount) override;
+
+    gl::Error multiDrawElements(const gl::Data &data, GLenum mode, const GLsizei *counts,
+                                GLenum type, const GLvoid *const *indices,
+                                const GLsizei *instanceCounts, const DrawIndexRange *indexRanges,
+                                GLsizei drawCount) override;
 
     bool isDeviceLost() const override;
     std::string getVendorString() const override;
@@ -99,10 +108,11 @@ class RendererD3D : public Renderer
     virtual gl::Error applyRenderTarget(const gl::Framebuffer *frameBuffer) = 0;
     virtual gl::Error applyShaders(gl::Program *program, const gl::VertexFormat inputLayout[], const gl::Framebuffer *framebuffer,
                                    bool rasterizerDiscard, bool transformFeedbackActive) = 0;
-    virtual gl::Error applyUniforms(const ProgramImpl &program, const std::vector<gl::LinkedUniform*> &uniformArray) = 0;
+    virtual gl::Error applyUniforms(const ProgramImpl &program) = 0;
     virtual bool applyPrimitiveType(GLenum primitiveType, GLsizei elementCount, bool usesPointSize) = 0;
     virtual gl::Error applyVertexBuffer(const gl::State &state, GLenum mode, GLint first, GLsizei count, GLsizei instances) = 0;
-    virtual gl::Error applyIndexBuffer(const GLvoid *indices, gl::Buffer *elementArrayBuffer, GLsizei count, GLenum mode, GLenum type, TranslatedIndexData *indexInfo) = 0;
+    virtual gl::Error applyIndexBuffer(const GLvoid *indices, gl::Buffer *elementArrayBuffer, GLsizei count, GLenum mode, GLenum type,
+                                       bool primitiveRestartEnabled, TranslatedIndexData *indexInfo) = 0;
     virtual void applyTransformFeedbackBuffers(const gl::State& state) = 0;
 
     virtual void markAllStateDirty() = 0;
@@ -143,7 +153,7 @@ class RendererD3D : public Renderer
 
     // Image operations
     virtual ImageD3D *createImage() = 0;
-    virtual gl::Error generateMipmap(ImageD3D *dest, ImageD3D *source) = 0;
+    virtual gl::Error generateMipmapChain(ImageD3D *const *levels, size_t levelCount) = 0;
     virtual TextureStorage *createTextureStorage2D(SwapChainD3D *swapChain) = 0;
     virtual TextureStorage *createTextureStorage2D(GLenum internalformat, bool renderTarget, GLsizei width, GLsizei height, int levels, bool hintLevelZeroOnly) = 0;
     virtual TextureStorage *createTextureStorageCube(GLenum internalformat, bool renderTarget, int size, int levels, bool hintLevelZeroOnly) = 0;
@@ -165,7 +175,12 @@ class RendererD3D : public Renderer
     void notifyDeviceLost() override;
     virtual bool resetDevice() = 0;
 
-    gl::Error getScratchMemoryBuffer(size_t requestedSize, MemoryBuffer **bufferOut);
+    // Temporary memory for conversions, leased until the caller is done with it
+    gl::Error getScratchMemory(size_t requestedSize, ScratchMemoryLease *leaseOut);
+    ScratchMemoryPool *getScratchMemoryPool() { return &mScratchMemoryPool; }
+
+    // Called after a swap, to close the frame's scratch memory stats
+    void onSwap();
 
   protected:
     virtual gl::Error drawArrays(const gl::Data &data, GLenum mode, GLsizei count, GLsizei instances, bool usesPointSize) = 0;
@@ -195,6 +210,7 @@ class RendererD3D : public Renderer
                             const FramebufferTextureSerialArray &framebufferSerials, size_t framebufferSerialCount);
     gl::Error applyTextures(const gl::Data &data);
     gl::Error applyUniformBuffers(const gl::Data &data);
+    gl::Error applyBatchState(const gl::Data &data, GLenum drawMode);
 
     bool skipDraw(const gl::Data &data, GLenum drawMode);
     void markTransformFeedbackUsage(const gl::Data &data);
@@ -204,8 +220,7 @@ class RendererD3D : public Renderer
     gl::Texture *getIncompleteTexture(GLenum type);
 
     gl::TextureMap mIncompleteTextures;
-    MemoryBuffer mScratchMemoryBuffer;
-    unsigned int mScratchMemoryBufferResetCounter;
+    ScratchMemoryPool mScratchMemoryPool;
 };
 
 struct dx_VertexConstants
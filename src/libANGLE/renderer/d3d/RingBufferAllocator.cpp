@@ -0,0 +1,271 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// RingBufferAllocator.cpp: Implements the rx::RingBufferAllocator class.
+
+#include "libANGLE/renderer/d3d/RingBufferAllocator.h"
+#include "libANGLE/renderer/FenceNVImpl.h"
+#include "libANGLE/renderer/Renderer.h"
+
+#include "common/debug.h"
+
+#include <algorithm>
+
+namespace
+{
+    // Enough segments that the GPU has usually finished with one by the time the writes come back
+    // around to it, while each fence covers many draws
+    enum { STREAMING_BUFFER_SEGMENT_COUNT = 4 };
+}
+
+namespace rx
+{
+
+RingBufferAllocator::RingBufferAllocator(unsigned int segmentCount)
+    : mSegmentCount(segmentCount),
+      mBufferSize(0),
+      mSegmentSize(1),
+      mReservationStart(0),
+      mSegmentFenceSerials(segmentCount, 0),
+      mSegmentsWritten(segmentCount, false),
+      mNextFenceSerial(1),
+      mCompletedFenceSerial(0),
+      mFencesUnavailable(false)
+{
+    // With a single segment, every wrap would have to wait for the data just written
+    ASSERT(segmentCount >= 2);
+}
+
+RingBufferAllocator::~RingBufferAllocator()
+{
+    releaseFences();
+    for (size_t i = 0; i < mFreeFences.size(); i++)
+    {
+        SafeDelete(mFreeFences[i]);
+    }
+}
+
+void RingBufferAllocator::reset(unsigned int bufferSize)
+{
+    // The GPU may still be reading the previous buffer, but that no longer affects this one
+    releaseFences();
+
+    mBufferSize = bufferSize;
+    mSegmentSize = std::max(1u, (bufferSize + mSegmentCount - 1) / mSegmentCount);
+    mReservationStart = 0;
+    std::fill(mSegmentFenceSerials.begin(), mSegmentFenceSerials.end(), 0);
+    std::fill(mSegmentsWritten.begin(), mSegmentsWritten.end(), false);
+}
+
+gl::Error RingBufferAllocator::reserve(unsigned int writePosition, unsigned int size, unsigned int *outWritePosition,
+                                       RingReservation *outReservation)
+{
+    *outWritePosition = writePosition;
+    *outReservation = RING_RESERVED;
+
+    markWrittenSegments(writePosition);
+
+    if (size == 0)
+    {
+        return gl::Error(GL_NO_ERROR);
+    }
+
+    if (size > mBufferSize)
+    {
+        *outReservation = RING_NEEDS_GROWTH;
+        return gl::Error(GL_NO_ERROR);
+    }
+
+    bool wraps = (writePosition > mBufferSize || size > mBufferSize - writePosition);
+    if (mFencesUnavailable)
+    {
+        // Without fences, such as when the device has no event queries, the buffer is written
+        // through once and then discarded, like any streaming buffer
+        *outReservation = (wraps ? RING_NEEDS_DISCARD : RING_RESERVED);
+        return gl::Error(GL_NO_ERROR);
+    }
+
+    unsigned int start = (wraps ? 0 : writePosition);
+    unsigned int firstSegment = getSegment(start);
+    unsigned int lastSegment = getSegment(start + size - 1);
+
+    // The segment holding the last bytes written is the one being filled; any other segment of
+    // the range is entered, and must neither hold data written since the last fence nor be in use.
+    bool continuesSegment = (!wraps && writePosition > 0 && getSegment(writePosition - 1) == firstSegment);
+    unsigned int firstEntered = (continuesSegment ? firstSegment + 1 : firstSegment);
+
+    if (firstEntered <= lastSegment)
+    {
+        for (unsigned int segment = firstEntered; segment <= lastSegment; segment++)
+        {
+            if (mSegmentsWritten[segment])
+            {
+                *outReservation = RING_NEEDS_GROWTH;
+                return gl::Error(GL_NO_ERROR);
+            }
+        }
+
+        bool fenced = false;
+        gl::Error error = fenceWrittenSegments(&fenced);
+        if (error.isError())
+        {
+            return error;
+        }
+        if (!fenced)
+        {
+            *outReservation = RING_NEEDS_DISCARD;
+            return gl::Error(GL_NO_ERROR);
+        }
+
+        for (unsigned int segment = firstEntered; segment <= lastSegment; segment++)
+        {
+            error = waitForSegment(segment);
+            if (error.isError())
+            {
+                return error;
+            }
+        }
+
+        std::fill(mSegmentsWritten.begin(), mSegmentsWritten.end(), false);
+    }
+
+    if (wraps)
+    {
+        mStats.wraps++;
+    }
+
+    mReservationStart = start;
+    *outWritePosition = start;
+    return gl::Error(GL_NO_ERROR);
+}
+
+unsigned int RingBufferAllocator::getSegment(unsigned int position) const
+{
+    ASSERT(position < mBufferSize);
+    return position / mSegmentSize;
+}
+
+void RingBufferAllocator::markWrittenSegments(unsigned int writePosition)
+{
+    // Reservations may be left partly unused, so only the bytes before the write position count
+    unsigned int end = std::min(writePosition, mBufferSize);
+    if (end > mReservationStart)
+    {
+        for (unsigned int segment = getSegment(mReservationStart); segment <= getSegment(end - 1); segment++)
+        {
+            mSegmentsWritten[segment] = true;
+        }
+    }
+    mReservationStart = std::max(mReservationStart, end);
+}
+
+gl::Error RingBufferAllocator::fenceWrittenSegments(bool *outFenced)
+{
+    *outFenced = true;
+
+    if (std::find(mSegmentsWritten.begin(), mSegmentsWritten.end(), true) == mSegmentsWritten.end())
+    {
+        return gl::Error(GL_NO_ERROR);
+    }
+
+    FenceNVImpl *fence = NULL;
+    if (!mFreeFences.empty())
+    {
+        fence = mFreeFences.back();
+        mFreeFences.pop_back();
+    }
+    else
+    {
+        fence = createFence();
+    }
+
+    if (fence == NULL || fence->set().isError())
+    {
+        SafeDelete(fence);
+        mFencesUnavailable = true;
+        *outFenced = false;
+        return gl::Error(GL_NO_ERROR);
+    }
+
+    PendingFence pending = { fence, mNextFenceSerial++ };
+    mPendingFences.push_back(pending);
+    mStats.fencesSet++;
+
+    for (unsigned int segment = 0; segment < mSegmentCount; segment++)
+    {
+        if (mSegmentsWritten[segment])
+        {
+            mSegmentFenceSerials[segment] = pending.serial;
+        }
+    }
+
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error RingBufferAllocator::waitForSegment(unsigned int segment)
+{
+    unsigned int serial = mSegmentFenceSerials[segment];
+    bool waited = false;
+
+    // Fences complete in the order they were set, so the earlier ones are retired on the way
+    while (serial > mCompletedFenceSerial)
+    {
+        ASSERT(!mPendingFences.empty());
+        PendingFence pending = mPendingFences.front();
+
+        GLboolean finished = GL_FALSE;
+        gl::Error error = pending.fence->test(false, &finished);
+        if (error.isError())
+        {
+            return error;
+        }
+
+        if (finished != GL_TRUE)
+        {
+            error = pending.fence->finishFence(&finished);
+            if (error.isError())
+            {
+                return error;
+            }
+            waited = true;
+        }
+
+        mCompletedFenceSerial = pending.serial;
+        mFreeFences.push_back(pending.fence);
+        mPendingFences.pop_front();
+    }
+
+    if (waited)
+    {
+        mStats.fenceWaits++;
+    }
+
+    mSegmentFenceSerials[segment] = 0;
+    return gl::Error(GL_NO_ERROR);
+}
+
+void RingBufferAllocator::releaseFences()
+{
+    for (size_t i = 0; i < mPendingFences.size(); i++)
+    {
+        SafeDelete(mPendingFences[i].fence);
+    }
+    mPendingFences.clear();
+    mCompletedFenceSerial = mNextFenceSerial - 1;
+}
+
+StreamingBufferRing::StreamingBufferRing(Renderer *renderer)
+    : RingBufferAllocator(STREAMING_BUFFER_SEGMENT_COUNT),
+      mRenderer(renderer)
+{
+}
+
+FenceNVImpl *StreamingBufferRing::createFence()
+{
+    return mRenderer->createFenceNV();
+}
+
+}
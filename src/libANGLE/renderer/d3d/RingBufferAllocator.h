@@ -0,0 +1,124 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// RingBufferAllocator.h: Defines the rx::RingBufferAllocator class, which places the writes to a
+// streaming buffer in a ring of segments, reusing a segment once a fence shows the GPU is done
+// with it rather than discarding the whole buffer when the writes reach its end.
+
+#ifndef LIBANGLE_RENDERER_D3D_RINGBUFFERALLOCATOR_H_
+#define LIBANGLE_RENDERER_D3D_RINGBUFFERALLOCATOR_H_
+
+#include "common/angleutils.h"
+#include "libANGLE/Error.h"
+
+#include <deque>
+#include <vector>
+
+namespace rx
+{
+class FenceNVImpl;
+class Renderer;
+
+enum RingReservation
+{
+    // The space is at the returned write position, and the GPU is done with any earlier data there
+    RING_RESERVED,
+    // The space can't be found without overwriting data still in use; the buffer must grow
+    RING_NEEDS_GROWTH,
+    // Fences are unavailable, so the buffer must be discarded to be written from the start
+    RING_NEEDS_DISCARD,
+};
+
+struct RingBufferStats
+{
+    RingBufferStats() : wraps(0), fencesSet(0), fenceWaits(0) {}
+
+    // Reservations placed back at the start of the buffer
+    size_t wraps;
+    // Fences set behind the segments left
+    size_t fencesSet;
+    // Segments entered before the GPU was done with them, which had to be waited for
+    size_t fenceWaits;
+};
+
+// The buffer is split into segmentCount segments. When a reservation leaves the segment of the
+// previous writes, a single fence is set behind all the segments written since the last one, and
+// each segment entered is reused only once the fence set behind it has completed. The allocator
+// only tracks positions; the caller writes the data and creates the buffer.
+class RingBufferAllocator
+{
+  public:
+    explicit RingBufferAllocator(unsigned int segmentCount);
+    virtual ~RingBufferAllocator();
+
+    // Starts over on a new buffer of bufferSize bytes, forgetting the fences of the previous one.
+    void reset(unsigned int bufferSize);
+
+    // Finds size contiguous bytes at writePosition, or at the start of the buffer if they don't
+    // fit before its end. The bytes up to writePosition count as written since the previous
+    // reservation. A reservation of zero bytes continues the previous one.
+    gl::Error reserve(unsigned int writePosition, unsigned int size, unsigned int *outWritePosition,
+                      RingReservation *outReservation);
+
+    unsigned int getBufferSize() const { return mBufferSize; }
+    const RingBufferStats &getStats() const { return mStats; }
+
+  protected:
+    // Returns a new fence, or NULL if the renderer can't create one.
+    virtual FenceNVImpl *createFence() = 0;
+
+  private:
+    DISALLOW_COPY_AND_ASSIGN(RingBufferAllocator);
+
+    struct PendingFence
+    {
+        FenceNVImpl *fence;
+        unsigned int serial;
+    };
+
+    unsigned int getSegment(unsigned int position) const;
+    void markWrittenSegments(unsigned int writePosition);
+    gl::Error fenceWrittenSegments(bool *outFenced);
+    gl::Error waitForSegment(unsigned int segment);
+    void releaseFences();
+
+    const unsigned int mSegmentCount;
+    unsigned int mBufferSize;
+    unsigned int mSegmentSize;
+
+    // Where the bytes written since the last reservation begin
+    unsigned int mReservationStart;
+
+    // The serial of the fence each segment waits for, or zero
+    std::vector<unsigned int> mSegmentFenceSerials;
+    // Segments written since the last fence was set
+    std::vector<bool> mSegmentsWritten;
+
+    std::deque<PendingFence> mPendingFences;
+    std::vector<FenceNVImpl*> mFreeFences;
+    unsigned int mNextFenceSerial;
+    unsigned int mCompletedFenceSerial;
+    bool mFencesUnavailable;
+
+    RingBufferStats mStats;
+};
+
+// Fences the ring with the renderer's NV fences.
+class StreamingBufferRing : public RingBufferAllocator
+{
+  public:
+    explicit StreamingBufferRing(Renderer *renderer);
+
+  protected:
+    virtual FenceNVImpl *createFence();
+
+  private:
+    Renderer *const mRenderer;
+};
+
+}
+
+#endif // LIBANGLE_RENDERER_D3D_RINGBUFFERALLOCATOR_H_
@@ -11,6 +11,9 @@
 
 #include "common/angleutils.h"
 
+#include <algorithm>
+#include <cstring>
+
 namespace rx
 {
 
@@ -45,8 +48,14 @@ void ShaderExecutableD3D::appendDebugInfo(const std::string &info)
 }
 
 
-UniformStorageD3D::UniformStorageD3D(size_t initialSize) : mSize(initialSize)
+UniformStorageD3D::UniformStorageD3D(size_t initialSize)
+    : mSize(initialSize),
+      mRegisterData(initialSize / sizeof(float), 0.0f),
+      mDirtyRegisterStart(0),
+      mDirtyRegisterEnd(0)
 {
+    ASSERT(initialSize % (4 * sizeof(float)) == 0);
+    markAllDirty();
 }
 
 UniformStorageD3D::~UniformStorageD3D()
@@ -58,4 +67,63 @@ size_t UniformStorageD3D::size() const
     return mSize;
 }
 
+unsigned int UniformStorageD3D::getRegisterCount() const
+{
+    return static_cast<unsigned int>(mRegisterData.size() / 4);
+}
+
+const float *UniformStorageD3D::getRegisterData() const
+{
+    return (mRegisterData.empty() ? NULL : &mRegisterData[0]);
+}
+
+void UniformStorageD3D::setRegisters(unsigned int registerIndex, const void *source, unsigned int registerCount)
+{
+    updateData(registerIndex, 0, source, registerCount * 4, registerCount);
+}
+
+void UniformStorageD3D::setRegisterComponents(unsigned int registerIndex, unsigned int registerElement,
+                                              const void *source, unsigned int componentCount)
+{
+    ASSERT(registerElement + componentCount <= 4);
+    updateData(registerIndex, registerElement, source, componentCount, 1);
+}
+
+void UniformStorageD3D::updateData(unsigned int registerIndex, unsigned int registerElement, const void *source,
+                                   unsigned int componentCount, unsigned int registerCount)
+{
+    ASSERT(registerIndex + registerCount <= getRegisterCount());
+
+    float *dest = &mRegisterData[registerIndex * 4 + registerElement];
+    size_t byteCount = componentCount * sizeof(float);
+
+    if (memcmp(dest, source, byteCount) != 0)
+    {
+        memcpy(dest, source, byteCount);
+
+        if (isDirty())
+        {
+            mDirtyRegisterStart = std::min(mDirtyRegisterStart, registerIndex);
+            mDirtyRegisterEnd = std::max(mDirtyRegisterEnd, registerIndex + registerCount);
+        }
+        else
+        {
+            mDirtyRegisterStart = registerIndex;
+            mDirtyRegisterEnd = registerIndex + registerCount;
+        }
+    }
+}
+
+void UniformStorageD3D::markClean()
+{
+    mDirtyRegisterStart = 0;
+    mDirtyRegisterEnd = 0;
+}
+
+void UniformStorageD3D::markAllDirty()
+{
+    mDirtyRegisterStart = 0;
+    mDirtyRegisterEnd = getRegisterCount();
+}
+
 }
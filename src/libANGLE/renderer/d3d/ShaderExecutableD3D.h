@@ -39,6 +39,9 @@ class ShaderExecutableD3D
     std::string mDebugInfo;
 };
 
+// Holds the default uniform block of one shader stage. The CPU copy is laid out in float4 registers
+// exactly as the shader sees it, and the registers written since the last apply are tracked as a
+// single [start, end) range.
 class UniformStorageD3D
 {
   public:
@@ -47,8 +50,33 @@ class UniformStorageD3D
 
     size_t size() const;
 
+    unsigned int getRegisterCount() const;
+    const float *getRegisterData() const;
+
+    // Copies whole registers starting at registerIndex.
+    void setRegisters(unsigned int registerIndex, const void *source, unsigned int registerCount);
+    // Copies 32-bit components into a single register, starting at component registerElement.
+    void setRegisterComponents(unsigned int registerIndex, unsigned int registerElement, const void *source,
+                               unsigned int componentCount);
+
+    bool isDirty() const { return mDirtyRegisterStart < mDirtyRegisterEnd; }
+    unsigned int getDirtyRegisterStart() const { return mDirtyRegisterStart; }
+    unsigned int getDirtyRegisterEnd() const { return mDirtyRegisterEnd; }
+
+    void markClean();
+    void markAllDirty();
+
   private:
+    DISALLOW_COPY_AND_ASSIGN(UniformStorageD3D);
+
+    void updateData(unsigned int registerIndex, unsigned int registerElement, const void *source,
+                    unsigned int componentCount, unsigned int registerCount);
+
     size_t mSize;
+
+    std::vector<float> mRegisterData;
+    unsigned int mDirtyRegisterStart;
+    unsigned int mDirtyRegisterEnd;
 };
 
 }
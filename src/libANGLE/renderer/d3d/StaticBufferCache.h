@@ -0,0 +1,182 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// StaticBufferCache.h: Defines the rx::StaticBufferCache class template, which keeps the
+// converted copies of a buffer's data under a memory budget, evicting the least recently used.
+
+#ifndef LIBANGLE_RENDERER_D3D_STATICBUFFERCACHE_H_
+#define LIBANGLE_RENDERER_D3D_STATICBUFFERCACHE_H_
+
+#include "common/angleutils.h"
+#include "common/debug.h"
+
+#include <map>
+
+namespace rx
+{
+
+struct StaticBufferCacheStats
+{
+    StaticBufferCacheStats() : hits(0), misses(0), evictions(0) {}
+
+    // Lookups that found a converted copy
+    size_t hits;
+    // Lookups that found none, whether or not a copy was then added
+    size_t misses;
+    // Copies deleted to make room for another
+    size_t evictions;
+};
+
+// Owns the cached buffers, which must have a getBufferSize() method. Uses are stamped with a
+// serial, such as the draw being prepared: entries used at the current serial may be referenced
+// by that draw, so they are never evicted by it.
+template <typename KeyT, typename BufferT>
+class StaticBufferCache
+{
+  public:
+    explicit StaticBufferCache(size_t maxEntries);
+    ~StaticBufferCache();
+
+    // Returns the buffer for key or NULL, counting a hit or a miss and marking the buffer used.
+    BufferT *lookup(const KeyT &key, unsigned int useSerial);
+
+    // Returns the buffer for key or NULL, without counting or marking the use.
+    BufferT *find(const KeyT &key) const;
+
+    // Makes room for one more entry within maxEntries and budgetBytes. When allowEviction is set,
+    // the least recently used entries are deleted until it fits; returns false if it doesn't.
+    bool makeRoom(size_t budgetBytes, bool allowEviction, unsigned int useSerial);
+
+    // Takes ownership of buffer, which must be the only one for key.
+    void insert(const KeyT &key, BufferT *buffer, unsigned int useSerial);
+
+    void clear();
+
+    size_t size() const { return mEntries.size(); }
+    size_t getTotalSize() const;
+    const StaticBufferCacheStats &getStats() const { return mStats; }
+
+  private:
+    DISALLOW_COPY_AND_ASSIGN(StaticBufferCache);
+
+    struct Entry
+    {
+        BufferT *buffer;
+        unsigned int lastUseSerial;
+    };
+
+    typedef std::map<KeyT, Entry> EntryMap;
+
+    EntryMap mEntries;
+    size_t mMaxEntries;
+    StaticBufferCacheStats mStats;
+};
+
+template <typename KeyT, typename BufferT>
+StaticBufferCache<KeyT, BufferT>::StaticBufferCache(size_t maxEntries)
+    : mMaxEntries(maxEntries)
+{
+    ASSERT(maxEntries > 0);
+}
+
+template <typename KeyT, typename BufferT>
+StaticBufferCache<KeyT, BufferT>::~StaticBufferCache()
+{
+    clear();
+}
+
+template <typename KeyT, typename BufferT>
+BufferT *StaticBufferCache<KeyT, BufferT>::lookup(const KeyT &key, unsigned int useSerial)
+{
+    typename EntryMap::iterator entry = mEntries.find(key);
+    if (entry == mEntries.end())
+    {
+        mStats.misses++;
+        return NULL;
+    }
+
+    mStats.hits++;
+    entry->second.lastUseSerial = useSerial;
+    return entry->second.buffer;
+}
+
+template <typename KeyT, typename BufferT>
+BufferT *StaticBufferCache<KeyT, BufferT>::find(const KeyT &key) const
+{
+    typename EntryMap::const_iterator entry = mEntries.find(key);
+    return (entry != mEntries.end() ? entry->second.buffer : NULL);
+}
+
+template <typename KeyT, typename BufferT>
+bool StaticBufferCache<KeyT, BufferT>::makeRoom(size_t budgetBytes, bool allowEviction, unsigned int useSerial)
+{
+    size_t totalSize = getTotalSize();
+
+    while (mEntries.size() >= mMaxEntries || totalSize > budgetBytes)
+    {
+        if (!allowEviction)
+        {
+            return false;
+        }
+
+        // The oldest use is the least recent, counting serials modulo wrap-around
+        typename EntryMap::iterator oldest = mEntries.end();
+        for (typename EntryMap::iterator entry = mEntries.begin(); entry != mEntries.end(); entry++)
+        {
+            unsigned int age = useSerial - entry->second.lastUseSerial;
+            if (age > 0 && (oldest == mEntries.end() || age > useSerial - oldest->second.lastUseSerial))
+            {
+                oldest = entry;
+            }
+        }
+
+        if (oldest == mEntries.end())
+        {
+            return false;
+        }
+
+        totalSize -= oldest->second.buffer->getBufferSize();
+        SafeDelete(oldest->second.buffer);
+        mEntries.erase(oldest);
+        mStats.evictions++;
+    }
+
+    return true;
+}
+
+template <typename KeyT, typename BufferT>
+void StaticBufferCache<KeyT, BufferT>::insert(const KeyT &key, BufferT *buffer, unsigned int useSerial)
+{
+    ASSERT(mEntries.find(key) == mEntries.end());
+
+    Entry entry = { buffer, useSerial };
+    mEntries[key] = entry;
+}
+
+template <typename KeyT, typename BufferT>
+void StaticBufferCache<KeyT, BufferT>::clear()
+{
+    for (typename EntryMap::iterator entry = mEntries.begin(); entry != mEntries.end(); entry++)
+    {
+        SafeDelete(entry->second.buffer);
+    }
+    mEntries.clear();
+}
+
+template <typename KeyT, typename BufferT>
+size_t StaticBufferCache<KeyT, BufferT>::getTotalSize() const
+{
+    size_t totalSize = 0;
+    for (typename EntryMap::const_iterator entry = mEntries.begin(); entry != mEntries.end(); entry++)
+    {
+        totalSize += entry->second.buffer->getBufferSize();
+    }
+    return totalSize;
+}
+
+}
+
+#endif // LIBANGLE_RENDERER_D3D_STATICBUFFERCACHE_H_
@@ -214,6 +214,7 @@ egl::Error SurfaceD3D::swapRect(EGLint x, EGLint y, EGLint width, EGLint height)
     }
 
     checkForOutOfDateSwapChain();
+    mRenderer->onSwap();
 
     return egl::Error(EGL_SUCCESS);
 }
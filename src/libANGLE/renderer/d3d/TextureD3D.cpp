@@ -18,11 +18,14 @@
 #include "libANGLE/renderer/BufferImpl.h"
 #include "libANGLE/renderer/d3d/BufferD3D.h"
 #include "libANGLE/renderer/d3d/ImageD3D.h"
+#include "libANGLE/renderer/d3d/ImageLoadTask.h"
 #include "libANGLE/renderer/d3d/RendererD3D.h"
 #include "libANGLE/renderer/d3d/RenderTargetD3D.h"
 #include "libANGLE/renderer/d3d/SurfaceD3D.h"
 #include "libANGLE/renderer/d3d/TextureStorage.h"
 
+#include "third_party/trace_event/trace_event.h"
+
 namespace rx
 {
 
@@ -65,6 +68,13 @@ gl::Error GetUnpackPointer(const gl::PixelUnpackState &unpack, const uint8_t *pi
     return gl::Error(GL_NO_ERROR);
 }
 
+// Pixels unpacked from a pixel buffer are read through BufferD3D::getData, which copies the buffer
+// into system memory unless that copy is already current. Counted as one more CPU copy.
+int GetUnpackResolveCopies(const gl::PixelUnpackState &unpack)
+{
+    return (unpack.pixelBuffer.id() != 0) ? 1 : 0;
+}
+
 bool IsRenderTargetUsage(GLenum usage)
 {
     return (usage == GL_FRAMEBUFFER_ATTACHMENT_ANGLE);
@@ -156,6 +166,18 @@ bool TextureD3D::shouldUseSetData(const ImageD3D *image) const
     return (mTexStorage && !internalFormat.compressed);
 }
 
+bool TextureD3D::shouldLoadAsync(const ImageD3D *image, const gl::Box &area, GLenum type, const gl::PixelUnpackState &unpack) const
+{
+    if (!mRenderer->getWorkarounds().asyncImageLoads)
+    {
+        return false;
+    }
+
+    const gl::InternalFormat &internalFormat = gl::GetInternalFormatInfo(image->getInternalFormat());
+    size_t inputBytes = static_cast<size_t>(internalFormat.computeDepthPitch(type, area.width, area.height, unpack.alignment, unpack.rowLength)) * area.depth;
+    return ImageLoadTask::ShouldRunAsync(inputBytes);
+}
+
 gl::Error TextureD3D::setImage(const gl::ImageIndex &index, GLenum type,
                                const gl::PixelUnpackState &unpack, const uint8_t *pixels,
                                ptrdiff_t layerOffset)
@@ -180,13 +202,24 @@ gl::Error TextureD3D::setImage(const gl::ImageIndex &index, GLenum type,
 
     if (pixelData != NULL)
     {
-        if (shouldUseSetData(image))
+        gl::Box fullImageArea(0, 0, 0, image->getWidth(), image->getHeight(), image->getDepth());
+
+        // The image holds the whole level once loaded, so its conversion can finish any time before
+        // the level is next committed to the storage.
+        if (shouldLoadAsync(image, fullImageArea, type, unpack))
+        {
+            TRACE_EVENT_INSTANT2("gpu", "TextureUpload", "path", "asyncImage", "cpuCopies",
+                                 2 + GetUnpackResolveCopies(unpack));
+            error = image->loadDataAsync(fullImageArea, unpack, type, pixelData);
+        }
+        else if (shouldUseSetData(image))
         {
             error = mTexStorage->setData(index, image, NULL, type, unpack, pixelData);
         }
         else
         {
-            gl::Box fullImageArea(0, 0, 0, image->getWidth(), image->getHeight(), image->getDepth());
+            TRACE_EVENT_INSTANT2("gpu", "TextureUpload", "path", "image", "cpuCopies",
+                                 1 + GetUnpackResolveCopies(unpack));
             error = image->loadData(fullImageArea, unpack, type, pixelData);
         }
 
@@ -217,12 +250,25 @@ gl::Error TextureD3D::subImage(const gl::ImageIndex &index, const gl::Box &area,
         ImageD3D *image = getImage(index);
         ASSERT(image);
 
-        if (shouldUseSetData(image))
+        // Only load asynchronously while there is no storage to commit the region to. With a
+        // storage, the region is committed right away since the rest of the image may be stale.
+        if (!mTexStorage && shouldLoadAsync(image, area, type, unpack))
+        {
+            TRACE_EVENT_INSTANT2("gpu", "TextureUpload", "path", "asyncImage", "cpuCopies",
+                                 2 + GetUnpackResolveCopies(unpack));
+            error = image->loadDataAsync(area, unpack, type, pixelData);
+        }
+        else if (shouldUseSetData(image))
         {
             return mTexStorage->setData(index, image, &area, type, unpack, pixelData);
         }
+        else
+        {
+            TRACE_EVENT_INSTANT2("gpu", "TextureUpload", "path", "image", "cpuCopies",
+                                 1 + GetUnpackResolveCopies(unpack));
+            error = image->loadData(area, unpack, type, pixelData);
+        }
 
-        error = image->loadData(area, unpack, type, pixelData);
         if (error.isError())
         {
             return error;
@@ -298,9 +344,21 @@ gl::Error TextureD3D::subImageCompressed(const gl::ImageIndex &index, const gl::
     return gl::Error(GL_NO_ERROR);
 }
 
-bool TextureD3D::isFastUnpackable(const gl::PixelUnpackState &unpack, GLenum sizedInternalFormat)
+bool TextureD3D::isFastUnpackable(const gl::PixelUnpackState &unpack, const uint8_t *pixels, GLenum sizedInternalFormat, GLenum type)
 {
-    return unpack.pixelBuffer.id() != 0 && mRenderer->supportsFastCopyBufferToTexture(sizedInternalFormat);
+    if (unpack.pixelBuffer.id() == 0 || !mRenderer->supportsFastCopyBufferToTexture(sizedInternalFormat))
+    {
+        return false;
+    }
+
+    // The copy shader reads the buffer through a view of its source pixel format, and starts at the
+    // offset divided by the pixel size (see PixelTransfer11::setBufferToTextureCopyParams). GL only
+    // requires the offset to be a multiple of the component size, and any other offset would be
+    // rounded down to the previous pixel, so those are unpacked on the CPU instead.
+    GLenum sourceFormat = gl::GetSizedInternalFormat(gl::GetInternalFormatInfo(sizedInternalFormat).format, type);
+    GLuint sourcePixelBytes = gl::GetInternalFormatInfo(sourceFormat).pixelBytes;
+    uintptr_t offset = reinterpret_cast<uintptr_t>(pixels);
+    return sourcePixelBytes > 0 && (offset % sourcePixelBytes) == 0;
 }
 
 gl::Error TextureD3D::fastUnpackPixels(const gl::PixelUnpackState &unpack, const uint8_t *pixels, const gl::Box &destArea,
@@ -318,6 +376,7 @@ gl::Error TextureD3D::fastUnpackPixels(const gl::PixelUnpackState &unpack, const
 
     uintptr_t offset = reinterpret_cast<uintptr_t>(pixels);
 
+    TRACE_EVENT_INSTANT2("gpu", "TextureUpload", "path", "pixelBufferShader", "cpuCopies", 0);
     gl::Error error = mRenderer->fastCopyBufferToTexture(unpack, offset, destRenderTarget, sizedInternalFormat, type, destArea);
     if (error.isError())
     {
@@ -430,30 +489,37 @@ gl::Error TextureD3D::generateMipmaps()
 
     for (GLint layer = 0; layer < layerCount; ++layer)
     {
-        for (GLint mip = 1; mip < mipCount; ++mip)
+        if (renderableStorage)
         {
-            ASSERT(getLayerCount(mip) == layerCount);
+            // GPU-side mipmapping
+            for (GLint mip = 1; mip < mipCount; ++mip)
+            {
+                ASSERT(getLayerCount(mip) == layerCount);
 
-            gl::ImageIndex sourceIndex = getImageIndex(mip - 1, layer);
-            gl::ImageIndex destIndex = getImageIndex(mip, layer);
+                gl::ImageIndex sourceIndex = getImageIndex(mip - 1, layer);
+                gl::ImageIndex destIndex = getImageIndex(mip, layer);
 
-            if (renderableStorage)
-            {
-                // GPU-side mipmapping
                 gl::Error error = mTexStorage->generateMipmap(sourceIndex, destIndex);
                 if (error.isError())
                 {
                     return error;
                 }
             }
-            else
+        }
+        else
+        {
+            // CPU-side mipmapping, the whole chain of the layer at once
+            std::vector<ImageD3D*> images;
+            for (GLint mip = 0; mip < mipCount; ++mip)
             {
-                // CPU-side mipmapping
-                gl::Error error = mRenderer->generateMipmap(getImage(destIndex), getImage(sourceIndex));
-                if (error.isError())
-                {
-                    return error;
-                }
+                ASSERT(getLayerCount(mip) == layerCount);
+                images.push_back(getImage(getImageIndex(mip, layer)));
+            }
+
+            gl::Error error = mRenderer->generateMipmapChain(images.data(), images.size());
+            if (error.isError())
+            {
+                return error;
             }
         }
     }
@@ -643,7 +709,7 @@ gl::Error TextureD3D_2D::setImage(GLenum target, size_t level, GLenum internalFo
     gl::ImageIndex index = gl::ImageIndex::Make2D(level);
 
     // Attempt a fast gpu copy of the pixel data to the surface
-    if (isFastUnpackable(unpack, sizedInternalFormat) && isLevelComplete(level))
+    if (isFastUnpackable(unpack, pixels, sizedInternalFormat, type) && isLevelComplete(level))
     {
         // Will try to create RT storage if it does not exist
         RenderTargetD3D *destRenderTarget = NULL;
@@ -685,7 +751,7 @@ gl::Error TextureD3D_2D::setSubImage(GLenum target, size_t level, const gl::Box
     ASSERT(target == GL_TEXTURE_2D && area.depth == 1 && area.z == 0);
 
     gl::ImageIndex index = gl::ImageIndex::Make2D(level);
-    if (isFastUnpackable(unpack, getInternalFormat(level)) && isLevelComplete(level))
+    if (isFastUnpackable(unpack, pixels, getInternalFormat(level), type) && isLevelComplete(level))
     {
         RenderTargetD3D *renderTarget = NULL;
         gl::Error error = getRenderTarget(index, &renderTarget);
@@ -1835,7 +1901,7 @@ gl::Error TextureD3D_3D::setImage(GLenum target, size_t level, GLenum internalFo
     gl::ImageIndex index = gl::ImageIndex::Make3D(level);
 
     // Attempt a fast gpu copy of the pixel data to the surface if the app bound an unpack buffer
-    if (isFastUnpackable(unpack, sizedInternalFormat) && !size.empty())
+    if (isFastUnpackable(unpack, pixels, sizedInternalFormat, type) && !size.empty())
     {
         // Will try to create RT storage if it does not exist
         RenderTargetD3D *destRenderTarget = NULL;
@@ -1879,7 +1945,7 @@ gl::Error TextureD3D_3D::setSubImage(GLenum target, size_t level, const gl::Box
     gl::ImageIndex index = gl::ImageIndex::Make3D(level);
 
     // Attempt a fast gpu copy of the pixel data to the surface if the app bound an unpack buffer
-    if (isFastUnpackable(unpack, getInternalFormat(level)))
+    if (isFastUnpackable(unpack, pixels, getInternalFormat(level), type))
     {
         RenderTargetD3D *destRenderTarget = NULL;
         gl::Error error = getRenderTarget(index, &destRenderTarget);
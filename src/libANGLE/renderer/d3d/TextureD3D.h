@@ -74,7 +74,7 @@ class TextureD3D : public TextureImpl
                                  const uint8_t *pixels, ptrdiff_t layerOffset);
     gl::Error subImageCompressed(const gl::ImageIndex &index, const gl::Box &area, GLenum format,
                                  const gl::PixelUnpackState &unpack, const uint8_t *pixels, ptrdiff_t layerOffset);
-    bool isFastUnpackable(const gl::PixelUnpackState &unpack, GLenum sizedInternalFormat);
+    bool isFastUnpackable(const gl::PixelUnpackState &unpack, const uint8_t *pixels, GLenum sizedInternalFormat, GLenum type);
     gl::Error fastUnpackPixels(const gl::PixelUnpackState &unpack, const uint8_t *pixels, const gl::Box &destArea,
                                GLenum sizedInternalFormat, GLenum type, RenderTargetD3D *destRenderTarget);
 
@@ -108,6 +108,7 @@ class TextureD3D : public TextureImpl
     virtual gl::Error updateStorage() = 0;
 
     bool shouldUseSetData(const ImageD3D *image) const;
+    bool shouldLoadAsync(const ImageD3D *image, const gl::Box &area, GLenum type, const gl::PixelUnpackState &unpack) const;
 };
 
 class TextureD3D_2D : public TextureD3D
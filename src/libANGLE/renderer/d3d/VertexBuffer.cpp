@@ -14,6 +14,13 @@
 
 #include "common/mathutil.h"
 
+namespace
+{
+    // The bytes of an interleaved source array converted per block, small enough for a block to
+    // stay in the L1 cache while each of its attributes is converted
+    enum { INTERLEAVED_BLOCK_SIZE = 8 * 1024 };
+}
+
 namespace rx
 {
 
@@ -163,6 +170,71 @@ VertexBuffer* VertexBufferInterface::getVertexBuffer() const
     return mVertexBuffer;
 }
 
+gl::Error VertexBufferInterface::storeInterleavedVertexAttributes(const gl::VertexAttribute *const *attribs,
+                                                                  const gl::VertexAttribCurrentValueData *const *currentValues,
+                                                                  size_t attribCount, GLint start, GLsizei count,
+                                                                  unsigned int *outStreamOffsets)
+{
+    ASSERT(attribCount > 0 && attribCount <= gl::MAX_VERTEX_ATTRIBS);
+
+    gl::Error error = reserveSpace(mReservedSpace);
+    if (error.isError())
+    {
+        return error;
+    }
+    mReservedSpace = 0;
+
+    unsigned int elementSizes[gl::MAX_VERTEX_ATTRIBS];
+    for (size_t i = 0; i < attribCount; i++)
+    {
+        ASSERT(ComputeVertexAttributeStride(*attribs[i]) == ComputeVertexAttributeStride(*attribs[0]));
+
+        unsigned int spaceRequired;
+        error = mVertexBuffer->getSpaceRequired(*attribs[i], count, 0, &spaceRequired);
+        if (error.isError())
+        {
+            return error;
+        }
+
+        error = mVertexBuffer->getSpaceRequired(*attribs[i], 1, 0, &elementSizes[i]);
+        if (error.isError())
+        {
+            return error;
+        }
+
+        if (mWritePosition + spaceRequired < mWritePosition)
+        {
+            return gl::Error(GL_OUT_OF_MEMORY, "Internal error, new vertex buffer write position would overflow.");
+        }
+
+        outStreamOffsets[i] = mWritePosition;
+
+        mWritePosition += spaceRequired;
+
+        // Align to 16-byte boundary
+        mWritePosition = roundUp(mWritePosition, 16u);
+    }
+
+    // Each attribute of a block reads the source bytes the previous one pulled into the cache
+    const GLsizei blockSize = std::max<GLsizei>(1, INTERLEAVED_BLOCK_SIZE / ComputeVertexAttributeStride(*attribs[0]));
+    for (GLsizei blockStart = 0; blockStart < count; blockStart += blockSize)
+    {
+        GLsizei blockCount = std::min(blockSize, count - blockStart);
+
+        for (size_t i = 0; i < attribCount; i++)
+        {
+            error = mVertexBuffer->storeVertexAttributes(*attribs[i], *currentValues[i], start + blockStart, blockCount, 0,
+                                                         outStreamOffsets[i] + blockStart * elementSizes[i]);
+            if (error.isError())
+            {
+                return error;
+            }
+        }
+    }
+
+    return gl::Error(GL_NO_ERROR);
+}
+
 bool VertexBufferInterface::directStoragePossible(const gl::VertexAttribute &attrib,
                                                   const gl::VertexAttribCurrentValueData &currentValue) const
 {
@@ -197,9 +269,12 @@ bool VertexBufferInterface::directStoragePossible(const gl::VertexAttribute &att
     return !requiresConversion && isAligned;
 }
 
-StreamingVertexBufferInterface::StreamingVertexBufferInterface(RendererD3D *renderer, std::size_t initialSize) : VertexBufferInterface(renderer, true)
+StreamingVertexBufferInterface::StreamingVertexBufferInterface(RendererD3D *renderer, std::size_t initialSize)
+    : VertexBufferInterface(renderer, true),
+      mRing(renderer)
 {
     setBufferSize(initialSize);
+    mRing.reset(getBufferSize());
 }
 
 StreamingVertexBufferInterface::~StreamingVertexBufferInterface()
@@ -208,26 +283,41 @@ StreamingVertexBufferInterface::~StreamingVertexBufferInterface()
 
 gl::Error StreamingVertexBufferInterface::reserveSpace(unsigned int size)
 {
-    unsigned int curBufferSize = getBufferSize();
-    if (size > curBufferSize)
+    unsigned int writePosition = 0;
+    RingReservation reservation = RING_RESERVED;
+    gl::Error error = mRing.reserve(getWritePosition(), size, &writePosition, &reservation);
+    if (error.isError())
     {
-        gl::Error error = setBufferSize(std::max(size, 3 * curBufferSize / 2));
+        return error;
+    }
+
+    if (reservation != RING_RESERVED)
+    {
+        if (reservation == RING_NEEDS_GROWTH)
+        {
+            error = setBufferSize(std::max(size, 3 * getBufferSize() / 2));
+        }
+        else
+        {
+            error = discard();
+        }
         if (error.isError())
         {
             return error;
         }
-        setWritePosition(0);
-    }
-    else if (getWritePosition() + size > curBufferSize)
-    {
-        gl::Error error = discard();
+
+        // The new or discarded buffer isn't in use, so the space is at its start
+        mRing.reset(getBufferSize());
+        error = mRing.reserve(0, size, &writePosition, &reservation);
         if (error.isError())
         {
             return error;
         }
-        setWritePosition(0);
+        ASSERT(reservation == RING_RESERVED);
     }
 
+    setWritePosition(writePosition);
+
     return gl::Error(GL_NO_ERROR);
 }
 
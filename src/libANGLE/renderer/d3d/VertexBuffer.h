@@ -12,6 +12,7 @@
 
 #include "common/angleutils.h"
 #include "libANGLE/Error.h"
+#include "libANGLE/renderer/d3d/RingBufferAllocator.h"
 
 #include <GLES2/gl2.h>
 
@@ -75,6 +76,13 @@ class VertexBufferInterface
     virtual gl::Error storeVertexAttributes(const gl::VertexAttribute &attrib, const gl::VertexAttribCurrentValueData &currentValue,
                                             GLint start, GLsizei count, GLsizei instances, unsigned int *outStreamOffset);
 
+    // Stores non-instanced attributes read from the same interleaved array, laid out as separate
+    // stores would, but converted a block of vertices at a time so the array is read only once.
+    gl::Error storeInterleavedVertexAttributes(const gl::VertexAttribute *const *attribs,
+                                               const gl::VertexAttribCurrentValueData *const *currentValues,
+                                               size_t attribCount, GLint start, GLsizei count,
+                                               unsigned int *outStreamOffsets);
+
     bool directStoragePossible(const gl::VertexAttribute &attrib,
                                const gl::VertexAttribCurrentValueData &currentValue) const;
 
@@ -110,6 +118,9 @@ class StreamingVertexBufferInterface : public VertexBufferInterface
 
   protected:
     gl::Error reserveSpace(unsigned int size);
+
+  private:
+    StreamingBufferRing mRing;
 };
 
 class StaticVertexBufferInterface : public VertexBufferInterface
@@ -21,6 +21,14 @@ namespace
     enum { INITIAL_STREAM_BUFFER_SIZE = 1024*1024 };
     // This has to be at least 4k or else it fails on ATI cards.
     enum { CONSTANT_VERTEX_BUFFER_SIZE = 4096 };
+
+    // An attribute used by the current program, looked up once per draw
+    struct ActiveAttribute
+    {
+        int index;
+        const gl::VertexAttribute *attribute;
+        const gl::VertexAttribCurrentValueData *currentValue;
+    };
 }
 
 namespace rx
@@ -54,7 +62,25 @@ static int StreamingBufferElementCount(const gl::VertexAttribute &attrib, int ve
     return vertexDrawCount;
 }
 
-VertexDataManager::VertexDataManager(RendererD3D *renderer) : mRenderer(renderer)
+// Whether two attributes read the same vertices of one interleaved array
+static bool SharesInterleavedSource(const gl::VertexAttribute &first, const gl::VertexAttribute &second)
+{
+    GLsizei stride = ComputeVertexAttributeStride(first);
+    if (first.buffer.get() != second.buffer.get() || ComputeVertexAttributeStride(second) != stride)
+    {
+        return false;
+    }
+
+    // The offset aliases the client pointer of attributes without a buffer
+    GLintptr distance = second.offset - first.offset;
+    return (distance > -stride && distance < stride);
+}
+
+VertexDataManager::VertexDataManager(RendererD3D *renderer)
+    : mRenderer(renderer),
+      mCurrentValueBuffer(NULL),
+      mCurrentValueStoredMask(0),
+      mDrawSerial(0)
 {
     for (int i = 0; i < gl::MAX_VERTEX_ATTRIBS; i++)
     {
@@ -63,7 +89,6 @@ VertexDataManager::VertexDataManager(RendererD3D *renderer) : mRenderer(renderer
         mCurrentValue[i].FloatValues[2] = std::numeric_limits<float>::quiet_NaN();
         mCurrentValue[i].FloatValues[3] = std::numeric_limits<float>::quiet_NaN();
         mCurrentValue[i].Type = GL_FLOAT;
-        mCurrentValueBuffer[i] = NULL;
         mCurrentValueOffsets[i] = 0;
     }
 
@@ -78,23 +103,16 @@ VertexDataManager::VertexDataManager(RendererD3D *renderer) : mRenderer(renderer
 VertexDataManager::~VertexDataManager()
 {
     delete mStreamingBuffer;
-
-    for (int i = 0; i < gl::MAX_VERTEX_ATTRIBS; i++)
-    {
-        delete mCurrentValueBuffer[i];
-    }
+    delete mCurrentValueBuffer;
 }
 
 void VertexDataManager::hintUnmapAllResources(const gl::State &state)
 {
     mStreamingBuffer->getVertexBuffer()->hintUnmapResource();
 
-    for (int i = 0; i < gl::MAX_VERTEX_ATTRIBS; i++)
+    if (mCurrentValueBuffer != NULL)
     {
-        if (mCurrentValueBuffer[i] != NULL)
-        {
-            mCurrentValueBuffer[i]->getVertexBuffer()->hintUnmapResource();
-        }
+        mCurrentValueBuffer->getVertexBuffer()->hintUnmapResource();
     }
 }
 
@@ -106,24 +124,44 @@ gl::Error VertexDataManager::prepareVertexData(const gl::State &state, GLint sta
         return gl::Error(GL_OUT_OF_MEMORY, "Internal streaming vertex buffer is unexpectedly NULL.");
     }
 
+    // Static buffers used by this draw are kept until the next one
+    mDrawSerial++;
+
+    // Gather the active attributes once, creating their static buffers on the way. The passes
+    // below only visit the gathered attributes.
+    const unsigned int activeAttribLocations = state.getProgram()->getActiveAttribLocationsMask();
+
+    ActiveAttribute activeAttribs[gl::MAX_VERTEX_ATTRIBS];
+    size_t activeAttribCount = 0;
+
     for (int attributeIndex = 0; attributeIndex < gl::MAX_VERTEX_ATTRIBS; attributeIndex++)
     {
-        translated[attributeIndex].active = (state.getProgram()->getSemanticIndex(attributeIndex) != -1);
-        const gl::VertexAttribute &curAttrib = state.getVertexAttribState(attributeIndex);
+        translated[attributeIndex].active = ((activeAttribLocations & (1u << attributeIndex)) != 0);
+        if (!translated[attributeIndex].active)
+        {
+            continue;
+        }
 
-        if (translated[attributeIndex].active && curAttrib.enabled)
+        ActiveAttribute &activeAttrib = activeAttribs[activeAttribCount++];
+        activeAttrib.index = attributeIndex;
+        activeAttrib.attribute = &state.getVertexAttribState(attributeIndex);
+        activeAttrib.currentValue = &state.getVertexAttribCurrentValue(attributeIndex);
+
+        if (activeAttrib.attribute->enabled)
         {
-            prepareStaticBufferForAttribute(curAttrib, state.getVertexAttribCurrentValue(attributeIndex));
+            prepareStaticBufferForAttribute(*activeAttrib.attribute, *activeAttrib.currentValue);
         }
     }
 
-    // Reserve the required space in the buffers
-    for (int i = 0; i < gl::MAX_VERTEX_ATTRIBS; i++)
+    // Reserve the required space in the buffers. This has to be done for all the attributes before
+    // the first one is stored, since storing may discard the streaming buffer to fit the whole draw,
+    // and after all the static buffers are created, whose sizes decide whether new ones are made.
+    for (size_t activeIndex = 0; activeIndex < activeAttribCount; activeIndex++)
     {
-        const gl::VertexAttribute &curAttrib = state.getVertexAttribState(i);
-        if (translated[i].active && curAttrib.enabled)
+        const ActiveAttribute &activeAttrib = activeAttribs[activeIndex];
+        if (activeAttrib.attribute->enabled)
         {
-            gl::Error error = reserveSpaceForAttrib(curAttrib, state.getVertexAttribCurrentValue(i), count, instances);
+            gl::Error error = reserveSpaceForAttrib(*activeAttrib.attribute, *activeAttrib.currentValue, count, instances);
             if (error.isError())
             {
                 return error;
@@ -131,57 +169,110 @@ gl::Error VertexDataManager::prepareVertexData(const gl::State &state, GLint sta
         }
     }
 
-    // Perform the vertex data translations
-    for (int i = 0; i < gl::MAX_VERTEX_ATTRIBS; i++)
+    // Streamed attributes read from the same interleaved array are stored together, so the array
+    // is walked once rather than once per attribute
+    bool storedInterleaved[gl::MAX_VERTEX_ATTRIBS] = { false };
+    for (size_t activeIndex = 0; activeIndex < activeAttribCount; activeIndex++)
     {
-        const gl::VertexAttribute &curAttrib = state.getVertexAttribState(i);
-        if (translated[i].active)
+        const ActiveAttribute &firstAttrib = activeAttribs[activeIndex];
+        if (!firstAttrib.attribute->enabled || storedInterleaved[activeIndex] ||
+            !canStoreInterleaved(*firstAttrib.attribute, *firstAttrib.currentValue, instances))
         {
-            if (curAttrib.enabled)
-            {
-                gl::Error error = storeAttribute(curAttrib, state.getVertexAttribCurrentValue(i),
-                                                 &translated[i], start, count, instances);
+            continue;
+        }
 
-                if (error.isError())
-                {
-                    hintUnmapAllResources(state);
-                    return error;
-                }
-            }
-            else
-            {
-                if (!mCurrentValueBuffer[i])
-                {
-                    mCurrentValueBuffer[i] = new StreamingVertexBufferInterface(mRenderer, CONSTANT_VERTEX_BUFFER_SIZE);
-                }
+        size_t groupIndices[gl::MAX_VERTEX_ATTRIBS];
+        const gl::VertexAttribute *groupAttribs[gl::MAX_VERTEX_ATTRIBS];
+        const gl::VertexAttribCurrentValueData *groupCurrentValues[gl::MAX_VERTEX_ATTRIBS];
+        TranslatedAttribute *groupTranslated[gl::MAX_VERTEX_ATTRIBS];
+        size_t groupSize = 0;
 
-                gl::Error error = storeCurrentValue(curAttrib, state.getVertexAttribCurrentValue(i), &translated[i],
-                                                    &mCurrentValue[i], &mCurrentValueOffsets[i],
-                                                    mCurrentValueBuffer[i]);
-                if (error.isError())
-                {
-                    hintUnmapAllResources(state);
-                    return error;
-                }
+        for (size_t otherIndex = activeIndex; otherIndex < activeAttribCount; otherIndex++)
+        {
+            const ActiveAttribute &otherAttrib = activeAttribs[otherIndex];
+            if (otherIndex == activeIndex ||
+                (otherAttrib.attribute->enabled && !storedInterleaved[otherIndex] &&
+                 SharesInterleavedSource(*firstAttrib.attribute, *otherAttrib.attribute) &&
+                 canStoreInterleaved(*otherAttrib.attribute, *otherAttrib.currentValue, instances)))
+            {
+                groupIndices[groupSize] = otherIndex;
+                groupAttribs[groupSize] = otherAttrib.attribute;
+                groupCurrentValues[groupSize] = otherAttrib.currentValue;
+                groupTranslated[groupSize] = &translated[otherAttrib.index];
+                groupSize++;
             }
         }
+
+        if (groupSize < 2)
+        {
+            continue;
+        }
+
+        gl::Error error = storeInterleavedAttributes(groupAttribs, groupCurrentValues, groupTranslated, groupSize,
+                                                     start, count);
+        if (error.isError())
+        {
+            hintUnmapAllResources(state);
+            return error;
+        }
+
+        for (size_t groupIndex = 0; groupIndex < groupSize; groupIndex++)
+        {
+            storedInterleaved[groupIndices[groupIndex]] = true;
+        }
+    }
+
+    // Perform the remaining vertex data translations. The streaming buffer stays mapped until all
+    // of them are written.
+    unsigned int currentValueAttribMask = 0;
+    for (size_t activeIndex = 0; activeIndex < activeAttribCount; activeIndex++)
+    {
+        const ActiveAttribute &activeAttrib = activeAttribs[activeIndex];
+        const int i = activeAttrib.index;
+
+        if (!activeAttrib.attribute->enabled)
+        {
+            currentValueAttribMask |= (1u << i);
+            continue;
+        }
+
+        if (storedInterleaved[activeIndex])
+        {
+            continue;
+        }
+
+        gl::Error error = storeAttribute(*activeAttrib.attribute, *activeAttrib.currentValue, &translated[i],
+                                         start, count, instances);
+        if (error.isError())
+        {
+            hintUnmapAllResources(state);
+            return error;
+        }
+    }
+
+    if (currentValueAttribMask != 0)
+    {
+        gl::Error error = storeCurrentValues(state, currentValueAttribMask, translated);
+        if (error.isError())
+        {
+            hintUnmapAllResources(state);
+            return error;
+        }
     }
 
     // Hint to unmap all the resources
     hintUnmapAllResources(state);
 
-    for (int i = 0; i < gl::MAX_VERTEX_ATTRIBS; i++)
+    for (size_t activeIndex = 0; activeIndex < activeAttribCount; activeIndex++)
     {
-        const gl::VertexAttribute &curAttrib = state.getVertexAttribState(i);
-        if (translated[i].active && curAttrib.enabled)
-        {
-            gl::Buffer *buffer = curAttrib.buffer.get();
+        const gl::VertexAttribute &curAttrib = *activeAttribs[activeIndex].attribute;
+        gl::Buffer *buffer = curAttrib.buffer.get();
 
-            if (buffer)
-            {
-                BufferD3D *bufferImpl = GetImplAs<BufferD3D>(buffer);
-                bufferImpl->promoteStaticVertexUsageForAttrib(curAttrib, count * ComputeVertexAttributeTypeSize(curAttrib));
-            }
+        if (curAttrib.enabled && buffer)
+        {
+            BufferD3D *bufferImpl = GetImplAs<BufferD3D>(buffer);
+            bufferImpl->promoteStaticVertexUsageForAttrib(curAttrib, count * ComputeVertexAttributeTypeSize(curAttrib),
+                                                          mDrawSerial);
         }
     }
 
@@ -198,7 +289,7 @@ void VertexDataManager::prepareStaticBufferForAttribute(const gl::VertexAttribut
         BufferD3D *bufferImpl = GetImplAs<BufferD3D>(buffer);
 
         // This will create the static buffer in the right circumstances
-        StaticVertexBufferInterface *staticBuffer = bufferImpl->getStaticVertexBufferForAttribute(attrib);
+        StaticVertexBufferInterface *staticBuffer = bufferImpl->getStaticVertexBufferForAttribute(attrib, mDrawSerial);
         UNUSED_ASSERTION_VARIABLE(staticBuffer);
 
         // This check validates that a valid static vertex buffer was returned above
@@ -216,7 +307,7 @@ gl::Error VertexDataManager::reserveSpaceForAttrib(const gl::VertexAttribute &at
 {
     gl::Buffer *buffer = attrib.buffer.get();
     BufferD3D *bufferImpl = buffer ? GetImplAs<BufferD3D>(buffer) : NULL;
-    StaticVertexBufferInterface *staticBuffer = bufferImpl ? bufferImpl->getStaticVertexBufferForAttribute(attrib) : NULL;
+    StaticVertexBufferInterface *staticBuffer = bufferImpl ? bufferImpl->findStaticVertexBufferForAttribute(attrib) : NULL;
     VertexBufferInterface *vertexBuffer = staticBuffer ? staticBuffer : static_cast<VertexBufferInterface*>(mStreamingBuffer);
 
     if (!vertexBuffer->directStoragePossible(attrib, currentValue))
@@ -260,7 +351,7 @@ gl::Error VertexDataManager::storeAttribute(const gl::VertexAttribute &attrib,
     ASSERT(buffer || attrib.pointer);
 
     BufferD3D *storage = buffer ? GetImplAs<BufferD3D>(buffer) : NULL;
-    StaticVertexBufferInterface *staticBuffer = storage ? storage->getStaticVertexBufferForAttribute(attrib) : NULL;
+    StaticVertexBufferInterface *staticBuffer = storage ? storage->findStaticVertexBufferForAttribute(attrib) : NULL;
     VertexBufferInterface *vertexBuffer = staticBuffer ? staticBuffer : static_cast<VertexBufferInterface*>(mStreamingBuffer);
     bool directStorage = vertexBuffer->directStoragePossible(attrib, currentValue);
 
@@ -341,41 +432,144 @@ gl::Error VertexDataManager::storeAttribute(const gl::VertexAttribute &attrib,
     return gl::Error(GL_NO_ERROR);
 }
 
-gl::Error VertexDataManager::storeCurrentValue(const gl::VertexAttribute &attrib,
-                                               const gl::VertexAttribCurrentValueData &currentValue,
-                                               TranslatedAttribute *translated,
-                                               gl::VertexAttribCurrentValueData *cachedValue,
-                                               size_t *cachedOffset,
-                                               StreamingVertexBufferInterface *buffer)
+bool VertexDataManager::canStoreInterleaved(const gl::VertexAttribute &attrib,
+                                            const gl::VertexAttribCurrentValueData &currentValue,
+                                            GLsizei instances) const
 {
-    if (*cachedValue != currentValue)
+    // Instanced attributes are stored per instance, not per vertex
+    if (instances > 0 && attrib.divisor > 0)
     {
-        gl::Error error = buffer->reserveVertexSpace(attrib, 1, 0);
-        if (error.isError())
+        return false;
+    }
+
+    // Only attributes that storeAttribute would copy to the streaming buffer
+    gl::Buffer *buffer = attrib.buffer.get();
+    if (buffer)
+    {
+        BufferD3D *storage = GetImplAs<BufferD3D>(buffer);
+        if (storage->findStaticVertexBufferForAttribute(attrib) || mStreamingBuffer->directStoragePossible(attrib, currentValue))
         {
-            return error;
+            return false;
         }
+    }
 
-        unsigned int streamOffset;
-        error = buffer->storeVertexAttributes(attrib, currentValue, 0, 1, 0, &streamOffset);
+    return true;
+}
+
+gl::Error VertexDataManager::storeInterleavedAttributes(const gl::VertexAttribute *const *attribs,
+                                                        const gl::VertexAttribCurrentValueData *const *currentValues,
+                                                        TranslatedAttribute *const *translated,
+                                                        size_t attribCount,
+                                                        GLint start,
+                                                        GLsizei count)
+{
+    unsigned int streamOffsets[gl::MAX_VERTEX_ATTRIBS];
+    gl::Error error = mStreamingBuffer->storeInterleavedVertexAttributes(attribs, currentValues, attribCount, start, count,
+                                                                        streamOffsets);
+    if (error.isError())
+    {
+        return error;
+    }
+
+    for (size_t i = 0; i < attribCount; i++)
+    {
+        unsigned int outputElementSize = 0;
+        error = mStreamingBuffer->getVertexBuffer()->getSpaceRequired(*attribs[i], 1, 0, &outputElementSize);
         if (error.isError())
         {
             return error;
         }
 
-        *cachedValue = currentValue;
-        *cachedOffset = streamOffset;
+        translated[i]->storage = NULL;
+        translated[i]->vertexBuffer = mStreamingBuffer->getVertexBuffer();
+        translated[i]->serial = mStreamingBuffer->getSerial();
+        translated[i]->divisor = attribs[i]->divisor;
+
+        translated[i]->attribute = attribs[i];
+        translated[i]->currentValueType = currentValues[i]->Type;
+        translated[i]->stride = outputElementSize;
+        translated[i]->offset = streamOffsets[i];
     }
 
-    translated->storage = NULL;
-    translated->vertexBuffer = buffer->getVertexBuffer();
-    translated->serial = buffer->getSerial();
-    translated->divisor = 0;
+    return gl::Error(GL_NO_ERROR);
+}
 
-    translated->attribute = &attrib;
-    translated->currentValueType = currentValue.Type;
-    translated->stride = 0;
-    translated->offset = *cachedOffset;
+gl::Error VertexDataManager::storeCurrentValues(const gl::State &state,
+                                                unsigned int attribMask,
+                                                TranslatedAttribute *translated)
+{
+    // A value is rewritten when it changed, or when it isn't in the last block written, whose
+    // space is the only one the streaming buffer won't reuse
+    bool rewrite = false;
+    for (int i = 0; i < gl::MAX_VERTEX_ATTRIBS && !rewrite; i++)
+    {
+        if ((attribMask & (1u << i)) != 0)
+        {
+            rewrite = ((mCurrentValueStoredMask & (1u << i)) == 0 ||
+                       mCurrentValue[i] != state.getVertexAttribCurrentValue(i));
+        }
+    }
+
+    if (rewrite)
+    {
+        if (!mCurrentValueBuffer)
+        {
+            mCurrentValueBuffer = new StreamingVertexBufferInterface(mRenderer, CONSTANT_VERTEX_BUFFER_SIZE);
+        }
+
+        mCurrentValueStoredMask = 0;
+
+        // Reserve the whole block first, so the values are written contiguously through one map
+        for (int i = 0; i < gl::MAX_VERTEX_ATTRIBS; i++)
+        {
+            if ((attribMask & (1u << i)) != 0)
+            {
+                gl::Error error = mCurrentValueBuffer->reserveVertexSpace(state.getVertexAttribState(i), 1, 0);
+                if (error.isError())
+                {
+                    return error;
+                }
+            }
+        }
+
+        for (int i = 0; i < gl::MAX_VERTEX_ATTRIBS; i++)
+        {
+            if ((attribMask & (1u << i)) != 0)
+            {
+                const gl::VertexAttribCurrentValueData &currentValue = state.getVertexAttribCurrentValue(i);
+
+                unsigned int streamOffset;
+                gl::Error error = mCurrentValueBuffer->storeVertexAttributes(state.getVertexAttribState(i),
+                                                                             currentValue, 0, 1, 0, &streamOffset);
+                if (error.isError())
+                {
+                    return error;
+                }
+
+                mCurrentValue[i] = currentValue;
+                mCurrentValueOffsets[i] = streamOffset;
+            }
+        }
+
+        mCurrentValueStoredMask = attribMask;
+    }
+
+    for (int i = 0; i < gl::MAX_VERTEX_ATTRIBS; i++)
+    {
+        if ((attribMask & (1u << i)) != 0)
+        {
+            TranslatedAttribute *translatedAttrib = &translated[i];
+            translatedAttrib->storage = NULL;
+            translatedAttrib->vertexBuffer = mCurrentValueBuffer->getVertexBuffer();
+            translatedAttrib->serial = mCurrentValueBuffer->getSerial();
+            translatedAttrib->divisor = 0;
+
+            translatedAttrib->attribute = &state.getVertexAttribState(i);
+            translatedAttrib->currentValueType = mCurrentValue[i].Type;
+            translatedAttrib->stride = 0;
+            translatedAttrib->offset = mCurrentValueOffsets[i];
+        }
+    }
 
     return gl::Error(GL_NO_ERROR);
 }
@@ -73,12 +73,20 @@ class VertexDataManager
                              GLsizei count,
                              GLsizei instances);
 
-    gl::Error storeCurrentValue(const gl::VertexAttribute &attrib,
-                                const gl::VertexAttribCurrentValueData &currentValue,
-                                TranslatedAttribute *translated,
-                                gl::VertexAttribCurrentValueData *cachedValue,
-                                size_t *cachedOffset,
-                                StreamingVertexBufferInterface *buffer);
+    bool canStoreInterleaved(const gl::VertexAttribute &attrib,
+                             const gl::VertexAttribCurrentValueData &currentValue,
+                             GLsizei instances) const;
+
+    gl::Error storeInterleavedAttributes(const gl::VertexAttribute *const *attribs,
+                                         const gl::VertexAttribCurrentValueData *const *currentValues,
+                                         TranslatedAttribute *const *translated,
+                                         size_t attribCount,
+                                         GLint start,
+                                         GLsizei count);
+
+    gl::Error storeCurrentValues(const gl::State &state,
+                                 unsigned int attribMask,
+                                 TranslatedAttribute *translated);
 
     void hintUnmapAllResources(const gl::State &state);
 
@@ -91,8 +99,14 @@ class VertexDataManager
 
     gl::VertexAttribCurrentValueData mCurrentValue[gl::MAX_VERTEX_ATTRIBS];
 
-    StreamingVertexBufferInterface *mCurrentValueBuffer[gl::MAX_VERTEX_ATTRIBS];
+    // The current values of all the disabled attributes of a draw are written together, to one
+    // buffer, and their offsets stay valid until the next block of values is written
+    StreamingVertexBufferInterface *mCurrentValueBuffer;
     std::size_t mCurrentValueOffsets[gl::MAX_VERTEX_ATTRIBS];
+    unsigned int mCurrentValueStoredMask;
+
+    // Identifies the draw being prepared to the static buffer caches
+    unsigned int mDrawSerial;
 };
 
 }
@@ -0,0 +1,97 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// convertindices.cpp: Defines the functions that copy or widen indices into an index buffer.
+
+#include "libANGLE/renderer/d3d/convertindices.h"
+
+#include "common/debug.h"
+#include "common/platform.h"
+
+#include <limits>
+
+namespace rx
+{
+
+namespace
+{
+
+template <typename InT, typename OutT>
+void ConvertTypedIndices(const void *input, size_t first, size_t count, void *output, bool primitiveRestartEnabled,
+                         GLuint *inOutMin, GLuint *inOutMax)
+{
+    const InT *in = static_cast<const InT*>(input);
+    OutT *out = static_cast<OutT*>(output);
+
+    const InT restartIndex = std::numeric_limits<InT>::max();
+    GLuint minIndex = *inOutMin;
+    GLuint maxIndex = *inOutMax;
+
+    for (size_t i = first; i < count; i++)
+    {
+        if (primitiveRestartEnabled && in[i] == restartIndex)
+        {
+            out[i] = std::numeric_limits<OutT>::max();
+        }
+        else
+        {
+            out[i] = in[i];
+            if (minIndex > in[i]) minIndex = in[i];
+            if (maxIndex < in[i]) maxIndex = in[i];
+        }
+    }
+
+    *inOutMin = minIndex;
+    *inOutMax = maxIndex;
+}
+
+}
+
+RangeUI ConvertIndices(GLenum sourceType, GLenum destinationType, const void *input, size_t count,
+                       void *output, bool primitiveRestartEnabled)
+{
+    GLuint minIndex = std::numeric_limits<GLuint>::max();
+    GLuint maxIndex = 0;
+    size_t first = 0;
+
+#if defined(ANGLE_USE_SSE)
+    if (gl::supportsSSE2())
+    {
+        first = ConvertIndices_SSE2(sourceType, destinationType, input, count, output, primitiveRestartEnabled,
+                                    &minIndex, &maxIndex);
+    }
+#endif
+
+    switch (sourceType)
+    {
+      case GL_UNSIGNED_BYTE:
+        ASSERT(destinationType == GL_UNSIGNED_SHORT);
+        ConvertTypedIndices<GLubyte, GLushort>(input, first, count, output, primitiveRestartEnabled, &minIndex, &maxIndex);
+        break;
+      case GL_UNSIGNED_SHORT:
+        if (destinationType == GL_UNSIGNED_SHORT)
+        {
+            ConvertTypedIndices<GLushort, GLushort>(input, first, count, output, primitiveRestartEnabled, &minIndex, &maxIndex);
+        }
+        else
+        {
+            ASSERT(destinationType == GL_UNSIGNED_INT);
+            ConvertTypedIndices<GLushort, GLuint>(input, first, count, output, primitiveRestartEnabled, &minIndex, &maxIndex);
+        }
+        break;
+      case GL_UNSIGNED_INT:
+        ASSERT(destinationType == GL_UNSIGNED_INT);
+        ConvertTypedIndices<GLuint, GLuint>(input, first, count, output, primitiveRestartEnabled, &minIndex, &maxIndex);
+        break;
+      default:
+        UNREACHABLE();
+    }
+
+    // Nothing is drawn from indices that are all restart indices
+    return (minIndex <= maxIndex) ? RangeUI(minIndex, maxIndex) : RangeUI(0, 0);
+}
+
+}
@@ -0,0 +1,36 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// convertindices.h: Defines the functions that copy or widen indices into an index buffer, finding
+// the range of the indices in the same pass.
+
+#ifndef LIBANGLE_RENDERER_D3D_CONVERTINDICES_H_
+#define LIBANGLE_RENDERER_D3D_CONVERTINDICES_H_
+
+#include "common/mathutil.h"
+
+#include "angle_gl.h"
+
+#include <cstddef>
+
+namespace rx
+{
+
+// Converts count indices of sourceType to destinationType, which is either the same type or, for
+// byte and short indices, the next wider one, and returns the range of the indices. With primitive
+// restart enabled, widened restart indices keep the restart value of the destination type, and
+// restart indices are left out of the range as IndexRangeCache::ComputeRange leaves them out.
+RangeUI ConvertIndices(GLenum sourceType, GLenum destinationType, const void *input, size_t count,
+                       void *output, bool primitiveRestartEnabled);
+
+// Converts as many groups of indices as count allows, lowering *inOutMin and raising *inOutMax to
+// include them, and returns the number of indices converted; the caller converts the rest.
+size_t ConvertIndices_SSE2(GLenum sourceType, GLenum destinationType, const void *input, size_t count,
+                           void *output, bool primitiveRestartEnabled, GLuint *inOutMin, GLuint *inOutMax);
+
+}
+
+#endif // LIBANGLE_RENDERER_D3D_CONVERTINDICES_H_
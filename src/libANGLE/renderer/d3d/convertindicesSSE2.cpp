@@ -0,0 +1,179 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// convertindicesSSE2.cpp: Defines the SSE2 loops used by ConvertIndices. It's in a separated file
+// for GCC, which can enable SSE usage only per-file, not for code blocks that use SSE2 explicitly.
+
+#include "libANGLE/renderer/d3d/convertindices.h"
+
+#include "common/debug.h"
+#include "common/platform.h"
+
+#include <algorithm>
+
+#ifdef ANGLE_USE_SSE
+#include <emmintrin.h>
+#endif
+
+namespace rx
+{
+
+#if defined(ANGLE_USE_SSE)
+namespace
+{
+
+// Selects the lanes of a that are set in mask, and the other lanes of b.
+inline __m128i Select(const __m128i &mask, const __m128i &a, const __m128i &b)
+{
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+// Folds the lanes of the running minimum and maximum into the caller's range. Restart indices
+// never lower the minimum, being the largest value of their type, and are masked out of the
+// maximum; if only restart indices were seen, the minimum ends up above the maximum.
+template <typename T>
+void FoldRange(const __m128i &minimum, const __m128i &maximum, T flip, GLuint *inOutMin, GLuint *inOutMax)
+{
+    const size_t laneCount = sizeof(__m128i) / sizeof(T);
+    T minimumLanes[laneCount];
+    T maximumLanes[laneCount];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(minimumLanes), minimum);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(maximumLanes), maximum);
+
+    for (size_t i = 0; i < laneCount; i++)
+    {
+        *inOutMin = std::min<GLuint>(*inOutMin, static_cast<T>(minimumLanes[i] ^ flip));
+        *inOutMax = std::max<GLuint>(*inOutMax, static_cast<T>(maximumLanes[i] ^ flip));
+    }
+}
+
+size_t ConvertBytesToShorts(const GLubyte *input, size_t count, GLushort *output, bool primitiveRestartEnabled,
+                            GLuint *inOutMin, GLuint *inOutMax)
+{
+    const __m128i ones = _mm_set1_epi8(-1);
+    __m128i minimum = ones;
+    __m128i maximum = _mm_setzero_si128();
+
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        __m128i indices = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+        __m128i restarts = primitiveRestartEnabled ? _mm_cmpeq_epi8(indices, ones) : _mm_setzero_si128();
+
+        minimum = _mm_min_epu8(minimum, indices);
+        maximum = _mm_max_epu8(maximum, _mm_andnot_si128(restarts, indices));
+
+        // Restart bytes are paired with 0xFF high bytes, making them the 16-bit restart index
+        __m128i *dest = reinterpret_cast<__m128i*>(output + i);
+        _mm_storeu_si128(dest + 0, _mm_unpacklo_epi8(indices, restarts));
+        _mm_storeu_si128(dest + 1, _mm_unpackhi_epi8(indices, restarts));
+    }
+
+    FoldRange<GLubyte>(minimum, maximum, 0, inOutMin, inOutMax);
+    return i;
+}
+
+// SSE2 only compares signed 16-bit lanes, so the indices are compared with their top bit flipped.
+template <bool widen>
+size_t ConvertShorts(const GLushort *input, size_t count, void *output, bool primitiveRestartEnabled,
+                     GLuint *inOutMin, GLuint *inOutMax)
+{
+    const __m128i ones = _mm_set1_epi16(-1);
+    const __m128i flip = _mm_set1_epi16(static_cast<short>(0x8000));
+    __m128i minimum = _mm_set1_epi16(0x7FFF);
+    __m128i maximum = flip;
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i indices = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+        __m128i restarts = primitiveRestartEnabled ? _mm_cmpeq_epi16(indices, ones) : _mm_setzero_si128();
+
+        minimum = _mm_min_epi16(minimum, _mm_xor_si128(indices, flip));
+        maximum = _mm_max_epi16(maximum, _mm_xor_si128(_mm_andnot_si128(restarts, indices), flip));
+
+        if (widen)
+        {
+            __m128i *dest = reinterpret_cast<__m128i*>(static_cast<GLuint*>(output) + i);
+            _mm_storeu_si128(dest + 0, _mm_unpacklo_epi16(indices, restarts));
+            _mm_storeu_si128(dest + 1, _mm_unpackhi_epi16(indices, restarts));
+        }
+        else
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(static_cast<GLushort*>(output) + i), indices);
+        }
+    }
+
+    FoldRange<GLushort>(minimum, maximum, 0x8000, inOutMin, inOutMax);
+    return i;
+}
+
+// SSE2 has no 32-bit minimum or maximum, so they are selected after a signed comparison of the
+// indices with their top bit flipped.
+size_t CopyInts(const GLuint *input, size_t count, GLuint *output, bool primitiveRestartEnabled,
+                GLuint *inOutMin, GLuint *inOutMax)
+{
+    const __m128i ones = _mm_set1_epi32(-1);
+    const __m128i flip = _mm_set1_epi32(static_cast<int>(0x80000000u));
+    __m128i minimum = _mm_set1_epi32(0x7FFFFFFF);
+    __m128i maximum = flip;
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i indices = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+        __m128i restarts = primitiveRestartEnabled ? _mm_cmpeq_epi32(indices, ones) : _mm_setzero_si128();
+
+        __m128i flipped = _mm_xor_si128(indices, flip);
+        minimum = Select(_mm_cmplt_epi32(flipped, minimum), flipped, minimum);
+
+        __m128i flippedValid = _mm_xor_si128(_mm_andnot_si128(restarts, indices), flip);
+        maximum = Select(_mm_cmpgt_epi32(flippedValid, maximum), flippedValid, maximum);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), indices);
+    }
+
+    FoldRange<GLuint>(minimum, maximum, 0x80000000u, inOutMin, inOutMax);
+    return i;
+}
+
+}
+#endif // ANGLE_USE_SSE
+
+size_t ConvertIndices_SSE2(GLenum sourceType, GLenum destinationType, const void *input, size_t count,
+                           void *output, bool primitiveRestartEnabled, GLuint *inOutMin, GLuint *inOutMax)
+{
+#if defined(ANGLE_USE_SSE)
+    switch (sourceType)
+    {
+      case GL_UNSIGNED_BYTE:
+        ASSERT(destinationType == GL_UNSIGNED_SHORT);
+        return ConvertBytesToShorts(static_cast<const GLubyte*>(input), count, static_cast<GLushort*>(output),
+                                    primitiveRestartEnabled, inOutMin, inOutMax);
+      case GL_UNSIGNED_SHORT:
+        if (destinationType == GL_UNSIGNED_INT)
+        {
+            return ConvertShorts<true>(static_cast<const GLushort*>(input), count, output, primitiveRestartEnabled,
+                                       inOutMin, inOutMax);
+        }
+        ASSERT(destinationType == GL_UNSIGNED_SHORT);
+        return ConvertShorts<false>(static_cast<const GLushort*>(input), count, output, primitiveRestartEnabled,
+                                    inOutMin, inOutMax);
+      case GL_UNSIGNED_INT:
+        ASSERT(destinationType == GL_UNSIGNED_INT);
+        return CopyInts(static_cast<const GLuint*>(input), count, static_cast<GLuint*>(output),
+                        primitiveRestartEnabled, inOutMin, inOutMax);
+      default:
+        UNREACHABLE();
+        return 0;
+    }
+#else
+    UNIMPLEMENTED();
+    return 0;
+#endif
+}
+
+}
@@ -0,0 +1,44 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// convertvertex.h: Defines the SSE2 vertex attribute conversions shared by the D3D9 and D3D11
+// vertex copy templates, which pick them at runtime for the component types they cover.
+
+#ifndef LIBANGLE_RENDERER_D3D_CONVERTVERTEX_H_
+#define LIBANGLE_RENDERER_D3D_CONVERTVERTEX_H_
+
+#include "angle_gl.h"
+
+#include <cstddef>
+#include <stdint.h>
+
+namespace rx
+{
+
+// Each function converts the componentCount components of count vertices, read every stride bytes
+// from input, to the same number of tightly packed output components. They handle tightly packed
+// input of any component count and strided input of 2 to 4 components, and return the number of
+// vertices converted, which is zero for the cases they don't handle; the caller converts the rest.
+// Results are bit-exact with the scalar conversions in copyvertex.inl and vertexconversion.h.
+
+// Converts 8, 16 or 32-bit integers to float. Normalized signed values map
+// x to (2x + 1) / (2 max + 1) and normalized unsigned values map x to x / max.
+size_t CopyIntegerTo32FVertexData_SSE2(size_t componentBytes, bool isSigned, bool normalized, size_t componentCount,
+                                       const uint8_t *input, size_t stride, size_t count, float *output);
+
+// Converts 16.16 fixed point to float.
+size_t Copy32FixedTo32FVertexData_SSE2(size_t componentCount, const uint8_t *input, size_t stride, size_t count,
+                                       float *output);
+
+// Widen signed bytes to shorts, either scaling the normalized range or keeping the integer value.
+size_t Copy8SnormTo16SnormVertexData_SSE2(size_t componentCount, const uint8_t *input, size_t stride, size_t count,
+                                          GLshort *output);
+size_t Copy8SintTo16SintVertexData_SSE2(size_t componentCount, const uint8_t *input, size_t stride, size_t count,
+                                        GLshort *output);
+
+}
+
+#endif // LIBANGLE_RENDERER_D3D_CONVERTVERTEX_H_
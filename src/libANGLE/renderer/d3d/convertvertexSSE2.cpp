@@ -0,0 +1,335 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// convertvertexSSE2.cpp: Defines the SSE2 vertex attribute conversions. It's in a separated file
+// for GCC, which can enable SSE usage only per-file, not for code blocks that use SSE2 explicitly.
+
+#include "libANGLE/renderer/d3d/convertvertex.h"
+
+#include "common/debug.h"
+#include "common/platform.h"
+
+#include <limits>
+#include <string.h>
+
+#ifdef ANGLE_USE_SSE
+#include <emmintrin.h>
+#endif
+
+namespace rx
+{
+
+#if defined(ANGLE_USE_SSE)
+namespace
+{
+
+// Loads size bytes into the low bytes of a register, without reading past them
+inline __m128i LoadBytes(const uint8_t *input, size_t size)
+{
+    switch (size)
+    {
+      case 2:
+        {
+            uint16_t bytes;
+            memcpy(&bytes, input, sizeof(bytes));
+            return _mm_cvtsi32_si128(bytes);
+        }
+      case 4:
+        {
+            int bytes;
+            memcpy(&bytes, input, sizeof(bytes));
+            return _mm_cvtsi32_si128(bytes);
+        }
+      case 8:
+        return _mm_loadl_epi64(reinterpret_cast<const __m128i*>(input));
+      default:
+        ASSERT(size == 16);
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(input));
+    }
+}
+
+// Converts the components of count vertices, four components at a time with convert4, or two at
+// a time with convert2 for strided two-component vertices. Returns the number of vertices done.
+// Strided three-component vertices also go through convert4, whose fourth component is read from
+// the padding or the next vertex and written over the next output vertex. That never reaches past
+// the last vertex, which is left to the caller.
+template <typename Converter>
+size_t ConvertVertices(const Converter &converter, size_t componentCount, const uint8_t *input, size_t stride,
+                       size_t count, typename Converter::OutputType *output)
+{
+    if (stride == componentCount * Converter::InputComponentBytes)
+    {
+        // Tightly packed vertices are one run of components, whatever their component count. The
+        // vertex left partly converted at the end is redone by the caller.
+        const size_t componentTotal = count * componentCount;
+        size_t j = 0;
+        for (; j + 4 <= componentTotal; j += 4)
+        {
+            converter.convert4(input + j * Converter::InputComponentBytes, output + j);
+        }
+        return j / componentCount;
+    }
+    else if (componentCount == 4)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            converter.convert4(input + i * stride, output + i * 4);
+        }
+        return count;
+    }
+    else if (componentCount == 3 && count > 0)
+    {
+        for (size_t i = 0; i + 1 < count; i++)
+        {
+            converter.convert4(input + i * stride, output + i * 3);
+        }
+        return count - 1;
+    }
+    else if (componentCount == 2)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            converter.convert2(input + i * stride, output + i * 2);
+        }
+        return count;
+    }
+
+    return 0;
+}
+
+template <size_t componentBytes, bool isSigned>
+struct IntegerComponentType;
+
+template <> struct IntegerComponentType<1, true>  { typedef GLbyte Type; };
+template <> struct IntegerComponentType<1, false> { typedef GLubyte Type; };
+template <> struct IntegerComponentType<2, true>  { typedef GLshort Type; };
+template <> struct IntegerComponentType<2, false> { typedef GLushort Type; };
+template <> struct IntegerComponentType<4, true>  { typedef GLint Type; };
+template <> struct IntegerComponentType<4, false> { typedef GLuint Type; };
+
+struct NoScale
+{
+    __m128 operator()(__m128 x) const { return x; }
+};
+
+// (2x + 1) / (2 max + 1), as the scalar code computes it
+struct SignedNormalizeScale
+{
+    explicit SignedNormalizeScale(float maxValue)
+        : mDivisor(_mm_set1_ps(1.0f / (2 * maxValue + 1)))
+    {
+    }
+
+    __m128 operator()(__m128 x) const
+    {
+        return _mm_mul_ps(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(2.0f)), _mm_set1_ps(1.0f)), mDivisor);
+    }
+
+    __m128 mDivisor;
+};
+
+// x / max, divided rather than multiplied by the reciprocal to round as the scalar code does
+struct UnsignedNormalizeScale
+{
+    explicit UnsignedNormalizeScale(float maxValue)
+        : mMax(_mm_set1_ps(maxValue))
+    {
+    }
+
+    __m128 operator()(__m128 x) const { return _mm_div_ps(x, mMax); }
+
+    __m128 mMax;
+};
+
+struct FixedScale
+{
+    __m128 operator()(__m128 x) const { return _mm_mul_ps(x, _mm_set1_ps(1.0f / (1 << 16))); }
+};
+
+template <size_t componentBytes, bool isSigned, typename Scale>
+class IntegerToFloat
+{
+  public:
+    typedef float OutputType;
+    static const size_t InputComponentBytes = componentBytes;
+
+    explicit IntegerToFloat(const Scale &scale)
+        : mScale(scale)
+    {
+    }
+
+    void convert4(const uint8_t *input, float *output) const
+    {
+        _mm_storeu_ps(output, convert(LoadBytes(input, 4 * componentBytes)));
+    }
+
+    void convert2(const uint8_t *input, float *output) const
+    {
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(output),
+                         _mm_castps_si128(convert(LoadBytes(input, 2 * componentBytes))));
+    }
+
+  private:
+    __m128 convert(__m128i x) const
+    {
+        const __m128i zero = _mm_setzero_si128();
+
+        if (componentBytes == 4 && !isSigned)
+        {
+            // SSE2 only converts signed integers. The two 16-bit halves convert exactly, and their
+            // sum rounds once, like the scalar conversion of the whole value.
+            __m128 high = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(x, 16)), _mm_set1_ps(65536.0f));
+            __m128 low = _mm_cvtepi32_ps(_mm_and_si128(x, _mm_set1_epi32(0xFFFF)));
+            return mScale(_mm_add_ps(high, low));
+        }
+
+        // Signed components are duplicated into the upper bytes of their lane, then shifted back
+        // down to sign extend them
+        if (componentBytes == 1)
+        {
+            x = _mm_unpacklo_epi8(x, isSigned ? x : zero);
+        }
+        if (componentBytes <= 2)
+        {
+            x = _mm_unpacklo_epi16(x, isSigned ? x : zero);
+        }
+        if (componentBytes < 4 && isSigned)
+        {
+            x = _mm_srai_epi32(x, 32 - 8 * componentBytes);
+        }
+
+        return mScale(_mm_cvtepi32_ps(x));
+    }
+
+    Scale mScale;
+};
+
+template <bool normalized>
+class ByteToShort
+{
+  public:
+    typedef GLshort OutputType;
+    static const size_t InputComponentBytes = 1;
+
+    void convert4(const uint8_t *input, GLshort *output) const
+    {
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(output), convert(LoadBytes(input, 4)));
+    }
+
+    void convert2(const uint8_t *input, GLshort *output) const
+    {
+        int shorts = _mm_cvtsi128_si32(convert(LoadBytes(input, 2)));
+        memcpy(output, &shorts, sizeof(shorts));
+    }
+
+  private:
+    __m128i convert(__m128i x) const
+    {
+        const __m128i zero = _mm_setzero_si128();
+
+        // Each 16-bit lane holds x << 8
+        __m128i shifted = _mm_unpacklo_epi8(zero, x);
+        __m128i value = _mm_srai_epi16(shifted, 8);
+        if (!normalized)
+        {
+            return value;
+        }
+
+        // Positive values also fill the low byte with x << 1 | x >> 6, so that 127 maps to 32767
+        __m128i low = _mm_or_si128(_mm_slli_epi16(value, 1),
+                                   _mm_srli_epi16(_mm_and_si128(value, _mm_set1_epi16(0x40)), 6));
+        __m128i positive = _mm_cmpgt_epi16(value, zero);
+        return _mm_or_si128(shifted, _mm_and_si128(positive, low));
+    }
+};
+
+template <size_t componentBytes, bool isSigned>
+size_t ConvertIntegersToFloat(bool normalized, size_t componentCount, const uint8_t *input, size_t stride,
+                              size_t count, float *output)
+{
+    typedef std::numeric_limits<typename IntegerComponentType<componentBytes, isSigned>::Type> NL;
+    const float maxValue = static_cast<float>(NL::max());
+
+    if (!normalized)
+    {
+        IntegerToFloat<componentBytes, isSigned, NoScale> converter((NoScale()));
+        return ConvertVertices(converter, componentCount, input, stride, count, output);
+    }
+    else if (isSigned)
+    {
+        IntegerToFloat<componentBytes, isSigned, SignedNormalizeScale> converter((SignedNormalizeScale(maxValue)));
+        return ConvertVertices(converter, componentCount, input, stride, count, output);
+    }
+    else
+    {
+        IntegerToFloat<componentBytes, isSigned, UnsignedNormalizeScale> converter((UnsignedNormalizeScale(maxValue)));
+        return ConvertVertices(converter, componentCount, input, stride, count, output);
+    }
+}
+
+}
+#endif // ANGLE_USE_SSE
+
+size_t CopyIntegerTo32FVertexData_SSE2(size_t componentBytes, bool isSigned, bool normalized, size_t componentCount,
+                                       const uint8_t *input, size_t stride, size_t count, float *output)
+{
+#if defined(ANGLE_USE_SSE)
+    switch (componentBytes)
+    {
+      case 1:
+        return isSigned ? ConvertIntegersToFloat<1, true>(normalized, componentCount, input, stride, count, output)
+                        : ConvertIntegersToFloat<1, false>(normalized, componentCount, input, stride, count, output);
+      case 2:
+        return isSigned ? ConvertIntegersToFloat<2, true>(normalized, componentCount, input, stride, count, output)
+                        : ConvertIntegersToFloat<2, false>(normalized, componentCount, input, stride, count, output);
+      case 4:
+        return isSigned ? ConvertIntegersToFloat<4, true>(normalized, componentCount, input, stride, count, output)
+                        : ConvertIntegersToFloat<4, false>(normalized, componentCount, input, stride, count, output);
+      default:
+        UNREACHABLE();
+        return 0;
+    }
+#else
+    UNIMPLEMENTED();
+    return 0;
+#endif
+}
+
+size_t Copy32FixedTo32FVertexData_SSE2(size_t componentCount, const uint8_t *input, size_t stride, size_t count,
+                                       float *output)
+{
+#if defined(ANGLE_USE_SSE)
+    IntegerToFloat<4, true, FixedScale> converter((FixedScale()));
+    return ConvertVertices(converter, componentCount, input, stride, count, output);
+#else
+    UNIMPLEMENTED();
+    return 0;
+#endif
+}
+
+size_t Copy8SnormTo16SnormVertexData_SSE2(size_t componentCount, const uint8_t *input, size_t stride, size_t count,
+                                          GLshort *output)
+{
+#if defined(ANGLE_USE_SSE)
+    return ConvertVertices(ByteToShort<true>(), componentCount, input, stride, count, output);
+#else
+    UNIMPLEMENTED();
+    return 0;
+#endif
+}
+
+size_t Copy8SintTo16SintVertexData_SSE2(size_t componentCount, const uint8_t *input, size_t stride, size_t count,
+                                        GLshort *output)
+{
+#if defined(ANGLE_USE_SSE)
+    return ConvertVertices(ByteToShort<false>(), componentCount, input, stride, count, output);
+#else
+    UNIMPLEMENTED();
+    return 0;
+#endif
+}
+
+}
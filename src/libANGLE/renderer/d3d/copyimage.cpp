@@ -1,5 +1,5 @@
 //
-// Copyright (c) 2013 The ANGLE Project Authors. All rights reserved.
+// Copyright (c) 2013-2015 The ANGLE Project Authors. All rights reserved.
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 //
@@ -8,15 +8,48 @@
 
 #include "libANGLE/renderer/d3d/copyimage.h"
 
+#include "common/platform.h"
+
 namespace rx
 {
 
-void CopyBGRA8ToRGBA8(const uint8_t *source, uint8_t *dest)
+namespace
+{
+
+void SwapRedBlue8(const uint8_t *source, uint8_t *dest, size_t count)
+{
+    size_t i = 0;
+
+#if defined(ANGLE_USE_SSE)
+    if (gl::supportsSSE2())
+    {
+        i = SwapRedBlue8_SSE2(source, dest, count);
+    }
+#endif
+
+    const uint32_t *sourcePixels = reinterpret_cast<const uint32_t*>(source);
+    uint32_t *destPixels = reinterpret_cast<uint32_t*>(dest);
+    for (; i < count; i++)
+    {
+        uint32_t argb = sourcePixels[i];
+        destPixels[i] = (argb & 0xFF00FF00) |       // Keep alpha and green
+                        (argb & 0x00FF0000) >> 16 | // Move red to blue
+                        (argb & 0x000000FF) << 16;  // Move blue to red
+    }
+}
+
+}
+
+template <>
+void CopyUnormPixels<B8G8R8A8, R8G8B8A8>(const uint8_t *source, uint8_t *dest, size_t count)
+{
+    SwapRedBlue8(source, dest, count);
+}
+
+template <>
+void CopyUnormPixels<R8G8B8A8, B8G8R8A8>(const uint8_t *source, uint8_t *dest, size_t count)
 {
-    uint32_t argb = *reinterpret_cast<const uint32_t*>(source);
-    *reinterpret_cast<uint32_t*>(dest) = (argb & 0xFF00FF00) |       // Keep alpha and green
-                                         (argb & 0x00FF0000) >> 16 | // Move red to blue
-                                         (argb & 0x000000FF) << 16;  // Move blue to red
+    SwapRedBlue8(source, dest, count);
 }
 
 }
@@ -1,5 +1,5 @@
 //
-// Copyright (c) 2013-2014 The ANGLE Project Authors. All rights reserved.
+// Copyright (c) 2013-2015 The ANGLE Project Authors. All rights reserved.
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 //
@@ -11,6 +11,7 @@
 
 #include "common/mathutil.h"
 #include "libANGLE/angletypes.h"
+#include "libANGLE/renderer/d3d/imageformats.h"
 
 #include <stdint.h>
 
@@ -26,7 +27,60 @@ void WriteColor(const uint8_t *source, uint8_t *dest);
 template <typename sourceType, typename destType, typename colorDataType>
 void CopyPixel(const uint8_t *source, uint8_t *dest);
 
-void CopyBGRA8ToRGBA8(const uint8_t *source, uint8_t *dest);
+// Describes the packing of formats whose channels are all unsigned normalized integers held in a
+// single little-endian word. A channel with zero bits is not stored by the format, and fillBits
+// are set in every written pixel (the X of B8G8R8X8).
+template <typename wordType,
+          unsigned int redBitCount, unsigned int redBitShift, unsigned int greenBitCount, unsigned int greenBitShift,
+          unsigned int blueBitCount, unsigned int blueBitShift, unsigned int alphaBitCount, unsigned int alphaBitShift,
+          wordType fillValue = 0>
+struct PackedUnormLayout
+{
+    typedef wordType WordType;
+
+    static const unsigned int redBits = redBitCount;
+    static const unsigned int redShift = redBitShift;
+    static const unsigned int greenBits = greenBitCount;
+    static const unsigned int greenShift = greenBitShift;
+    static const unsigned int blueBits = blueBitCount;
+    static const unsigned int blueShift = blueBitShift;
+    static const unsigned int alphaBits = alphaBitCount;
+    static const unsigned int alphaShift = alphaBitShift;
+    static const wordType fillBits = fillValue;
+};
+
+// Packing of the imageformats.h structures that CopyUnormPixels can convert between; the layouts
+// follow the member order of each structure.
+template <typename formatType>
+struct UnormLayout;
+
+template <> struct UnormLayout<R8G8B8A8>    : PackedUnormLayout<uint32_t,  8,  0,  8,  8,  8, 16,  8, 24> {};
+template <> struct UnormLayout<B8G8R8A8>    : PackedUnormLayout<uint32_t,  8, 16,  8,  8,  8,  0,  8, 24> {};
+template <> struct UnormLayout<B8G8R8X8>    : PackedUnormLayout<uint32_t,  8, 16,  8,  8,  8,  0,  0,  0, 0xFF000000> {};
+template <> struct UnormLayout<A8R8G8B8>    : PackedUnormLayout<uint32_t,  8,  8,  8, 16,  8, 24,  8,  0> {};
+template <> struct UnormLayout<R10G10B10A2> : PackedUnormLayout<uint32_t, 10,  0, 10, 10, 10, 20,  2, 30> {};
+template <> struct UnormLayout<R5G6B5>      : PackedUnormLayout<uint16_t,  5, 11,  6,  5,  5,  0,  0,  0> {};
+template <> struct UnormLayout<B5G5R5A1>    : PackedUnormLayout<uint16_t,  5, 10,  5,  5,  5,  0,  1, 15> {};
+template <> struct UnormLayout<R5G5B5A1>    : PackedUnormLayout<uint16_t,  5,  0,  5,  5,  5, 10,  1, 15> {};
+template <> struct UnormLayout<R4G4B4A4>    : PackedUnormLayout<uint16_t,  4,  0,  4,  4,  4,  8,  4, 12> {};
+template <> struct UnormLayout<B4G4R4A4>    : PackedUnormLayout<uint16_t,  4,  8,  4,  4,  4,  0,  4, 12> {};
+template <> struct UnormLayout<A4R4G4B4>    : PackedUnormLayout<uint16_t,  4,  4,  4,  8,  4, 12,  4,  0> {};
+
+// Copies a row of count pixels between two formats with a UnormLayout, rescaling each channel with
+// integer math. The results match CopyPixel through gl::ColorF exactly: channels missing from the
+// source read as zero, or as one for alpha.
+template <typename sourceType, typename destType>
+void CopyUnormPixels(const uint8_t *source, uint8_t *dest, size_t count);
+
+// Swapping red and blue converts BGRA8 to RGBA8 and back, which is done with SSE2 when available.
+template <>
+void CopyUnormPixels<B8G8R8A8, R8G8B8A8>(const uint8_t *source, uint8_t *dest, size_t count);
+template <>
+void CopyUnormPixels<R8G8B8A8, B8G8R8A8>(const uint8_t *source, uint8_t *dest, size_t count);
+
+// Swaps red and blue of as many whole groups of four RGBA8 or BGRA8 pixels as count allows.
+// Returns the number of pixels copied; the caller finishes the rest of the row.
+size_t SwapRedBlue8_SSE2(const uint8_t *source, uint8_t *dest, size_t count);
 
 }
 
@@ -1,5 +1,5 @@
 //
-// Copyright (c) 2014 The ANGLE Project Authors. All rights reserved.
+// Copyright (c) 2014-2015 The ANGLE Project Authors. All rights reserved.
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 //
@@ -24,9 +24,69 @@ inline void WriteColor(const uint8_t *source, uint8_t *dest)
 template <typename sourceType, typename destType, typename colorDataType>
 inline void CopyPixel(const uint8_t *source, uint8_t *dest)
 {
-    colorDataType temp;
-    ReadColor<sourceType, colorDataType>(source, &temp);
-    WriteColor<destType, colorDataType>(&temp, dest);
+    gl::Color<colorDataType> temp;
+    ReadColor<sourceType, colorDataType>(source, reinterpret_cast<uint8_t*>(&temp));
+    WriteColor<destType, colorDataType>(reinterpret_cast<const uint8_t*>(&temp), dest);
+}
+
+template <unsigned int sourceBits, unsigned int destBits>
+struct UnormChannel
+{
+    // Same rounding as floatToNormalized<destBits>(normalizedToFloat<sourceBits>(value))
+    static uint32_t rescale(uint32_t value)
+    {
+        const uint32_t sourceMax = (1u << sourceBits) - 1;
+        const uint32_t destMax = (1u << destBits) - 1;
+        return (value * destMax * 2 + sourceMax) / (sourceMax * 2);
+    }
+};
+
+template <unsigned int bits>
+struct UnormChannel<bits, bits>
+{
+    static uint32_t rescale(uint32_t value)
+    {
+        return value;
+    }
+};
+
+template <unsigned int sourceBits, unsigned int sourceShift, unsigned int destBits, unsigned int destShift, bool isAlpha>
+inline uint32_t ConvertUnormChannel(uint32_t source)
+{
+    if (destBits == 0)
+    {
+        return 0;
+    }
+    if (sourceBits == 0)
+    {
+        return isAlpha ? ((1u << destBits) - 1) << destShift : 0;
+    }
+
+    const uint32_t value = (source >> sourceShift) & ((1u << sourceBits) - 1);
+    return UnormChannel<(sourceBits > 0 ? sourceBits : 1), (destBits > 0 ? destBits : 1)>::rescale(value) << destShift;
+}
+
+template <typename sourceType, typename destType>
+inline void CopyUnormPixels(const uint8_t *source, uint8_t *dest, size_t count)
+{
+    typedef UnormLayout<sourceType> Source;
+    typedef UnormLayout<destType> Dest;
+    META_ASSERT(sizeof(typename Source::WordType) == sizeof(sourceType));
+    META_ASSERT(sizeof(typename Dest::WordType) == sizeof(destType));
+
+    const typename Source::WordType *sourceWords = reinterpret_cast<const typename Source::WordType*>(source);
+    typename Dest::WordType *destWords = reinterpret_cast<typename Dest::WordType*>(dest);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const uint32_t pixel = sourceWords[i];
+        destWords[i] = static_cast<typename Dest::WordType>(
+            Dest::fillBits |
+            ConvertUnormChannel<Source::redBits,   Source::redShift,   Dest::redBits,   Dest::redShift,   false>(pixel) |
+            ConvertUnormChannel<Source::greenBits, Source::greenShift, Dest::greenBits, Dest::greenShift, false>(pixel) |
+            ConvertUnormChannel<Source::blueBits,  Source::blueShift,  Dest::blueBits,  Dest::blueShift,  false>(pixel) |
+            ConvertUnormChannel<Source::alphaBits, Source::alphaShift, Dest::alphaBits, Dest::alphaShift, true>(pixel));
+    }
 }
 
 }
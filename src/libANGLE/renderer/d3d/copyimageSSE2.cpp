@@ -0,0 +1,47 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// copyimageSSE2.cpp: Defines the SSE2 row copies used by CopyUnormPixels. It's
+// in a separated file for GCC, which can enable SSE usage only per-file,
+// not for code blocks that use SSE2 explicitly.
+
+#include "libANGLE/renderer/d3d/copyimage.h"
+
+#include "common/platform.h"
+
+#ifdef ANGLE_USE_SSE
+#include <emmintrin.h>
+#endif
+
+namespace rx
+{
+
+size_t SwapRedBlue8_SSE2(const uint8_t *source, uint8_t *dest, size_t count)
+{
+#if defined(ANGLE_USE_SSE)
+    const __m128i keepMask = _mm_set1_epi32(0xFF00FF00);
+    const __m128i lowMask = _mm_set1_epi32(0x000000FF);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i * 4));
+
+        __m128i result = _mm_and_si128(pixels, keepMask);
+        result = _mm_or_si128(result, _mm_and_si128(_mm_srli_epi32(pixels, 16), lowMask));
+        result = _mm_or_si128(result, _mm_slli_epi32(_mm_and_si128(pixels, lowMask), 16));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i * 4), result);
+    }
+
+    return i;
+#else
+    UNIMPLEMENTED();
+    return 0;
+#endif
+}
+
+}
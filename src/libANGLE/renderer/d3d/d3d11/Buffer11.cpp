@@ -630,17 +630,8 @@ bool Buffer11::supportsDirectIndexBinding() const
 
 bool Buffer11::supportsDirectVertexBindingForAttrib(const gl::VertexAttribute &attrib)
 {
-    size_t attributeOffset = static_cast<size_t>(attrib.offset) % ComputeVertexAttributeStride(attrib);
-    AttribElement element = { attrib.type, attrib.size, ComputeVertexAttributeStride(attrib), attrib.normalized, attrib.pureInteger, attributeOffset };
-    StaticBufferIteratorType mapElement = mStaticVertexBufferForAttributeMap.find(element);
-
-    // If we've already created a StaticVertexBufferInterface for this attribute, then we return it
-    if (mapElement != mStaticVertexBufferForAttributeMap.end())
-    {
-        return true;
-    }
-
-    return false;
+    // If we've already created a StaticVertexBufferInterface for this attribute, the data is static
+    return (findStaticVertexBufferForAttribute(attrib) != NULL);
 }
 
 Buffer11::BufferStorage11::BufferStorage11(Renderer11 *renderer, BufferUsage usage)
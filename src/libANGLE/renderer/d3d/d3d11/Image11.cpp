@@ -13,6 +13,7 @@
 #include "libANGLE/renderer/d3d/d3d11/TextureStorage11.h"
 #include "libANGLE/renderer/d3d/d3d11/formatutils11.h"
 #include "libANGLE/renderer/d3d/d3d11/renderer11_utils.h"
+#include "libANGLE/renderer/d3d/generatemip.h"
 #include "libANGLE/Framebuffer.h"
 #include "libANGLE/FramebufferAttachment.h"
 #include "libANGLE/formatutils.h"
@@ -49,41 +50,50 @@ Image11 *Image11::makeImage11(ImageD3D *img)
     return static_cast<Image11*>(img);
 }
 
-gl::Error Image11::generateMipmap(Image11 *dest, Image11 *src)
+gl::Error Image11::generateMipmapChain(Image11 *const *levels, size_t levelCount)
 {
-    ASSERT(src->getDXGIFormat() == dest->getDXGIFormat());
-    ASSERT(src->getWidth() == 1 || src->getWidth() / 2 == dest->getWidth());
-    ASSERT(src->getHeight() == 1 || src->getHeight() / 2 == dest->getHeight());
+    ASSERT(levelCount > 0);
 
-    const d3d11::DXGIFormat &dxgiFormatInfo = d3d11::GetDXGIFormatInfo(src->getDXGIFormat());
+    const d3d11::DXGIFormat &dxgiFormatInfo = d3d11::GetDXGIFormatInfo(levels[0]->getDXGIFormat());
     ASSERT(dxgiFormatInfo.mipGenerationFunction != NULL);
 
-    D3D11_MAPPED_SUBRESOURCE destMapped;
-    gl::Error error = dest->map(D3D11_MAP_WRITE, &destMapped);
-    if (error.isError())
+    std::vector<MipChainLevel> chain(levelCount);
+    for (size_t level = 0; level < levelCount; level++)
     {
-        return error;
-    }
-
-    D3D11_MAPPED_SUBRESOURCE srcMapped;
-    error = src->map(D3D11_MAP_READ, &srcMapped);
-    if (error.isError())
-    {
-        dest->unmap();
-        return error;
-    }
+        Image11 *image = levels[level];
+        ASSERT(image->getDXGIFormat() == levels[0]->getDXGIFormat());
+        ASSERT(level == 0 || levels[level - 1]->getWidth() == 1 || levels[level - 1]->getWidth() / 2 == image->getWidth());
+        ASSERT(level == 0 || levels[level - 1]->getHeight() == 1 || levels[level - 1]->getHeight() / 2 == image->getHeight());
 
-    const uint8_t *sourceData = reinterpret_cast<const uint8_t*>(srcMapped.pData);
-    uint8_t *destData = reinterpret_cast<uint8_t*>(destMapped.pData);
+        D3D11_MAPPED_SUBRESOURCE mapped;
+        gl::Error error = image->map((level == 0) ? D3D11_MAP_READ : D3D11_MAP_WRITE, &mapped);
+        if (error.isError())
+        {
+            for (size_t mappedLevel = 0; mappedLevel < level; mappedLevel++)
+            {
+                levels[mappedLevel]->unmap();
+            }
+            return error;
+        }
 
-    dxgiFormatInfo.mipGenerationFunction(src->getWidth(), src->getHeight(), src->getDepth(),
-                                         sourceData, srcMapped.RowPitch, srcMapped.DepthPitch,
-                                         destData, destMapped.RowPitch, destMapped.DepthPitch);
+        chain[level].data = reinterpret_cast<uint8_t*>(mapped.pData);
+        chain[level].width = image->getWidth();
+        chain[level].height = image->getHeight();
+        chain[level].depth = image->getDepth();
+        chain[level].rowPitch = mapped.RowPitch;
+        chain[level].depthPitch = mapped.DepthPitch;
+    }
 
-    dest->unmap();
-    src->unmap();
+    GenerateMipChain(dxgiFormatInfo.mipGenerationFunction, chain.data(), chain.size());
 
-    dest->markDirty();
+    for (size_t level = 0; level < levelCount; level++)
+    {
+        levels[level]->unmap();
+        if (level > 0)
+        {
+            levels[level]->markDirty();
+        }
+    }
 
     return gl::Error(GL_NO_ERROR);
 }
@@ -275,6 +285,40 @@ gl::Error Image11::loadData(const gl::Box &area, const gl::PixelUnpackState &unp
     return gl::Error(GL_NO_ERROR);
 }
 
+gl::Error Image11::loadDataAsync(const gl::Box &area, const gl::PixelUnpackState &unpack, GLenum type, const void *input)
+{
+    const gl::InternalFormat &formatInfo = gl::GetInternalFormatInfo(mInternalFormat);
+    GLsizei inputRowPitch = formatInfo.computeRowPitch(type, area.width, unpack.alignment, unpack.rowLength);
+    GLsizei inputDepthPitch = formatInfo.computeDepthPitch(type, area.width, area.height, unpack.alignment, unpack.rowLength);
+    GLsizei inputRowBytes = formatInfo.computeRowPitch(type, area.width, 1, 0);
+
+    const d3d11::DXGIFormat &dxgiFormatInfo = d3d11::GetDXGIFormatInfo(mDXGIFormat);
+    GLuint outputPixelSize = dxgiFormatInfo.pixelBytes;
+
+    const d3d11::TextureFormat &d3dFormatInfo = d3d11::GetTextureFormatInfo(mInternalFormat, mFeatureLevel);
+    LoadImageFunction loadFunction = d3dFormatInfo.loadFunctions.at(type);
+
+    // Unmapped by finishAsyncLoad, once the workers are done
+    D3D11_MAPPED_SUBRESOURCE mappedImage;
+    gl::Error error = map(D3D11_MAP_WRITE, &mappedImage);
+    if (error.isError())
+    {
+        return error;
+    }
+
+    uint8_t *offsetMappedData = (reinterpret_cast<uint8_t*>(mappedImage.pData) + (area.y * mappedImage.RowPitch + area.x * outputPixelSize + area.z * mappedImage.DepthPitch));
+    mAsyncLoad.start(mRenderer->getScratchMemoryPool(), loadFunction, area.width, area.height, area.depth,
+                     reinterpret_cast<const uint8_t*>(input), inputRowPitch, inputDepthPitch, inputRowBytes,
+                     offsetMappedData, mappedImage.RowPitch, mappedImage.DepthPitch);
+
+    if (!mAsyncLoad.isPending())
+    {
+        unmap();
+    }
+
+    return gl::Error(GL_NO_ERROR);
+}
+
 gl::Error Image11::loadCompressedData(const gl::Box &area, const void *input)
 {
     const gl::InternalFormat &formatInfo = gl::GetInternalFormatInfo(mInternalFormat);
@@ -459,6 +503,8 @@ gl::Error Image11::copy(const gl::Offset &destOffset, const gl::Rectangle &sourc
 
 gl::Error Image11::getStagingTexture(ID3D11Resource **outStagingTexture, unsigned int *outSubresourceIndex)
 {
+    finishAsyncLoad();
+
     gl::Error error = createStagingTexture();
     if (error.isError())
     {
@@ -472,9 +518,19 @@ gl::Error Image11::getStagingTexture(ID3D11Resource **outStagingTexture, unsigne
 
 void Image11::releaseStagingTexture()
 {
+    finishAsyncLoad();
     SafeRelease(mStagingTexture);
 }
 
+void Image11::finishAsyncLoad()
+{
+    if (mAsyncLoad.isPending())
+    {
+        mAsyncLoad.wait();
+        unmap();
+    }
+}
+
 gl::Error Image11::createStagingTexture()
 {
     if (mStagingTexture)
@@ -11,6 +11,7 @@
 #define LIBANGLE_RENDERER_D3D_D3D11_IMAGE11_H_
 
 #include "libANGLE/renderer/d3d/ImageD3D.h"
+#include "libANGLE/renderer/d3d/ImageLoadTask.h"
 #include "libANGLE/ImageIndex.h"
 
 #include "common/debug.h"
@@ -33,7 +34,8 @@ class Image11 : public ImageD3D
 
     static Image11 *makeImage11(ImageD3D *img);
 
-    static gl::Error generateMipmap(Image11 *dest, Image11 *src);
+    // Generates levels 1 to levelCount - 1 from levels[0] on the CPU
+    static gl::Error generateMipmapChain(Image11 *const *levels, size_t levelCount);
 
     virtual bool isDirty() const;
 
@@ -44,6 +46,7 @@ class Image11 : public ImageD3D
     DXGI_FORMAT getDXGIFormat() const;
 
     virtual gl::Error loadData(const gl::Box &area, const gl::PixelUnpackState &unpack, GLenum type, const void *input);
+    virtual gl::Error loadDataAsync(const gl::Box &area, const gl::PixelUnpackState &unpack, GLenum type, const void *input);
     virtual gl::Error loadCompressedData(const gl::Box &area, const void *input);
 
     virtual gl::Error copy(const gl::Offset &destOffset, const gl::Rectangle &sourceArea, RenderTargetD3D *source);
@@ -67,6 +70,7 @@ class Image11 : public ImageD3D
     gl::Error getStagingTexture(ID3D11Resource **outStagingTexture, unsigned int *outSubresourceIndex);
     gl::Error createStagingTexture();
     void releaseStagingTexture();
+    void finishAsyncLoad();
 
     Renderer11 *mRenderer;
     D3D_FEATURE_LEVEL mFeatureLevel;
@@ -79,6 +83,9 @@ class Image11 : public ImageD3D
     TextureStorage11 *mAssociatedStorage;
     gl::ImageIndex mAssociatedImageIndex;
     unsigned int mRecoveredFromStorageCount;
+
+    // Writes into the staging texture, which stays mapped while the load is pending
+    ImageLoadTask mAsyncLoad;
 };
 
 }
@@ -28,6 +28,7 @@
 #include "libANGLE/renderer/d3d/TextureD3D.h"
 #include "libANGLE/renderer/d3d/TransformFeedbackD3D.h"
 #include "libANGLE/renderer/d3d/VertexDataManager.h"
+#include "libANGLE/renderer/d3d/primitiveindices.h"
 #include "libANGLE/renderer/d3d/d3d11/Blit11.h"
 #include "libANGLE/renderer/d3d/d3d11/Buffer11.h"
 #include "libANGLE/renderer/d3d/d3d11/Clear11.h"
@@ -1266,14 +1267,22 @@ gl::Error Renderer11::applyVertexBuffer(const gl::State &state, GLenum mode, GLi
     return mInputLayoutCache.applyVertexBuffers(attributes, mode, state.getProgram());
 }
 
-gl::Error Renderer11::applyIndexBuffer(const GLvoid *indices, gl::Buffer *elementArrayBuffer, GLsizei count, GLenum mode, GLenum type, TranslatedIndexData *indexInfo)
+gl::Error Renderer11::applyIndexBuffer(const GLvoid *indices, gl::Buffer *elementArrayBuffer, GLsizei count, GLenum mode, GLenum type,
+                                       bool primitiveRestartEnabled, TranslatedIndexData *indexInfo)
 {
-    gl::Error error = mIndexDataManager->prepareIndexData(type, count, elementArrayBuffer, indices, indexInfo);
+    gl::Error error = mIndexDataManager->prepareIndexData(type, count, elementArrayBuffer, indices, mode,
+                                                          primitiveRestartEnabled, indexInfo);
     if (error.isError())
     {
         return error;
     }
 
+    // Translating primitive restart indices can leave nothing to draw.
+    if (indexInfo->count == 0)
+    {
+        return gl::Error(GL_NO_ERROR);
+    }
+
     ID3D11Buffer *buffer = NULL;
     DXGI_FORMAT bufferFormat = (indexInfo->indexType == GL_UNSIGNED_INT) ? DXGI_FORMAT_R32_UINT : DXGI_FORMAT_R16_UINT;
 
@@ -1472,33 +1481,6 @@ gl::Error Renderer11::drawElements(GLenum mode, GLsizei count, GLenum type, cons
 
 gl::Error Renderer11::drawLineLoop(GLsizei count, GLenum type, const GLvoid *indices, int minIndex, gl::Buffer *elementArrayBuffer)
 {
-    // Get the raw indices for an indexed draw
-    if (type != GL_NONE && elementArrayBuffer)
-    {
-        BufferD3D *storage = GetImplAs<BufferD3D>(elementArrayBuffer);
-        intptr_t offset = reinterpret_cast<intptr_t>(indices);
-
-        const uint8_t *bufferData = NULL;
-        gl::Error error = storage->getData(&bufferData);
-        if (error.isError())
-        {
-            return error;
-        }
-
-        indices = bufferData + offset;
-    }
-
-    if (!mLineLoopIB)
-    {
-        mLineLoopIB = new StreamingIndexBufferInterface(this);
-        gl::Error error = mLineLoopIB->reserveBufferSpace(INITIAL_INDEX_BUFFER_SIZE, GL_UNSIGNED_INT);
-        if (error.isError())
-        {
-            SafeDelete(mLineLoopIB);
-            return error;
-        }
-    }
-
     // Checked by Renderer11::applyPrimitiveType
     ASSERT(count >= 0);
 
@@ -1507,87 +1489,84 @@ gl::Error Renderer11::drawLineLoop(GLsizei count, GLenum type, const GLvoid *ind
         return gl::Error(GL_OUT_OF_MEMORY, "Failed to create a 32-bit looping index buffer for GL_LINE_LOOP, too many indices required.");
     }
 
-    const unsigned int spaceNeeded = (static_cast<unsigned int>(count) + 1) * sizeof(unsigned int);
-    gl::Error error = mLineLoopIB->reserveBufferSpace(spaceNeeded, GL_UNSIGNED_INT);
-    if (error.isError())
-    {
-        return error;
-    }
+    const unsigned int indexCount = static_cast<unsigned int>(count) + 1;
 
-    void* mappedMemory = NULL;
-    unsigned int offset;
-    error = mLineLoopIB->mapBuffer(spaceNeeded, &mappedMemory, &offset);
+    IndexBufferInterface *indexBuffer = NULL;
+    unsigned int indexBufferOffset = 0;
+    gl::Error error = generatePrimitiveIndices(GL_LINE_LOOP, count, type, indices, elementArrayBuffer, indexCount,
+                                               &indexBuffer, &indexBufferOffset);
     if (error.isError())
     {
         return error;
     }
 
-    unsigned int *data = reinterpret_cast<unsigned int*>(mappedMemory);
-    unsigned int indexBufferOffset = offset;
+    applyGeneratedIndexBuffer(indexBuffer, indexBufferOffset);
 
-    switch (type)
+    mDeviceContext->DrawIndexed(indexCount, 0, -minIndex);
+
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error Renderer11::drawTriangleFan(GLsizei count, GLenum type, const GLvoid *indices, int minIndex, gl::Buffer *elementArrayBuffer, int instances)
+{
+    // Checked by Renderer11::applyPrimitiveType
+    ASSERT(count >= 3);
+
+    const unsigned int numTris = count - 2;
+
+    if (numTris > (std::numeric_limits<unsigned int>::max() / (sizeof(unsigned int) * 3)))
     {
-      case GL_NONE:   // Non-indexed draw
-        for (int i = 0; i < count; i++)
-        {
-            data[i] = i;
-        }
-        data[count] = 0;
-        break;
-      case GL_UNSIGNED_BYTE:
-        for (int i = 0; i < count; i++)
-        {
-            data[i] = static_cast<const GLubyte*>(indices)[i];
-        }
-        data[count] = static_cast<const GLubyte*>(indices)[0];
-        break;
-      case GL_UNSIGNED_SHORT:
-        for (int i = 0; i < count; i++)
-        {
-            data[i] = static_cast<const GLushort*>(indices)[i];
-        }
-        data[count] = static_cast<const GLushort*>(indices)[0];
-        break;
-      case GL_UNSIGNED_INT:
-        for (int i = 0; i < count; i++)
-        {
-            data[i] = static_cast<const GLuint*>(indices)[i];
-        }
-        data[count] = static_cast<const GLuint*>(indices)[0];
-        break;
-      default: UNREACHABLE();
+        return gl::Error(GL_OUT_OF_MEMORY, "Failed to create a scratch index buffer for GL_TRIANGLE_FAN, too many indices required.");
     }
 
-    error = mLineLoopIB->unmapBuffer();
+    const unsigned int indexCount = numTris * 3;
+
+    IndexBufferInterface *indexBuffer = NULL;
+    unsigned int indexBufferOffset = 0;
+    gl::Error error = generatePrimitiveIndices(GL_TRIANGLE_FAN, count, type, indices, elementArrayBuffer, indexCount,
+                                               &indexBuffer, &indexBufferOffset);
     if (error.isError())
     {
         return error;
     }
 
-    IndexBuffer11 *indexBuffer = IndexBuffer11::makeIndexBuffer11(mLineLoopIB->getIndexBuffer());
-    ID3D11Buffer *d3dIndexBuffer = indexBuffer->getBuffer();
-    DXGI_FORMAT indexFormat = indexBuffer->getIndexFormat();
+    applyGeneratedIndexBuffer(indexBuffer, indexBufferOffset);
 
-    if (mAppliedIB != d3dIndexBuffer || mAppliedIBFormat != indexFormat || mAppliedIBOffset != indexBufferOffset)
+    if (instances > 0)
     {
-        mDeviceContext->IASetIndexBuffer(d3dIndexBuffer, indexFormat, indexBufferOffset);
-        mAppliedIB = d3dIndexBuffer;
-        mAppliedIBFormat = indexFormat;
-        mAppliedIBOffset = indexBufferOffset;
+        mDeviceContext->DrawIndexedInstanced(indexCount, instances, 0, -minIndex, 0);
+    }
+    else
+    {
+        mDeviceContext->DrawIndexed(indexCount, 0, -minIndex);
     }
-
-    mDeviceContext->DrawIndexed(count + 1, 0, -minIndex);
 
     return gl::Error(GL_NO_ERROR);
 }
 
-gl::Error Renderer11::drawTriangleFan(GLsizei count, GLenum type, const GLvoid *indices, int minIndex, gl::Buffer *elementArrayBuffer, int instances)
+gl::Error Renderer11::generatePrimitiveIndices(GLenum mode, GLsizei count, GLenum type, const GLvoid *indices,
+                                               gl::Buffer *elementArrayBuffer, unsigned int indexCount,
+                                               IndexBufferInterface **outIndexBuffer, unsigned int *outOffset)
 {
+    ASSERT(mode == GL_LINE_LOOP || mode == GL_TRIANGLE_FAN);
+
+    StaticIndexBufferInterface *staticBuffer = NULL;
+
     // Get the raw indices for an indexed draw
     if (type != GL_NONE && elementArrayBuffer)
     {
         BufferD3D *storage = GetImplAs<BufferD3D>(elementArrayBuffer);
-        intptr_t offset = reinterpret_cast<intptr_t>(indices);
+        unsigned int offset = static_cast<unsigned int>(reinterpret_cast<uintptr_t>(indices));
+
+        // Static element array buffers keep the indices generated for each drawn range until
+        // their data changes.
+        staticBuffer = storage->getStaticPrimitiveIndexBuffer(mode, type, offset, count);
+        if (staticBuffer && staticBuffer->getBufferSize() != 0)
+        {
+            *outIndexBuffer = staticBuffer;
+            *outOffset = 0;
+            return gl::Error(GL_NO_ERROR);
+        }
 
         const uint8_t *bufferData = NULL;
         gl::Error error = storage->getData(&bufferData);
@@ -1599,110 +1578,70 @@ gl::Error Renderer11::drawTriangleFan(GLsizei count, GLenum type, const GLvoid *
         indices = bufferData + offset;
     }
 
-    if (!mTriangleFanIB)
+    IndexBufferInterface *indexBuffer = staticBuffer;
+    if (!indexBuffer)
     {
-        mTriangleFanIB = new StreamingIndexBufferInterface(this);
-        gl::Error error = mTriangleFanIB->reserveBufferSpace(INITIAL_INDEX_BUFFER_SIZE, GL_UNSIGNED_INT);
-        if (error.isError())
+        StreamingIndexBufferInterface *&streamingBuffer = (mode == GL_LINE_LOOP) ? mLineLoopIB : mTriangleFanIB;
+        if (!streamingBuffer)
         {
-            SafeDelete(mTriangleFanIB);
-            return error;
+            streamingBuffer = new StreamingIndexBufferInterface(this);
+            gl::Error error = streamingBuffer->reserveBufferSpace(INITIAL_INDEX_BUFFER_SIZE, GL_UNSIGNED_INT);
+            if (error.isError())
+            {
+                SafeDelete(streamingBuffer);
+                return error;
+            }
         }
+        indexBuffer = streamingBuffer;
     }
 
-    // Checked by Renderer11::applyPrimitiveType
-    ASSERT(count >= 3);
-
-    const unsigned int numTris = count - 2;
-
-    if (numTris > (std::numeric_limits<unsigned int>::max() / (sizeof(unsigned int) * 3)))
-    {
-        return gl::Error(GL_OUT_OF_MEMORY, "Failed to create a scratch index buffer for GL_TRIANGLE_FAN, too many indices required.");
-    }
-
-    const unsigned int spaceNeeded = (numTris * 3) * sizeof(unsigned int);
-    gl::Error error = mTriangleFanIB->reserveBufferSpace(spaceNeeded, GL_UNSIGNED_INT);
+    const unsigned int spaceNeeded = indexCount * sizeof(unsigned int);
+    gl::Error error = indexBuffer->reserveBufferSpace(spaceNeeded, GL_UNSIGNED_INT);
     if (error.isError())
     {
         return error;
     }
 
-    void* mappedMemory = NULL;
-    unsigned int offset;
-    error = mTriangleFanIB->mapBuffer(spaceNeeded, &mappedMemory, &offset);
+    void *mappedMemory = NULL;
+    error = indexBuffer->mapBuffer(spaceNeeded, &mappedMemory, outOffset);
     if (error.isError())
     {
         return error;
     }
 
-    unsigned int *data = reinterpret_cast<unsigned int*>(mappedMemory);
-    unsigned int indexBufferOffset = offset;
-
-    switch (type)
+    GLuint *data = reinterpret_cast<GLuint*>(mappedMemory);
+    if (mode == GL_LINE_LOOP)
     {
-      case GL_NONE:   // Non-indexed draw
-        for (unsigned int i = 0; i < numTris; i++)
-        {
-            data[i*3 + 0] = 0;
-            data[i*3 + 1] = i + 1;
-            data[i*3 + 2] = i + 2;
-        }
-        break;
-      case GL_UNSIGNED_BYTE:
-        for (unsigned int i = 0; i < numTris; i++)
-        {
-            data[i*3 + 0] = static_cast<const GLubyte*>(indices)[0];
-            data[i*3 + 1] = static_cast<const GLubyte*>(indices)[i + 1];
-            data[i*3 + 2] = static_cast<const GLubyte*>(indices)[i + 2];
-        }
-        break;
-      case GL_UNSIGNED_SHORT:
-        for (unsigned int i = 0; i < numTris; i++)
-        {
-            data[i*3 + 0] = static_cast<const GLushort*>(indices)[0];
-            data[i*3 + 1] = static_cast<const GLushort*>(indices)[i + 1];
-            data[i*3 + 2] = static_cast<const GLushort*>(indices)[i + 2];
-        }
-        break;
-      case GL_UNSIGNED_INT:
-        for (unsigned int i = 0; i < numTris; i++)
-        {
-            data[i*3 + 0] = static_cast<const GLuint*>(indices)[0];
-            data[i*3 + 1] = static_cast<const GLuint*>(indices)[i + 1];
-            data[i*3 + 2] = static_cast<const GLuint*>(indices)[i + 2];
-        }
-        break;
-      default: UNREACHABLE();
+        GenerateLineLoopIndices(type, indices, count, data);
+    }
+    else
+    {
+        GenerateTriangleFanIndices(type, indices, count, data);
     }
 
-    error = mTriangleFanIB->unmapBuffer();
+    error = indexBuffer->unmapBuffer();
     if (error.isError())
     {
         return error;
     }
 
-    IndexBuffer11 *indexBuffer = IndexBuffer11::makeIndexBuffer11(mTriangleFanIB->getIndexBuffer());
-    ID3D11Buffer *d3dIndexBuffer = indexBuffer->getBuffer();
-    DXGI_FORMAT indexFormat = indexBuffer->getIndexFormat();
+    *outIndexBuffer = indexBuffer;
+    return gl::Error(GL_NO_ERROR);
+}
 
-    if (mAppliedIB != d3dIndexBuffer || mAppliedIBFormat != indexFormat || mAppliedIBOffset != indexBufferOffset)
+void Renderer11::applyGeneratedIndexBuffer(IndexBufferInterface *indexBuffer, unsigned int offset)
+{
+    IndexBuffer11 *indexBuffer11 = IndexBuffer11::makeIndexBuffer11(indexBuffer->getIndexBuffer());
+    ID3D11Buffer *d3dIndexBuffer = indexBuffer11->getBuffer();
+    DXGI_FORMAT indexFormat = indexBuffer11->getIndexFormat();
+
+    if (mAppliedIB != d3dIndexBuffer || mAppliedIBFormat != indexFormat || mAppliedIBOffset != offset)
     {
-        mDeviceContext->IASetIndexBuffer(d3dIndexBuffer, indexFormat, indexBufferOffset);
+        mDeviceContext->IASetIndexBuffer(d3dIndexBuffer, indexFormat, offset);
         mAppliedIB = d3dIndexBuffer;
         mAppliedIBFormat = indexFormat;
-        mAppliedIBOffset = indexBufferOffset;
-    }
-
-    if (instances > 0)
-    {
-        mDeviceContext->DrawIndexedInstanced(numTris * 3, instances, 0, -minIndex, 0);
-    }
-    else
-    {
-        mDeviceContext->DrawIndexed(numTris * 3, 0, -minIndex);
+        mAppliedIBOffset = offset;
     }
-
-    return gl::Error(GL_NO_ERROR);
 }
 
 gl::Error Renderer11::applyShaders(gl::Program *program, const gl::VertexFormat inputLayout[], const gl::Framebuffer *framebuffer,
@@ -1776,31 +1715,8 @@ gl::Error Renderer11::applyShaders(gl::Program *program, const gl::VertexFormat
     return gl::Error(GL_NO_ERROR);
 }
 
-gl::Error Renderer11::applyUniforms(const ProgramImpl &program, const std::vector<gl::LinkedUniform*> &uniformArray)
+gl::Error Renderer11::applyUniforms(const ProgramImpl &program)
 {
-    unsigned int totalRegisterCountVS = 0;
-    unsigned int totalRegisterCountPS = 0;
-
-    bool vertexUniformsDirty = false;
-    bool pixelUniformsDirty = false;
-
-    for (size_t uniformIndex = 0; uniformIndex < uniformArray.size(); uniformIndex++)
-    {
-        const gl::LinkedUniform &uniform = *uniformArray[uniformIndex];
-
-        if (uniform.isReferencedByVertexShader() && !uniform.isSampler())
-        {
-            totalRegisterCountVS += uniform.registerCount;
-            vertexUniformsDirty = (vertexUniformsDirty || uniform.dirty);
-        }
-
-        if (uniform.isReferencedByFragmentShader() && !uniform.isSampler())
-        {
-            totalRegisterCountPS += uniform.registerCount;
-            pixelUniformsDirty = (pixelUniformsDirty || uniform.dirty);
-        }
-    }
-
     const ProgramD3D *programD3D = GetAs<ProgramD3D>(&program);
     const UniformStorage11 *vertexUniformStorage = UniformStorage11::makeUniformStorage11(&programD3D->getVertexUniformStorage());
     const UniformStorage11 *fragmentUniformStorage = UniformStorage11::makeUniformStorage11(&programD3D->getFragmentUniformStorage());
@@ -1810,57 +1726,24 @@ gl::Error Renderer11::applyUniforms(const ProgramImpl &program, const std::vecto
     ID3D11Buffer *vertexConstantBuffer = vertexUniformStorage->getConstantBuffer();
     ID3D11Buffer *pixelConstantBuffer = fragmentUniformStorage->getConstantBuffer();
 
-    float (*mapVS)[4] = NULL;
-    float (*mapPS)[4] = NULL;
-
-    if (totalRegisterCountVS > 0 && vertexUniformsDirty)
+    // The constant buffers are mapped with WRITE_DISCARD, so a dirty stage uploads its whole staging block.
+    if (vertexConstantBuffer && vertexUniformStorage->isDirty())
     {
         D3D11_MAPPED_SUBRESOURCE map = {0};
         HRESULT result = mDeviceContext->Map(vertexConstantBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &map);
         UNUSED_ASSERTION_VARIABLE(result);
         ASSERT(SUCCEEDED(result));
-        mapVS = (float(*)[4])map.pData;
+        memcpy(map.pData, vertexUniformStorage->getRegisterData(), vertexUniformStorage->size());
+        mDeviceContext->Unmap(vertexConstantBuffer, 0);
     }
 
-    if (totalRegisterCountPS > 0 && pixelUniformsDirty)
+    if (pixelConstantBuffer && fragmentUniformStorage->isDirty())
     {
         D3D11_MAPPED_SUBRESOURCE map = {0};
         HRESULT result = mDeviceContext->Map(pixelConstantBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &map);
         UNUSED_ASSERTION_VARIABLE(result);
         ASSERT(SUCCEEDED(result));
-        mapPS = (float(*)[4])map.pData;
-    }
-
-    for (size_t uniformIndex = 0; uniformIndex < uniformArray.size(); uniformIndex++)
-    {
-        gl::LinkedUniform *uniform = uniformArray[uniformIndex];
-
-        if (!uniform->isSampler())
-        {
-            unsigned int componentCount = (4 - uniform->registerElement);
-
-            // we assume that uniforms from structs are arranged in struct order in our uniforms list. otherwise we would
-            // overwrite previously written regions of memory.
-
-            if (uniform->isReferencedByVertexShader() && mapVS)
-            {
-                memcpy(&mapVS[uniform->vsRegisterIndex][uniform->registerElement], uniform->data, uniform->registerCount * sizeof(float) * componentCount);
-            }
-
-            if (uniform->isReferencedByFragmentShader() && mapPS)
-            {
-                memcpy(&mapPS[uniform->psRegisterIndex][uniform->registerElement], uniform->data, uniform->registerCount * sizeof(float) * componentCount);
-            }
-        }
-    }
-
-    if (mapVS)
-    {
-        mDeviceContext->Unmap(vertexConstantBuffer, 0);
-    }
-
-    if (mapPS)
-    {
+        memcpy(map.pData, fragmentUniformStorage->getRegisterData(), fragmentUniformStorage->size());
         mDeviceContext->Unmap(pixelConstantBuffer, 0);
     }
 
@@ -2954,11 +2837,14 @@ ImageD3D *Renderer11::createImage()
     return new Image11(this);
 }
 
-gl::Error Renderer11::generateMipmap(ImageD3D *dest, ImageD3D *src)
+gl::Error Renderer11::generateMipmapChain(ImageD3D *const *levels, size_t levelCount)
 {
-    Image11 *dest11 = Image11::makeImage11(dest);
-    Image11 *src11 = Image11::makeImage11(src);
-    return Image11::generateMipmap(dest11, src11);
+    std::vector<Image11*> levels11(levelCount);
+    for (size_t level = 0; level < levelCount; level++)
+    {
+        levels11[level] = Image11::makeImage11(levels[level]);
+    }
+    return Image11::generateMipmapChain(levels11.data(), levels11.size());
 }
 
 TextureStorage *Renderer11::createTextureStorage2D(SwapChainD3D *swapChain)
@@ -3155,16 +3041,10 @@ gl::Error Renderer11::packPixels(ID3D11Texture2D *readTexture, const PackPixelsP
 
         if (fastCopyFunc)
         {
-            // Fast copy is possible through some special function
+            // Fast copy is possible through some special function, one row at a time
             for (int y = 0; y < params.area.height; y++)
             {
-                for (int x = 0; x < params.area.width; x++)
-                {
-                    uint8_t *dest = pixelsOut + params.offset + y * params.outputPitch + x * destFormatInfo.pixelBytes;
-                    const uint8_t *src = source + y * inputPitch + x * sourceFormatInfo.pixelBytes;
-
-                    fastCopyFunc(src, dest);
-                }
+                fastCopyFunc(source + y * inputPitch, pixelsOut + params.offset + y * params.outputPitch, params.area.width);
             }
         }
         else
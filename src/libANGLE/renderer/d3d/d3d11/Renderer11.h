@@ -32,6 +32,7 @@ namespace rx
 
 class VertexDataManager;
 class IndexDataManager;
+class IndexBufferInterface;
 class StreamingIndexBufferInterface;
 class Blit11;
 class Clear11;
@@ -85,9 +86,10 @@ class Renderer11 : public RendererD3D
     virtual gl::Error applyShaders(gl::Program *program, const gl::VertexFormat inputLayout[], const gl::Framebuffer *framebuffer,
                                    bool rasterizerDiscard, bool transformFeedbackActive);
 
-    virtual gl::Error applyUniforms(const ProgramImpl &program, const std::vector<gl::LinkedUniform*> &uniformArray);
+    virtual gl::Error applyUniforms(const ProgramImpl &program);
     virtual gl::Error applyVertexBuffer(const gl::State &state, GLenum mode, GLint first, GLsizei count, GLsizei instances);
-    virtual gl::Error applyIndexBuffer(const GLvoid *indices, gl::Buffer *elementArrayBuffer, GLsizei count, GLenum mode, GLenum type, TranslatedIndexData *indexInfo);
+    virtual gl::Error applyIndexBuffer(const GLvoid *indices, gl::Buffer *elementArrayBuffer, GLsizei count, GLenum mode, GLenum type,
+                                       bool primitiveRestartEnabled, TranslatedIndexData *indexInfo);
     void applyTransformFeedbackBuffers(const gl::State &state) override;
 
     gl::Error drawArrays(const gl::Data &data, GLenum mode, GLsizei count, GLsizei instances, bool usesPointSize) override;
@@ -152,7 +154,7 @@ class Renderer11 : public RendererD3D
 
     // Image operations
     virtual ImageD3D *createImage();
-    gl::Error generateMipmap(ImageD3D *dest, ImageD3D *source) override;
+    gl::Error generateMipmapChain(ImageD3D *const *levels, size_t levelCount) override;
     virtual TextureStorage *createTextureStorage2D(SwapChainD3D *swapChain);
     virtual TextureStorage *createTextureStorage2D(GLenum internalformat, bool renderTarget, GLsizei width, GLsizei height, int levels, bool hintLevelZeroOnly);
     virtual TextureStorage *createTextureStorageCube(GLenum internalformat, bool renderTarget, int size, int levels, bool hintLevelZeroOnly);
@@ -223,6 +225,10 @@ class Renderer11 : public RendererD3D
 
     gl::Error drawLineLoop(GLsizei count, GLenum type, const GLvoid *indices, int minIndex, gl::Buffer *elementArrayBuffer);
     gl::Error drawTriangleFan(GLsizei count, GLenum type, const GLvoid *indices, int minIndex, gl::Buffer *elementArrayBuffer, int instances);
+    gl::Error generatePrimitiveIndices(GLenum mode, GLsizei count, GLenum type, const GLvoid *indices,
+                                       gl::Buffer *elementArrayBuffer, unsigned int indexCount,
+                                       IndexBufferInterface **outIndexBuffer, unsigned int *outOffset);
+    void applyGeneratedIndexBuffer(IndexBufferInterface *indexBuffer, unsigned int offset);
 
     ID3D11Texture2D *resolveMultisampledTexture(ID3D11Texture2D *source, unsigned int subresource);
     void unsetConflictingSRVs(gl::SamplerType shaderType, uintptr_t resource, const gl::ImageIndex *index);
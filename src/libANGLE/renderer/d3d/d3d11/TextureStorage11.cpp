@@ -11,7 +11,7 @@
 
 #include <tuple>
 
-#include "common/MemoryBuffer.h"
+#include "common/ScratchMemoryPool.h"
 #include "common/utilities.h"
 #include "libANGLE/ImageIndex.h"
 #include "libANGLE/formatutils.h"
@@ -23,6 +23,9 @@
 #include "libANGLE/renderer/d3d/d3d11/SwapChain11.h"
 #include "libANGLE/renderer/d3d/d3d11/formatutils11.h"
 #include "libANGLE/renderer/d3d/d3d11/renderer11_utils.h"
+#include "libANGLE/renderer/d3d/loadimage.h"
+
+#include "third_party/trace_event/trace_event.h"
 
 namespace rx
 {
@@ -556,23 +559,41 @@ gl::Error TextureStorage11::setData(const gl::ImageIndex &index, ImageD3D *image
     const d3d11::DXGIFormat &dxgiFormatInfo = d3d11::GetDXGIFormatInfo(d3d11Format.texFormat);
 
     size_t outputPixelSize = dxgiFormatInfo.pixelBytes;
+    LoadImageFunction loadFunction = d3d11Format.loadFunctions.at(type);
 
-    UINT bufferRowPitch = outputPixelSize * width;
-    UINT bufferDepthPitch = bufferRowPitch * height;
+    // Data that is already in the layout of the texture is handed to the device as it is, with the
+    // row and depth pitches of the unpack state. Anything else is converted into scratch memory first.
+    const uint8_t *data = pixelData;
+    UINT dataRowPitch = srcRowPitch;
+    UINT dataDepthPitch = srcDepthPitch;
+    bool conversionFree = IsLoadToNative(loadFunction) &&
+                          internalFormatInfo.computeRowPitch(type, width, 1, 0) == outputPixelSize * width;
+    ScratchMemoryLease conversionBuffer;
 
-    size_t neededSize = bufferDepthPitch * depth;
-    MemoryBuffer *conversionBuffer = NULL;
-    error = mRenderer->getScratchMemoryBuffer(neededSize, &conversionBuffer);
-    if (error.isError())
+    if (!conversionFree)
     {
-        return error;
+        UINT bufferRowPitch = outputPixelSize * width;
+        UINT bufferDepthPitch = bufferRowPitch * height;
+
+        size_t neededSize = bufferDepthPitch * depth;
+        error = mRenderer->getScratchMemory(neededSize, &conversionBuffer);
+        if (error.isError())
+        {
+            return error;
+        }
+
+        loadFunction(width, height, depth,
+                     pixelData, srcRowPitch, srcDepthPitch,
+                     conversionBuffer.data(), bufferRowPitch, bufferDepthPitch);
+
+        data = conversionBuffer.data();
+        dataRowPitch = bufferRowPitch;
+        dataDepthPitch = bufferDepthPitch;
     }
 
-    // TODO: fast path
-    LoadImageFunction loadFunction = d3d11Format.loadFunctions.at(type);
-    loadFunction(width, height, depth,
-                 pixelData, srcRowPitch, srcDepthPitch,
-                 conversionBuffer->data(), bufferRowPitch, bufferDepthPitch);
+    // Pixels from a pixel buffer were first copied out of it by BufferD3D::getData
+    int cpuCopies = (conversionFree ? 1 : 2) + (unpack.pixelBuffer.id() != 0 ? 1 : 0);
+    TRACE_EVENT_INSTANT2("gpu", "TextureUpload", "path", "setData", "cpuCopies", cpuCopies);
 
     ID3D11DeviceContext *immediateContext = mRenderer->getDeviceContext();
 
@@ -589,14 +610,14 @@ gl::Error TextureStorage11::setData(const gl::ImageIndex &index, ImageD3D *image
         destD3DBox.back = destBox->z + destBox->depth;
 
         immediateContext->UpdateSubresource(resource, destSubresource,
-                                            &destD3DBox, conversionBuffer->data(),
-                                            bufferRowPitch, bufferDepthPitch);
+                                            &destD3DBox, data,
+                                            dataRowPitch, dataDepthPitch);
     }
     else
     {
         immediateContext->UpdateSubresource(resource, destSubresource,
-                                            NULL, conversionBuffer->data(),
-                                            bufferRowPitch, bufferDepthPitch);
+                                            NULL, data,
+                                            dataRowPitch, dataDepthPitch);
     }
 
     return gl::Error(GL_NO_ERROR);
@@ -10,6 +10,7 @@
 #define LIBANGLE_RENDERER_D3D_D3D11_COPYVERTEX_H_
 
 #include "common/mathutil.h"
+#include "libANGLE/renderer/d3d/convertvertex.h"
 
 namespace rx
 {
@@ -51,7 +51,16 @@ inline void Copy8SintTo16SintVertexData(const uint8_t *input, size_t stride, siz
 {
     const size_t lastNonAlphaOutputComponent = std::min<size_t>(outputComponentCount, 3);
 
-    for (size_t i = 0; i < count; i++)
+    size_t i = 0;
+
+#if defined(ANGLE_USE_SSE)
+    if (inputComponentCount == outputComponentCount && gl::supportsSSE2())
+    {
+        i = Copy8SintTo16SintVertexData_SSE2(inputComponentCount, input, stride, count, reinterpret_cast<GLshort*>(output));
+    }
+#endif
+
+    for (; i < count; i++)
     {
         const GLbyte *offsetInput = reinterpret_cast<const GLbyte*>(input + i * stride);
         GLshort *offsetOutput = reinterpret_cast<GLshort*>(output)+i * outputComponentCount;
@@ -78,7 +87,16 @@ inline void Copy8SintTo16SintVertexData(const uint8_t *input, size_t stride, siz
 template <size_t inputComponentCount, size_t outputComponentCount>
 inline void Copy8SnormTo16SnormVertexData(const uint8_t *input, size_t stride, size_t count, uint8_t *output)
 {
-    for (size_t i = 0; i < count; i++)
+    size_t i = 0;
+
+#if defined(ANGLE_USE_SSE)
+    if (inputComponentCount == outputComponentCount && gl::supportsSSE2())
+    {
+        i = Copy8SnormTo16SnormVertexData_SSE2(inputComponentCount, input, stride, count, reinterpret_cast<GLshort*>(output));
+    }
+#endif
+
+    for (; i < count; i++)
     {
         const GLbyte *offsetInput = reinterpret_cast<const GLbyte*>(input + i * stride);
         GLshort *offsetOutput = reinterpret_cast<GLshort*>(output) + i * outputComponentCount;
@@ -93,7 +111,8 @@ inline void Copy8SnormTo16SnormVertexData(const uint8_t *input, size_t stride, s
             }
             else
             {
-                offsetOutput[j] = offsetInput[j] << 8;
+                // Multiplied rather than shifted, as shifting a negative value is undefined
+                offsetOutput[j] = static_cast<GLshort>(offsetInput[j] * 256);
             }
         }
 
@@ -116,7 +135,16 @@ inline void Copy32FixedTo32FVertexData(const uint8_t *input, size_t stride, size
 {
     static const float divisor = 1.0f / (1 << 16);
 
-    for (size_t i = 0; i < count; i++)
+    size_t i = 0;
+
+#if defined(ANGLE_USE_SSE)
+    if (inputComponentCount == outputComponentCount && gl::supportsSSE2())
+    {
+        i = Copy32FixedTo32FVertexData_SSE2(inputComponentCount, input, stride, count, reinterpret_cast<float*>(output));
+    }
+#endif
+
+    for (; i < count; i++)
     {
         const GLfixed* offsetInput = reinterpret_cast<const GLfixed*>(input + (stride * i));
         float* offsetOutput = reinterpret_cast<float*>(output) + i * outputComponentCount;
@@ -141,7 +169,17 @@ inline void CopyTo32FVertexData(const uint8_t *input, size_t stride, size_t coun
 {
     typedef std::numeric_limits<T> NL;
 
-    for (size_t i = 0; i < count; i++)
+    size_t i = 0;
+
+#if defined(ANGLE_USE_SSE)
+    if (NL::is_integer && inputComponentCount == outputComponentCount && gl::supportsSSE2())
+    {
+        i = CopyIntegerTo32FVertexData_SSE2(sizeof(T), NL::is_signed, normalized, inputComponentCount, input, stride,
+                                            count, reinterpret_cast<float*>(output));
+    }
+#endif
+
+    for (; i < count; i++)
     {
         const T *offsetInput = reinterpret_cast<const T*>(input + (stride * i));
         float *offsetOutput = reinterpret_cast<float*>(output) + i * outputComponentCount;
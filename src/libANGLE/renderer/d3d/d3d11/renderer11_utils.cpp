@@ -1055,6 +1055,8 @@ void GenerateCaps(ID3D11Device *device, gl::Caps *caps, gl::TextureCapsMap *text
     extensions->framebufferMultisample = GetFramebufferMultisampleSupport(featureLevel);
     extensions->maxSamples = maxSamples;
     extensions->instancedArrays = GetInstancingSupport(featureLevel);
+    extensions->multiDrawArrays = true;
+    extensions->multiDraw = extensions->instancedArrays;
     extensions->packReverseRowOrder = true;
     extensions->standardDerivatives = GetDerivativeInstructionSupport(featureLevel);
     extensions->shaderTextureLOD = GetShaderTextureLODSupport(featureLevel);
@@ -1193,6 +1195,7 @@ Workarounds GenerateWorkarounds(D3D_FEATURE_LEVEL featureLevel)
     // TODO: make render-to-backbuffer work with Geometry Shaders
     // Until then, use the instanced point sprites everywhere, which work with render-to-backbuffer
     workarounds.useInstancedPointSpriteEmulation = true; // (featureLevel <= D3D_FEATURE_LEVEL_9_3);
+    workarounds.asyncImageLoads = true;
     return workarounds;
 }
 
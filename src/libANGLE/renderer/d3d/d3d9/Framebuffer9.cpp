@@ -191,16 +191,10 @@ gl::Error Framebuffer9::readPixels(const gl::Rectangle &area, GLenum format, GLe
 
         if (fastCopyFunc)
         {
-            // Fast copy is possible through some special function
+            // Fast copy is possible through some special function, one row at a time
             for (int y = 0; y < rect.bottom - rect.top; y++)
             {
-                for (int x = 0; x < rect.right - rect.left; x++)
-                {
-                    uint8_t *dest = pixels + y * outputPitch + x * destFormatInfo.pixelBytes;
-                    const uint8_t *src = source + y * inputPitch + x * sourceFormatInfo.pixelBytes;
-
-                    fastCopyFunc(src, dest);
-                }
+                fastCopyFunc(source + y * inputPitch, pixels + y * outputPitch, rect.right - rect.left);
             }
         }
         else
@@ -13,6 +13,7 @@
 #include "libANGLE/renderer/d3d/d3d9/Renderer9.h"
 #include "libANGLE/renderer/d3d/d3d9/RenderTarget9.h"
 #include "libANGLE/renderer/d3d/d3d9/TextureStorage9.h"
+#include "libANGLE/renderer/d3d/generatemip.h"
 #include "libANGLE/formatutils.h"
 #include "libANGLE/Framebuffer.h"
 #include "libANGLE/FramebufferAttachment.h"
@@ -35,6 +36,7 @@ Image9::Image9(Renderer9 *renderer)
 
 Image9::~Image9()
 {
+    finishAsyncLoad();
     SafeRelease(mSurface);
 }
 
@@ -100,29 +102,81 @@ Image9 *Image9::makeImage9(ImageD3D *img)
     return static_cast<Image9*>(img);
 }
 
-gl::Error Image9::generateMipmap(Image9 *dest, Image9 *source)
+gl::Error Image9::generateMipmapChain(Image9 *const *levels, size_t levelCount)
 {
-    IDirect3DSurface9 *sourceSurface = NULL;
-    gl::Error error = source->getSurface(&sourceSurface);
-    if (error.isError())
+    ASSERT(levelCount > 0);
+
+    std::vector<IDirect3DSurface9*> surfaces(levelCount, NULL);
+    std::vector<MipChainLevel> chain(levelCount);
+    D3DFORMAT format = D3DFMT_UNKNOWN;
+
+    gl::Error error(GL_NO_ERROR);
+    size_t lockedCount = 0;
+    for (; lockedCount < levelCount; lockedCount++)
     {
-        return error;
+        error = levels[lockedCount]->getSurface(&surfaces[lockedCount]);
+        if (error.isError())
+        {
+            break;
+        }
+
+        IDirect3DSurface9 *surface = surfaces[lockedCount];
+
+        D3DSURFACE_DESC desc;
+        HRESULT result = surface->GetDesc(&desc);
+        ASSERT(SUCCEEDED(result));
+        if (FAILED(result))
+        {
+            error = gl::Error(GL_OUT_OF_MEMORY, "Failed to query a surface description for mipmap generation, result: 0x%X.", result);
+            break;
+        }
+
+        ASSERT(lockedCount == 0 || desc.Format == format);
+        ASSERT(lockedCount == 0 || chain[lockedCount - 1].width == 1 || chain[lockedCount - 1].width / 2 == desc.Width);
+        ASSERT(lockedCount == 0 || chain[lockedCount - 1].height == 1 || chain[lockedCount - 1].height / 2 == desc.Height);
+        format = desc.Format;
+
+        D3DLOCKED_RECT locked = {0};
+        result = surface->LockRect(&locked, NULL, (lockedCount == 0) ? D3DLOCK_READONLY : 0);
+        ASSERT(SUCCEEDED(result));
+        if (FAILED(result))
+        {
+            error = gl::Error(GL_OUT_OF_MEMORY, "Failed to lock a surface for mipmap generation, result: 0x%X.", result);
+            break;
+        }
+
+        ASSERT(locked.pBits);
+
+        chain[lockedCount].data = reinterpret_cast<uint8_t*>(locked.pBits);
+        chain[lockedCount].width = desc.Width;
+        chain[lockedCount].height = desc.Height;
+        chain[lockedCount].depth = 1;
+        chain[lockedCount].rowPitch = locked.Pitch;
+        chain[lockedCount].depthPitch = 0;
     }
 
-    IDirect3DSurface9 *destSurface = NULL;
-    error = dest->getSurface(&destSurface);
-    if (error.isError())
+    if (!error.isError())
     {
-        return error;
+        const d3d9::D3DFormat &d3dFormatInfo = d3d9::GetD3DFormatInfo(format);
+        ASSERT(d3dFormatInfo.mipGenerationFunction != NULL);
+
+        GenerateMipChain(d3dFormatInfo.mipGenerationFunction, chain.data(), chain.size());
+    }
+
+    for (size_t level = 0; level < lockedCount; level++)
+    {
+        surfaces[level]->UnlockRect();
     }
 
-    error = generateMip(destSurface, sourceSurface);
     if (error.isError())
     {
         return error;
     }
 
-    dest->markDirty();
+    for (size_t level = 1; level < levelCount; level++)
+    {
+        levels[level]->markDirty();
+    }
 
     return gl::Error(GL_NO_ERROR);
 }
@@ -184,6 +238,8 @@ bool Image9::redefine(GLenum target, GLenum internalformat, const gl::Extents &s
         mInternalFormat != internalformat ||
         forceRelease)
     {
+        finishAsyncLoad();
+
         mWidth = size.width;
         mHeight = size.height;
         mDepth = size.depth;
@@ -205,6 +261,8 @@ bool Image9::redefine(GLenum target, GLenum internalformat, const gl::Extents &s
 
 gl::Error Image9::createSurface()
 {
+    finishAsyncLoad();
+
     if (mSurface)
     {
         return gl::Error(GL_NO_ERROR);
@@ -305,6 +363,15 @@ void Image9::unlock()
     }
 }
 
+void Image9::finishAsyncLoad()
+{
+    if (mAsyncLoad.isPending())
+    {
+        mAsyncLoad.wait();
+        unlock();
+    }
+}
+
 D3DFORMAT Image9::getD3DFormat() const
 {
     // this should only happen if the image hasn't been redefined first
@@ -363,6 +430,8 @@ gl::Error Image9::setManagedSurface(IDirect3DSurface9 *surface)
     surface->GetDesc(&desc);
     ASSERT(desc.Pool == D3DPOOL_MANAGED);
 
+    finishAsyncLoad();
+
     if ((GLsizei)desc.Width == mWidth && (GLsizei)desc.Height == mHeight)
     {
         if (mSurface)
@@ -511,6 +580,51 @@ gl::Error Image9::loadData(const gl::Box &area, const gl::PixelUnpackState &unpa
     return gl::Error(GL_NO_ERROR);
 }
 
+gl::Error Image9::loadDataAsync(const gl::Box &area, const gl::PixelUnpackState &unpack, GLenum type, const void *input)
+{
+    // 3D textures are not supported by the D3D9 backend.
+    ASSERT(area.z == 0 && area.depth == 1);
+
+    // A managed surface belongs to the texture storage, which may use it at any time, so it can't
+    // stay locked.
+    if (mSurface && mD3DPool == D3DPOOL_MANAGED)
+    {
+        return loadData(area, unpack, type, input);
+    }
+
+    const gl::InternalFormat &formatInfo = gl::GetInternalFormatInfo(mInternalFormat);
+    GLsizei inputRowPitch = formatInfo.computeRowPitch(type, area.width, unpack.alignment, unpack.rowLength);
+    GLsizei inputRowBytes = formatInfo.computeRowPitch(type, area.width, 1, 0);
+
+    const d3d9::TextureFormat &d3dFormatInfo = d3d9::GetTextureFormatInfo(mInternalFormat);
+    ASSERT(d3dFormatInfo.loadFunction != NULL);
+
+    RECT lockRect =
+    {
+        area.x, area.y,
+        area.x + area.width, area.y + area.height
+    };
+
+    // Unlocked by finishAsyncLoad, once the workers are done
+    D3DLOCKED_RECT locked;
+    gl::Error error = lock(&locked, lockRect);
+    if (error.isError())
+    {
+        return error;
+    }
+
+    mAsyncLoad.start(mRenderer->getScratchMemoryPool(), d3dFormatInfo.loadFunction, area.width, area.height, area.depth,
+                     reinterpret_cast<const uint8_t*>(input), inputRowPitch, 0, inputRowBytes,
+                     reinterpret_cast<uint8_t*>(locked.pBits), locked.Pitch, 0);
+
+    if (!mAsyncLoad.isPending())
+    {
+        unlock();
+    }
+
+    return gl::Error(GL_NO_ERROR);
+}
+
 gl::Error Image9::loadCompressedData(const gl::Box &area, const void *input)
 {
     // 3D textures are not supported by the D3D9 backend.
@@ -11,6 +11,7 @@
 #define LIBANGLE_RENDERER_D3D_D3D9_IMAGE9_H_
 
 #include "libANGLE/renderer/d3d/ImageD3D.h"
+#include "libANGLE/renderer/d3d/ImageLoadTask.h"
 #include "common/debug.h"
 
 namespace gl
@@ -30,7 +31,8 @@ class Image9 : public ImageD3D
 
     static Image9 *makeImage9(ImageD3D *img);
 
-    static gl::Error generateMipmap(Image9 *dest, Image9 *source);
+    // Generates levels 1 to levelCount - 1 from levels[0] on the CPU
+    static gl::Error generateMipmapChain(Image9 *const *levels, size_t levelCount);
     static gl::Error generateMip(IDirect3DSurface9 *destSurface, IDirect3DSurface9 *sourceSurface);
     static gl::Error copyLockableSurfaces(IDirect3DSurface9 *dest, IDirect3DSurface9 *source);
 
@@ -45,6 +47,7 @@ class Image9 : public ImageD3D
     virtual gl::Error copyToStorage(TextureStorage *storage, const gl::ImageIndex &index, const gl::Box &region);
 
     virtual gl::Error loadData(const gl::Box &area, const gl::PixelUnpackState &unpack, GLenum type, const void *input);
+    virtual gl::Error loadDataAsync(const gl::Box &area, const gl::PixelUnpackState &unpack, GLenum type, const void *input);
     virtual gl::Error loadCompressedData(const gl::Box &area, const void *input);
 
     virtual gl::Error copy(const gl::Offset &destOffset, const gl::Rectangle &sourceArea, RenderTargetD3D *source);
@@ -63,12 +66,17 @@ class Image9 : public ImageD3D
     gl::Error lock(D3DLOCKED_RECT *lockedRect, const RECT &rect);
     void unlock();
 
+    void finishAsyncLoad();
+
     Renderer9 *mRenderer;
 
     D3DPOOL mD3DPool;   // can only be D3DPOOL_SYSTEMMEM or D3DPOOL_MANAGED since it needs to be lockable.
     D3DFORMAT mD3DFormat;
 
     IDirect3DSurface9 *mSurface;
+
+    // Writes into the surface, which stays locked while the load is pending
+    ImageLoadTask mAsyncLoad;
 };
 }
 
@@ -1398,14 +1398,22 @@ gl::Error Renderer9::applyVertexBuffer(const gl::State &state, GLenum mode, GLin
 }
 
 // Applies the indices and element array bindings to the Direct3D 9 device
-gl::Error Renderer9::applyIndexBuffer(const GLvoid *indices, gl::Buffer *elementArrayBuffer, GLsizei count, GLenum mode, GLenum type, TranslatedIndexData *indexInfo)
+gl::Error Renderer9::applyIndexBuffer(const GLvoid *indices, gl::Buffer *elementArrayBuffer, GLsizei count, GLenum mode, GLenum type,
+                                      bool primitiveRestartEnabled, TranslatedIndexData *indexInfo)
 {
-    gl::Error error = mIndexDataManager->prepareIndexData(type, count, elementArrayBuffer, indices, indexInfo);
+    gl::Error error = mIndexDataManager->prepareIndexData(type, count, elementArrayBuffer, indices, mode,
+                                                          primitiveRestartEnabled, indexInfo);
     if (error.isError())
     {
         return error;
     }
 
+    // Translating primitive restart indices can leave nothing to draw.
+    if (indexInfo->count == 0)
+    {
+        return gl::Error(GL_NO_ERROR);
+    }
+
     // Directly binding the storage buffer is not supported for d3d9
     ASSERT(indexInfo->storage == NULL);
 
@@ -1846,105 +1854,53 @@ gl::Error Renderer9::applyShaders(gl::Program *program, const gl::VertexFormat i
     return gl::Error(GL_NO_ERROR);
 }
 
-gl::Error Renderer9::applyUniforms(const ProgramImpl &program, const std::vector<gl::LinkedUniform*> &uniformArray)
+gl::Error Renderer9::applyUniforms(const ProgramImpl &program)
 {
-    for (size_t uniformIndex = 0; uniformIndex < uniformArray.size(); uniformIndex++)
-    {
-        gl::LinkedUniform *targetUniform = uniformArray[uniformIndex];
+    const ProgramD3D *programD3D = GetAs<ProgramD3D>(&program);
+    const UniformStorageD3D &vertexUniformStorage = programD3D->getVertexUniformStorage();
+    const UniformStorageD3D &fragmentUniformStorage = programD3D->getFragmentUniformStorage();
 
-        if (targetUniform->dirty)
+    // The first registers of each stage hold the driver uniforms, which the default block never
+    // uses. Uploading its unused copy of them would overwrite them.
+    if (vertexUniformStorage.isDirty())
+    {
+        unsigned int startRegister = std::max(vertexUniformStorage.getDirtyRegisterStart(),
+                                               gl::D3D9VertexDriverUniformRegisters);
+        unsigned int endRegister = vertexUniformStorage.getDirtyRegisterEnd();
+        if (startRegister < endRegister)
         {
-            GLfloat *f = (GLfloat*)targetUniform->data;
-            GLint *i = (GLint*)targetUniform->data;
+            mDevice->SetVertexShaderConstantF(startRegister, vertexUniformStorage.getRegisterData() + startRegister * 4,
+                                              endRegister - startRegister);
+        }
+    }
 
-            switch (targetUniform->type)
-            {
-              case GL_SAMPLER_2D:
-              case GL_SAMPLER_CUBE:
-                break;
-              case GL_BOOL:
-              case GL_BOOL_VEC2:
-              case GL_BOOL_VEC3:
-              case GL_BOOL_VEC4:
-                applyUniformnbv(targetUniform, i);
-                break;
-              case GL_FLOAT:
-              case GL_FLOAT_VEC2:
-              case GL_FLOAT_VEC3:
-              case GL_FLOAT_VEC4:
-              case GL_FLOAT_MAT2:
-              case GL_FLOAT_MAT3:
-              case GL_FLOAT_MAT4:
-                applyUniformnfv(targetUniform, f);
-                break;
-              case GL_INT:
-              case GL_INT_VEC2:
-              case GL_INT_VEC3:
-              case GL_INT_VEC4:
-                applyUniformniv(targetUniform, i);
-                break;
-              default:
-                UNREACHABLE();
-            }
+    if (fragmentUniformStorage.isDirty())
+    {
+        unsigned int startRegister = std::max(fragmentUniformStorage.getDirtyRegisterStart(),
+                                               gl::D3D9PixelDriverUniformRegisters);
+        unsigned int endRegister = fragmentUniformStorage.getDirtyRegisterEnd();
+        if (startRegister < endRegister)
+        {
+            mDevice->SetPixelShaderConstantF(startRegister, fragmentUniformStorage.getRegisterData() + startRegister * 4,
+                                             endRegister - startRegister);
         }
     }
 
     // Driver uniforms
     if (mDxUniformsDirty)
     {
-        mDevice->SetVertexShaderConstantF(0, (float*)&mVertexConstants, sizeof(dx_VertexConstants) / sizeof(float[4]));
-        mDevice->SetPixelShaderConstantF(0, (float*)&mPixelConstants, sizeof(dx_PixelConstants) / sizeof(float[4]));
+        // dx_PixelConstants also holds dx_ViewScale, which only D3D11 feature level 9 shaders use.
+        // Uploading it here would overwrite the first uniform of the program.
+        META_ASSERT(sizeof(dx_VertexConstants) / sizeof(float[4]) == gl::D3D9VertexDriverUniformRegisters);
+        META_ASSERT(sizeof(dx_PixelConstants) / sizeof(float[4]) >= gl::D3D9PixelDriverUniformRegisters);
+        mDevice->SetVertexShaderConstantF(0, (float*)&mVertexConstants, gl::D3D9VertexDriverUniformRegisters);
+        mDevice->SetPixelShaderConstantF(0, (float*)&mPixelConstants, gl::D3D9PixelDriverUniformRegisters);
         mDxUniformsDirty = false;
     }
 
     return gl::Error(GL_NO_ERROR);
 }
 
-void Renderer9::applyUniformnfv(gl::LinkedUniform *targetUniform, const GLfloat *v)
-{
-    if (targetUniform->isReferencedByFragmentShader())
-    {
-        mDevice->SetPixelShaderConstantF(targetUniform->psRegisterIndex, v, targetUniform->registerCount);
-    }
-
-    if (targetUniform->isReferencedByVertexShader())
-    {
-        mDevice->SetVertexShaderConstantF(targetUniform->vsRegisterIndex, v, targetUniform->registerCount);
-    }
-}
-
-void Renderer9::applyUniformniv(gl::LinkedUniform *targetUniform, const GLint *v)
-{
-    ASSERT(targetUniform->registerCount <= MAX_VERTEX_CONSTANT_VECTORS_D3D9);
-    GLfloat vector[MAX_VERTEX_CONSTANT_VECTORS_D3D9][4];
-
-    for (unsigned int i = 0; i < targetUniform->registerCount; i++)
-    {
-        vector[i][0] = (GLfloat)v[4 * i + 0];
-        vector[i][1] = (GLfloat)v[4 * i + 1];
-        vector[i][2] = (GLfloat)v[4 * i + 2];
-        vector[i][3] = (GLfloat)v[4 * i + 3];
-    }
-
-    applyUniformnfv(targetUniform, (GLfloat*)vector);
-}
-
-void Renderer9::applyUniformnbv(gl::LinkedUniform *targetUniform, const GLint *v)
-{
-    ASSERT(targetUniform->registerCount <= MAX_VERTEX_CONSTANT_VECTORS_D3D9);
-    GLfloat vector[MAX_VERTEX_CONSTANT_VECTORS_D3D9][4];
-
-    for (unsigned int i = 0; i < targetUniform->registerCount; i++)
-    {
-        vector[i][0] = (v[4 * i + 0] == GL_FALSE) ? 0.0f : 1.0f;
-        vector[i][1] = (v[4 * i + 1] == GL_FALSE) ? 0.0f : 1.0f;
-        vector[i][2] = (v[4 * i + 2] == GL_FALSE) ? 0.0f : 1.0f;
-        vector[i][3] = (v[4 * i + 3] == GL_FALSE) ? 0.0f : 1.0f;
-    }
-
-    applyUniformnfv(targetUniform, (GLfloat*)vector);
-}
-
 gl::Error Renderer9::clear(const gl::ClearParameters &clearParams, const gl::FramebufferAttachment *colorBuffer,
                            const gl::FramebufferAttachment *depthStencilBuffer)
 {
@@ -2839,11 +2795,14 @@ ImageD3D *Renderer9::createImage()
     return new Image9(this);
 }
 
-gl::Error Renderer9::generateMipmap(ImageD3D *dest, ImageD3D *src)
+gl::Error Renderer9::generateMipmapChain(ImageD3D *const *levels, size_t levelCount)
 {
-    Image9 *src9 = Image9::makeImage9(src);
-    Image9 *dst9 = Image9::makeImage9(dest);
-    return Image9::generateMipmap(dst9, src9);
+    std::vector<Image9*> levels9(levelCount);
+    for (size_t level = 0; level < levelCount; level++)
+    {
+        levels9[level] = Image9::makeImage9(levels[level]);
+    }
+    return Image9::generateMipmapChain(levels9.data(), levels9.size());
 }
 
 TextureStorage *Renderer9::createTextureStorage2D(SwapChainD3D *swapChain)
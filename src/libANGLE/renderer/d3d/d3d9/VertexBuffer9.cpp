@@ -22,15 +22,18 @@ VertexBuffer9::VertexBuffer9(Renderer9 *renderer) : mRenderer(renderer)
     mVertexBuffer = NULL;
     mBufferSize = 0;
     mDynamicUsage = false;
+    mMappedResourceData = NULL;
 }
 
 VertexBuffer9::~VertexBuffer9()
 {
+    ASSERT(mMappedResourceData == NULL);
     SafeRelease(mVertexBuffer);
 }
 
 gl::Error VertexBuffer9::initialize(unsigned int size, bool dynamicUsage)
 {
+    hintUnmapResource();
     SafeRelease(mVertexBuffer);
 
     updateSerial();
@@ -75,22 +78,13 @@ gl::Error VertexBuffer9::storeVertexAttributes(const gl::VertexAttribute &attrib
     int inputStride = gl::ComputeVertexAttributeStride(attrib);
     int elementSize = gl::ComputeVertexAttributeTypeSize(attrib);
 
-    DWORD lockFlags = mDynamicUsage ? D3DLOCK_NOOVERWRITE : 0;
-
-    uint8_t *mapPtr = NULL;
-
-    unsigned int mapSize;
-    gl::Error error = spaceRequired(attrib, count, instances, &mapSize);
+    gl::Error error = mapResource();
     if (error.isError())
     {
         return error;
     }
 
-    HRESULT result = mVertexBuffer->Lock(offset, mapSize, reinterpret_cast<void**>(&mapPtr), lockFlags);
-    if (FAILED(result))
-    {
-        return gl::Error(GL_OUT_OF_MEMORY, "Failed to lock internal vertex buffer, HRESULT: 0x%08x.", result);
-    }
+    uint8_t *mapPtr = mMappedResourceData + offset;
 
     const uint8_t *input = NULL;
     if (attrib.enabled)
@@ -135,8 +129,6 @@ gl::Error VertexBuffer9::storeVertexAttributes(const gl::VertexAttribute &attrib
         d3dVertexInfo.copyFunction(input, inputStride, count, mapPtr);
     }
 
-    mVertexBuffer->Unlock();
-
     return gl::Error(GL_NO_ERROR);
 }
 
@@ -170,6 +162,8 @@ gl::Error VertexBuffer9::discard()
         return gl::Error(GL_OUT_OF_MEMORY, "Internal vertex buffer is not initialized.");
     }
 
+    hintUnmapResource();
+
     void *dummy;
     HRESULT result;
 
@@ -188,11 +182,41 @@ gl::Error VertexBuffer9::discard()
     return gl::Error(GL_NO_ERROR);
 }
 
+void VertexBuffer9::hintUnmapResource()
+{
+    if (mMappedResourceData != NULL)
+    {
+        mVertexBuffer->Unlock();
+        mMappedResourceData = NULL;
+    }
+}
+
 IDirect3DVertexBuffer9 * VertexBuffer9::getBuffer() const
 {
     return mVertexBuffer;
 }
 
+gl::Error VertexBuffer9::mapResource()
+{
+    if (mMappedResourceData == NULL)
+    {
+        // Dynamic buffers are only appended to between discards, so the whole buffer can be locked
+        // without waiting on the draws still reading from it
+        DWORD lockFlags = mDynamicUsage ? D3DLOCK_NOOVERWRITE : 0;
+
+        void *mapPtr = NULL;
+        HRESULT result = mVertexBuffer->Lock(0, 0, &mapPtr, lockFlags);
+        if (FAILED(result))
+        {
+            return gl::Error(GL_OUT_OF_MEMORY, "Failed to lock internal vertex buffer, HRESULT: 0x%08x.", result);
+        }
+
+        mMappedResourceData = reinterpret_cast<uint8_t*>(mapPtr);
+    }
+
+    return gl::Error(GL_NO_ERROR);
+}
+
 gl::Error VertexBuffer9::spaceRequired(const gl::VertexAttribute &attrib, std::size_t count, GLsizei instances,
                                        unsigned int *outSpaceRequired) const
 {
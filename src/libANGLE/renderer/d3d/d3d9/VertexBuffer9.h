@@ -34,17 +34,24 @@ class VertexBuffer9 : public VertexBuffer
     virtual gl::Error setBufferSize(unsigned int size);
     virtual gl::Error discard();
 
+    virtual void hintUnmapResource();
+
     IDirect3DVertexBuffer9 *getBuffer() const;
 
   private:
     DISALLOW_COPY_AND_ASSIGN(VertexBuffer9);
 
+    gl::Error mapResource();
+
     Renderer9 *mRenderer;
 
     IDirect3DVertexBuffer9 *mVertexBuffer;
     unsigned int mBufferSize;
     bool mDynamicUsage;
 
+    // The whole buffer stays locked across the attributes stored for a draw, until unmap is hinted
+    uint8_t *mMappedResourceData;
+
     gl::Error spaceRequired(const gl::VertexAttribute &attrib, std::size_t count, GLsizei instances,
                             unsigned int *outSpaceRequired) const;
 };
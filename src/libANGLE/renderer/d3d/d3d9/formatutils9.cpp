@@ -41,11 +41,30 @@ struct D3D9FastCopyFormat
 
 typedef std::multimap<D3DFORMAT, D3D9FastCopyFormat> D3D9FastCopyMap;
 
+// Copies between unsigned normalized formats rescale channels with integer math instead of
+// going through a gl::ColorF per pixel.
+template <typename sourceType>
+static void InsertUnormCopyFunctions(D3D9FastCopyMap *map, D3DFORMAT format)
+{
+    map->insert(std::make_pair(format, D3D9FastCopyFormat(GL_RGBA,     GL_UNSIGNED_BYTE,                  CopyUnormPixels<sourceType, R8G8B8A8>)));
+    map->insert(std::make_pair(format, D3D9FastCopyFormat(GL_RGBA,     GL_UNSIGNED_SHORT_4_4_4_4,         CopyUnormPixels<sourceType, R4G4B4A4>)));
+    map->insert(std::make_pair(format, D3D9FastCopyFormat(GL_RGBA,     GL_UNSIGNED_SHORT_5_5_5_1,         CopyUnormPixels<sourceType, R5G5B5A1>)));
+    map->insert(std::make_pair(format, D3D9FastCopyFormat(GL_RGBA,     GL_UNSIGNED_INT_2_10_10_10_REV,    CopyUnormPixels<sourceType, R10G10B10A2>)));
+    map->insert(std::make_pair(format, D3D9FastCopyFormat(GL_RGB,      GL_UNSIGNED_SHORT_5_6_5,           CopyUnormPixels<sourceType, R5G6B5>)));
+    map->insert(std::make_pair(format, D3D9FastCopyFormat(GL_BGRA_EXT, GL_UNSIGNED_BYTE,                  CopyUnormPixels<sourceType, B8G8R8A8>)));
+    map->insert(std::make_pair(format, D3D9FastCopyFormat(GL_BGRA_EXT, GL_UNSIGNED_SHORT_4_4_4_4_REV_EXT, CopyUnormPixels<sourceType, B4G4R4A4>)));
+    map->insert(std::make_pair(format, D3D9FastCopyFormat(GL_BGRA_EXT, GL_UNSIGNED_SHORT_1_5_5_5_REV_EXT, CopyUnormPixels<sourceType, B5G5R5A1>)));
+}
+
 static D3D9FastCopyMap BuildFastCopyMap()
 {
     D3D9FastCopyMap map;
 
-    map.insert(std::make_pair(D3DFMT_A8R8G8B8, D3D9FastCopyFormat(GL_RGBA, GL_UNSIGNED_BYTE, CopyBGRA8ToRGBA8)));
+    InsertUnormCopyFunctions<B8G8R8A8>(&map, D3DFMT_A8R8G8B8);
+    InsertUnormCopyFunctions<B8G8R8X8>(&map, D3DFMT_X8R8G8B8);
+    InsertUnormCopyFunctions<R5G6B5>(&map, D3DFMT_R5G6B5);
+    InsertUnormCopyFunctions<B5G5R5A1>(&map, D3DFMT_A1R5G5B5);
+    InsertUnormCopyFunctions<B4G4R4A4>(&map, D3DFMT_A4R4G4B4);
 
     return map;
 }
@@ -180,23 +199,6 @@ static InternalFormatInitialzerMap BuildInternalFormatInitialzerMap()
 // in templates that perform format support queries on a Renderer9 object which is supplied
 // when requesting the function or format.
 
-typedef bool(*FallbackPredicateFunction)();
-
-template <FallbackPredicateFunction pred, LoadImageFunction prefered, LoadImageFunction fallback>
-static void FallbackLoad(size_t width, size_t height, size_t depth,
-                         const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
-                         uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
-{
-    if (pred())
-    {
-        prefered(width, height, depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch, outputDepthPitch);
-    }
-    else
-    {
-        fallback(width, height, depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch, outputDepthPitch);
-    }
-}
-
 static void UnreachableLoad(size_t width, size_t height, size_t depth,
                             const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
                             uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
@@ -270,11 +272,11 @@ static D3D9FormatMap BuildD3D9FormatMap()
 
     InsertD3D9FormatInfo(&map, GL_ALPHA8_EXT,                       D3DFMT_A8R8G8B8,      D3DFMT_A8R8G8B8,       FallbackLoad<gl::supportsSSE2, LoadA8ToBGRA8_SSE2, LoadA8ToBGRA8>);
 
-    InsertD3D9FormatInfo(&map, GL_RGB8_OES,                         D3DFMT_X8R8G8B8,      D3DFMT_X8R8G8B8,       LoadRGB8ToBGRX8                           );
-    InsertD3D9FormatInfo(&map, GL_RGB565,                           D3DFMT_X8R8G8B8,      D3DFMT_X8R8G8B8,       LoadR5G6B5ToBGRA8                         );
+    InsertD3D9FormatInfo(&map, GL_RGB8_OES,                         D3DFMT_X8R8G8B8,      D3DFMT_X8R8G8B8,       FallbackLoad<gl::supportsSSE2, LoadRGB8ToBGRX8_SSE2, LoadRGB8ToBGRX8>);
+    InsertD3D9FormatInfo(&map, GL_RGB565,                           D3DFMT_X8R8G8B8,      D3DFMT_X8R8G8B8,       FallbackLoad<gl::supportsSSE2, LoadR5G6B5ToBGRA8_SSE2, LoadR5G6B5ToBGRA8>);
     InsertD3D9FormatInfo(&map, GL_RGBA8_OES,                        D3DFMT_A8R8G8B8,      D3DFMT_A8R8G8B8,       FallbackLoad<gl::supportsSSE2, LoadRGBA8ToBGRA8_SSE2, LoadRGBA8ToBGRA8>);
-    InsertD3D9FormatInfo(&map, GL_RGBA4,                            D3DFMT_A8R8G8B8,      D3DFMT_A8R8G8B8,       LoadRGBA4ToBGRA8                          );
-    InsertD3D9FormatInfo(&map, GL_RGB5_A1,                          D3DFMT_A8R8G8B8,      D3DFMT_A8R8G8B8,       LoadRGB5A1ToBGRA8                         );
+    InsertD3D9FormatInfo(&map, GL_RGBA4,                            D3DFMT_A8R8G8B8,      D3DFMT_A8R8G8B8,       FallbackLoad<gl::supportsSSE2, LoadRGBA4ToBGRA8_SSE2, LoadRGBA4ToBGRA8>);
+    InsertD3D9FormatInfo(&map, GL_RGB5_A1,                          D3DFMT_A8R8G8B8,      D3DFMT_A8R8G8B8,       FallbackLoad<gl::supportsSSE2, LoadRGB5A1ToBGRA8_SSE2, LoadRGB5A1ToBGRA8>);
     InsertD3D9FormatInfo(&map, GL_R8_EXT,                           D3DFMT_X8R8G8B8,      D3DFMT_X8R8G8B8,       LoadR8ToBGRX8                             );
     InsertD3D9FormatInfo(&map, GL_RG8_EXT,                          D3DFMT_X8R8G8B8,      D3DFMT_X8R8G8B8,       LoadRG8ToBGRX8                            );
 
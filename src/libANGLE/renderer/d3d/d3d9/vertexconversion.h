@@ -10,6 +10,9 @@
 #ifndef LIBANGLE_RENDERER_D3D_D3D9_VERTEXCONVERSION_H_
 #define LIBANGLE_RENDERER_D3D_D3D9_VERTEXCONVERSION_H_
 
+#include "common/mathutil.h"
+#include "libANGLE/renderer/d3d/convertvertex.h"
+
 #include <limits>
 #include <cstdint>
 #include <cstddef>
@@ -101,6 +104,39 @@ struct FixedToFloat
     }
 };
 
+// SSE2 conversions:
+// ConvertVertexData_SSE2(const Conversion *, componentCount, input, stride, n, output) converts as many
+// vertices as the SSE2 version of the conversion handles and returns how many. Conversions without one
+// fall back to the void pointer overload, which converts none.
+
+inline std::size_t ConvertVertexData_SSE2(const void *, std::size_t, const uint8_t *, std::size_t, std::size_t, void *)
+{
+    return 0;
+}
+
+template <class T>
+inline std::size_t ConvertVertexData_SSE2(const Normalize<T> *, std::size_t componentCount, const uint8_t *input,
+                                          std::size_t stride, std::size_t n, float *output)
+{
+    typedef std::numeric_limits<T> NL;
+    return NL::is_integer ? CopyIntegerTo32FVertexData_SSE2(sizeof(T), NL::is_signed, true, componentCount, input, stride, n, output) : 0;
+}
+
+template <class FromT>
+inline std::size_t ConvertVertexData_SSE2(const Cast<FromT, float> *, std::size_t componentCount, const uint8_t *input,
+                                          std::size_t stride, std::size_t n, float *output)
+{
+    typedef std::numeric_limits<FromT> NL;
+    return NL::is_integer ? CopyIntegerTo32FVertexData_SSE2(sizeof(FromT), NL::is_signed, false, componentCount, input, stride, n, output) : 0;
+}
+
+template <class FromType>
+inline std::size_t ConvertVertexData_SSE2(const FixedToFloat<FromType, 16> *, std::size_t componentCount, const uint8_t *input,
+                                          std::size_t stride, std::size_t n, float *output)
+{
+    return (sizeof(FromType) == 4) ? Copy32FixedTo32FVertexData_SSE2(componentCount, input, stride, n, output) : 0;
+}
+
 // Widen types:
 // static const unsigned int initialWidth: number of components before conversion
 // static const unsigned int finalWidth: number of components after conversion
@@ -161,8 +197,17 @@ struct VertexDataConverter
     static void convertArray(const uint8_t *input, size_t stride, size_t n, uint8_t *output)
     {
         OutputType *out = reinterpret_cast<OutputType*>(output);
+        std::size_t i = 0;
+
+#if defined(ANGLE_USE_SSE)
+        if (WidenRule::initialWidth == WidenRule::finalWidth && gl::supportsSSE2())
+        {
+            i = ConvertVertexData_SSE2(static_cast<const Converter*>(NULL), WidenRule::finalWidth, input, stride, n, out);
+            out += i * WidenRule::finalWidth;
+        }
+#endif
 
-        for (std::size_t i = 0; i < n; i++)
+        for (; i < n; i++)
         {
             const InputType *ein = reinterpret_cast<const InputType*>(input + i * stride);
 
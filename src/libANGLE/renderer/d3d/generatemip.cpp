@@ -0,0 +1,180 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// generatemip.cpp: Defines GenerateMipChain, which produces a whole mip chain
+// on the CPU from a format's single-level GenerateMip function.
+
+#include "libANGLE/renderer/d3d/generatemip.h"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+namespace rx
+{
+
+namespace
+{
+
+// Size of the band of source rows filtered before moving down the chain, small enough that the
+// band and the rows it produces in the following levels stay in cache.
+const size_t MipBandBytes = 64 * 1024;
+
+// Sources smaller than this are generated on the calling thread.
+const size_t MipThreadingMinimumBytes = 1024 * 1024;
+const size_t MipMaxThreads = 8;
+
+struct MipChain
+{
+    MipGenerationFunction generateMip;
+    const MipChainLevel *levels;
+    size_t levelCount;
+};
+
+// Generates rows [firstRow, lastRow) of a level from the level above it.
+void GenerateRows(const MipChain &chain, size_t level, size_t firstRow, size_t lastRow)
+{
+    const MipChainLevel &source = chain.levels[level - 1];
+    const MipChainLevel &dest = chain.levels[level];
+
+    if (source.height == 1)
+    {
+        ASSERT(firstRow == 0 && lastRow == 1);
+        chain.generateMip(source.width, 1, 1, source.data, source.rowPitch, source.depthPitch,
+                          dest.data, dest.rowPitch, dest.depthPitch);
+    }
+    else
+    {
+        // Destination rows only depend on the two source rows above them
+        chain.generateMip(source.width, (lastRow - firstRow) * 2, 1,
+                          source.data + firstRow * 2 * source.rowPitch, source.rowPitch, source.depthPitch,
+                          dest.data + firstRow * dest.rowPitch, dest.rowPitch, dest.depthPitch);
+    }
+}
+
+// Brings level 1 up to firstLevelRows rows, then every following level up to lastLevel as far as
+// the rows produced above it allow. producedRows holds the number of rows done per level.
+void AdvanceLevels(const MipChain &chain, size_t lastLevel, size_t firstLevelRows, size_t *producedRows)
+{
+    for (size_t level = 1; level <= lastLevel; level++)
+    {
+        size_t targetRows = firstLevelRows;
+        if (level > 1)
+        {
+            const MipChainLevel &source = chain.levels[level - 1];
+            targetRows = (source.height == 1) ? std::min<size_t>(producedRows[level - 1], 1)
+                                              : std::min(chain.levels[level].height, producedRows[level - 1] / 2);
+        }
+
+        if (targetRows > producedRows[level])
+        {
+            GenerateRows(chain, level, producedRows[level], targetRows);
+            producedRows[level] = targetRows;
+        }
+    }
+}
+
+// Generates rows [firstRow, lastRow) of level 1 band by band, following each band down to lastLevel.
+void GenerateBands(const MipChain &chain, size_t lastLevel, size_t firstRow, size_t lastRow, size_t *producedRows)
+{
+    size_t bandRows = std::max<size_t>(1, MipBandBytes / (2 * chain.levels[0].rowPitch));
+
+    for (size_t row = firstRow; row < lastRow;)
+    {
+        row = std::min(lastRow, row + bandRows);
+        AdvanceLevels(chain, lastLevel, row, producedRows);
+    }
+}
+
+// A tile covers a run of rows of tileLevel and every row above them in the chain.
+void GenerateTile(const MipChain *chain, size_t tileLevel, size_t firstTileRow, size_t lastTileRow)
+{
+    std::vector<size_t> producedRows(tileLevel + 1);
+    for (size_t level = 1; level <= tileLevel; level++)
+    {
+        producedRows[level] = firstTileRow << (tileLevel - level);
+    }
+
+    GenerateBands(*chain, tileLevel, producedRows[1], lastTileRow << (tileLevel - 1), producedRows.data());
+}
+
+size_t GetThreadCount(const MipChainLevel &source)
+{
+    if (source.rowPitch * source.height < MipThreadingMinimumBytes)
+    {
+        return 1;
+    }
+
+    size_t hardwareThreads = std::thread::hardware_concurrency();
+    return std::max<size_t>(1, std::min(hardwareThreads, MipMaxThreads));
+}
+
+}
+
+void GenerateMipChain(MipGenerationFunction generateMip, const MipChainLevel *levels, size_t levelCount)
+{
+    ASSERT(levelCount > 0);
+
+    MipChain chain = { generateMip, levels, levelCount };
+
+    if (levels[0].depth > 1)
+    {
+        // Volume levels are generated whole, one after the other
+        for (size_t level = 1; level < levelCount; level++)
+        {
+            const MipChainLevel &source = levels[level - 1];
+            const MipChainLevel &dest = levels[level];
+            generateMip(source.width, source.height, source.depth, source.data, source.rowPitch, source.depthPitch,
+                        dest.data, dest.rowPitch, dest.depthPitch);
+        }
+        return;
+    }
+
+    std::vector<size_t> producedRows(levelCount, 0);
+    const size_t lastLevel = levelCount - 1;
+    if (lastLevel == 0)
+    {
+        return;
+    }
+
+    // Split the deepest level that still has a row for every thread into tiles. Each tile produces
+    // its own rows of that level and of every level above it, so tiles never share data.
+    size_t threadCount = GetThreadCount(levels[0]);
+    size_t tileLevel = 0;
+    for (size_t level = 1; level <= lastLevel && levels[level - 1].height > 1 && levels[level].height >= threadCount; level++)
+    {
+        tileLevel = level;
+    }
+
+    if (threadCount > 1 && tileLevel > 0)
+    {
+        const size_t tileRows = levels[tileLevel].height;
+
+        std::vector<std::thread> workers;
+        for (size_t thread = 1; thread < threadCount; thread++)
+        {
+            workers.push_back(std::thread(GenerateTile, &chain, tileLevel, tileRows * thread / threadCount,
+                                          tileRows * (thread + 1) / threadCount));
+        }
+        GenerateTile(&chain, tileLevel, 0, tileRows / threadCount);
+
+        for (size_t thread = 0; thread < workers.size(); thread++)
+        {
+            workers[thread].join();
+        }
+
+        for (size_t level = 1; level <= tileLevel; level++)
+        {
+            producedRows[level] = tileRows << (tileLevel - level);
+        }
+    }
+
+    // Finish the rows left below the tiles and the levels after them on this thread
+    GenerateBands(chain, lastLevel, producedRows[1], levels[1].height, producedRows.data());
+    AdvanceLevels(chain, lastLevel, levels[1].height, producedRows.data());
+}
+
+}
@@ -10,6 +10,7 @@
 #ifndef LIBANGLE_RENDERER_D3D_GENERATEMIP_H_
 #define LIBANGLE_RENDERER_D3D_GENERATEMIP_H_
 
+#include "libANGLE/renderer/d3d/formatutilsD3D.h"
 #include "libANGLE/renderer/d3d/imageformats.h"
 #include "libANGLE/angletypes.h"
 
@@ -21,6 +22,30 @@ inline void GenerateMip(size_t sourceWidth, size_t sourceHeight, size_t sourceDe
                         const uint8_t *sourceData, size_t sourceRowPitch, size_t sourceDepthPitch,
                         uint8_t *destData, size_t destRowPitch, size_t destDepthPitch);
 
+// One level of a mip chain, as mapped for CPU access.
+struct MipChainLevel
+{
+    uint8_t *data;
+    size_t width;
+    size_t height;
+    size_t depth;
+    size_t rowPitch;
+    size_t depthPitch;
+};
+
+// Fills levels 1 to levelCount - 1 from level 0 using a format's GenerateMip function. Rows of
+// every level are produced in bands while their inputs are still in cache, and large images are
+// split into tiles generated on worker threads.
+void GenerateMipChain(MipGenerationFunction generateMip, const MipChainLevel *levels, size_t levelCount);
+
+// Box filter two source rows into one destination row for formats averaged per byte or per float,
+// in the same order as the scalar filter. Returns the number of destination pixels written; the
+// caller finishes the rest of the row.
+size_t AverageMipRowsBytes_SSE2(const uint8_t *row0, const uint8_t *row1, uint8_t *dest, size_t destWidth,
+                                size_t pixelBytes, uint32_t forcedBits);
+size_t AverageMipRowsFloats_SSE2(const float *row0, const float *row1, float *dest, size_t destWidth,
+                                 size_t componentCount);
+
 }
 
 #include "generatemip.inl"
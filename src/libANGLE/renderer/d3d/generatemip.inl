@@ -87,6 +87,62 @@ static void GenerateMip_Z(size_t sourceWidth, size_t sourceHeight, size_t source
     }
 }
 
+// Selects a vectorized row filter for GenerateMip_XY. Formats averaged with a floor per unsigned
+// byte or with (a + b) * 0.5 per float can use one; the others are filtered pixel by pixel.
+template <typename T>
+struct MipRowFilter
+{
+    static size_t averageRows(const uint8_t *, const uint8_t *, uint8_t *, size_t)
+    {
+        return 0;
+    }
+};
+
+template <size_t pixelBytes, uint32_t forcedBits>
+struct ByteMipRowFilter
+{
+    static size_t averageRows(const uint8_t *row0, const uint8_t *row1, uint8_t *dest, size_t destWidth)
+    {
+#if defined(ANGLE_USE_SSE)
+        if (gl::supportsSSE2())
+        {
+            return AverageMipRowsBytes_SSE2(row0, row1, dest, destWidth, pixelBytes, forcedBits);
+        }
+#endif
+        return 0;
+    }
+};
+
+template <size_t componentCount>
+struct FloatMipRowFilter
+{
+    static size_t averageRows(const uint8_t *row0, const uint8_t *row1, uint8_t *dest, size_t destWidth)
+    {
+#if defined(ANGLE_USE_SSE)
+        if (gl::supportsSSE2())
+        {
+            return AverageMipRowsFloats_SSE2(reinterpret_cast<const float*>(row0), reinterpret_cast<const float*>(row1),
+                                             reinterpret_cast<float*>(dest), destWidth, componentCount);
+        }
+#endif
+        return 0;
+    }
+};
+
+template <> struct MipRowFilter<L8>            : ByteMipRowFilter<1, 0> { };
+template <> struct MipRowFilter<R8>            : ByteMipRowFilter<1, 0> { };
+template <> struct MipRowFilter<A8>            : ByteMipRowFilter<1, 0> { };
+template <> struct MipRowFilter<L8A8>          : ByteMipRowFilter<2, 0> { };
+template <> struct MipRowFilter<A8L8>          : ByteMipRowFilter<2, 0> { };
+template <> struct MipRowFilter<R8G8>          : ByteMipRowFilter<2, 0> { };
+template <> struct MipRowFilter<R8G8B8A8>      : ByteMipRowFilter<4, 0> { };
+template <> struct MipRowFilter<B8G8R8A8>      : ByteMipRowFilter<4, 0> { };
+template <> struct MipRowFilter<B8G8R8X8>      : ByteMipRowFilter<4, 0xFF000000> { };
+template <> struct MipRowFilter<R32F>          : FloatMipRowFilter<1> { };
+template <> struct MipRowFilter<R32G32F>       : FloatMipRowFilter<2> { };
+template <> struct MipRowFilter<R32G32B32A32F> : FloatMipRowFilter<4> { };
+template <> struct MipRowFilter<A32B32G32R32F> : FloatMipRowFilter<4> { };
+
 template <typename T>
 static void GenerateMip_XY(size_t sourceWidth, size_t sourceHeight, size_t sourceDepth,
                            const uint8_t *sourceData, size_t sourceRowPitch, size_t sourceDepthPitch,
@@ -99,7 +155,12 @@ static void GenerateMip_XY(size_t sourceWidth, size_t sourceHeight, size_t sourc
 
     for (size_t y = 0; y < destHeight; y++)
     {
-        for (size_t x = 0; x < destWidth; x++)
+        size_t x = MipRowFilter<T>::averageRows(GetPixel<uint8_t>(sourceData, 0, y * 2, 0, sourceRowPitch, sourceDepthPitch),
+                                                GetPixel<uint8_t>(sourceData, 0, y * 2 + 1, 0, sourceRowPitch, sourceDepthPitch),
+                                                GetPixel<uint8_t>(destData, 0, y, 0, destRowPitch, destDepthPitch),
+                                                destWidth);
+
+        for (; x < destWidth; x++)
         {
             const T *src0 = GetPixel<T>(sourceData, x * 2, y * 2, 0, sourceRowPitch, sourceDepthPitch);
             const T *src1 = GetPixel<T>(sourceData, x * 2, y * 2 + 1, 0, sourceRowPitch, sourceDepthPitch);
@@ -0,0 +1,189 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// generatemipSSE2.cpp: Defines the SSE2 row filters used by GenerateMip. It's
+// in a separated file for GCC, which can enable SSE usage only per-file,
+// not for code blocks that use SSE2 explicitly.
+
+#include "libANGLE/renderer/d3d/generatemip.h"
+
+#include "common/platform.h"
+
+#ifdef ANGLE_USE_SSE
+#include <emmintrin.h>
+#endif
+
+namespace rx
+{
+
+#if defined(ANGLE_USE_SSE)
+namespace
+{
+
+// Matches gl::average for unsigned bytes, which rounds down where _mm_avg_epu8 rounds up.
+inline __m128i FloorAverageBytes(const __m128i &a, const __m128i &b)
+{
+    __m128i roundedBit = _mm_and_si128(_mm_xor_si128(a, b), _mm_set1_epi8(1));
+    return _mm_sub_epi8(_mm_avg_epu8(a, b), roundedBit);
+}
+
+// Narrows the low or high 16 bits of each 32-bit lane of two registers into one register.
+inline __m128i PackLow16(const __m128i &a, const __m128i &b)
+{
+    return _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(a, 16), 16), _mm_srai_epi32(_mm_slli_epi32(b, 16), 16));
+}
+
+inline __m128i PackHigh16(const __m128i &a, const __m128i &b)
+{
+    return _mm_packs_epi32(_mm_srai_epi32(a, 16), _mm_srai_epi32(b, 16));
+}
+
+// Splits 32 bytes of pixels into the even and the odd pixels.
+template <size_t pixelBytes>
+inline void SplitPixels(const __m128i &first, const __m128i &second, __m128i *even, __m128i *odd);
+
+template <>
+inline void SplitPixels<1>(const __m128i &first, const __m128i &second, __m128i *even, __m128i *odd)
+{
+    __m128i lowBytes = _mm_set1_epi16(0x00FF);
+    *even = _mm_packus_epi16(_mm_and_si128(first, lowBytes), _mm_and_si128(second, lowBytes));
+    *odd = _mm_packus_epi16(_mm_srli_epi16(first, 8), _mm_srli_epi16(second, 8));
+}
+
+template <>
+inline void SplitPixels<2>(const __m128i &first, const __m128i &second, __m128i *even, __m128i *odd)
+{
+    *even = PackLow16(first, second);
+    *odd = PackHigh16(first, second);
+}
+
+template <>
+inline void SplitPixels<4>(const __m128i &first, const __m128i &second, __m128i *even, __m128i *odd)
+{
+    __m128 firstPixels = _mm_castsi128_ps(first);
+    __m128 secondPixels = _mm_castsi128_ps(second);
+    *even = _mm_castps_si128(_mm_shuffle_ps(firstPixels, secondPixels, _MM_SHUFFLE(2, 0, 2, 0)));
+    *odd = _mm_castps_si128(_mm_shuffle_ps(firstPixels, secondPixels, _MM_SHUFFLE(3, 1, 3, 1)));
+}
+
+template <size_t pixelBytes>
+size_t AverageRowsBytes(const uint8_t *row0, const uint8_t *row1, uint8_t *dest, size_t destWidth, uint32_t forcedBits)
+{
+    const size_t blockPixels = 16 / pixelBytes;
+    __m128i forced = _mm_set1_epi32(forcedBits);
+
+    size_t x = 0;
+    for (; x + blockPixels <= destWidth; x += blockPixels)
+    {
+        const uint8_t *source0 = row0 + x * 2 * pixelBytes;
+        const uint8_t *source1 = row1 + x * 2 * pixelBytes;
+
+        // Average vertically first, then horizontally, in the same order as GenerateMip_XY
+        __m128i first = FloorAverageBytes(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source0)),
+                                          _mm_loadu_si128(reinterpret_cast<const __m128i*>(source1)));
+        __m128i second = FloorAverageBytes(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source0 + 16)),
+                                           _mm_loadu_si128(reinterpret_cast<const __m128i*>(source1 + 16)));
+
+        __m128i even, odd;
+        SplitPixels<pixelBytes>(first, second, &even, &odd);
+
+        __m128i result = _mm_or_si128(FloorAverageBytes(even, odd), forced);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + x * pixelBytes), result);
+    }
+
+    return x;
+}
+
+inline __m128 AverageFloats(const __m128 &a, const __m128 &b)
+{
+    return _mm_mul_ps(_mm_add_ps(a, b), _mm_set1_ps(0.5f));
+}
+
+template <size_t componentCount>
+inline void SplitFloatPixels(const __m128 &first, const __m128 &second, __m128 *even, __m128 *odd);
+
+template <>
+inline void SplitFloatPixels<1>(const __m128 &first, const __m128 &second, __m128 *even, __m128 *odd)
+{
+    *even = _mm_shuffle_ps(first, second, _MM_SHUFFLE(2, 0, 2, 0));
+    *odd = _mm_shuffle_ps(first, second, _MM_SHUFFLE(3, 1, 3, 1));
+}
+
+template <>
+inline void SplitFloatPixels<2>(const __m128 &first, const __m128 &second, __m128 *even, __m128 *odd)
+{
+    *even = _mm_shuffle_ps(first, second, _MM_SHUFFLE(1, 0, 1, 0));
+    *odd = _mm_shuffle_ps(first, second, _MM_SHUFFLE(3, 2, 3, 2));
+}
+
+template <>
+inline void SplitFloatPixels<4>(const __m128 &first, const __m128 &second, __m128 *even, __m128 *odd)
+{
+    *even = first;
+    *odd = second;
+}
+
+template <size_t componentCount>
+size_t AverageRowsFloats(const float *row0, const float *row1, float *dest, size_t destWidth)
+{
+    const size_t blockPixels = 4 / componentCount;
+
+    size_t x = 0;
+    for (; x + blockPixels <= destWidth; x += blockPixels)
+    {
+        const float *source0 = row0 + x * 2 * componentCount;
+        const float *source1 = row1 + x * 2 * componentCount;
+
+        __m128 first = AverageFloats(_mm_loadu_ps(source0), _mm_loadu_ps(source1));
+        __m128 second = AverageFloats(_mm_loadu_ps(source0 + 4), _mm_loadu_ps(source1 + 4));
+
+        __m128 even, odd;
+        SplitFloatPixels<componentCount>(first, second, &even, &odd);
+
+        _mm_storeu_ps(dest + x * componentCount, AverageFloats(even, odd));
+    }
+
+    return x;
+}
+
+}
+#endif // ANGLE_USE_SSE
+
+size_t AverageMipRowsBytes_SSE2(const uint8_t *row0, const uint8_t *row1, uint8_t *dest, size_t destWidth,
+                                size_t pixelBytes, uint32_t forcedBits)
+{
+#if defined(ANGLE_USE_SSE)
+    switch (pixelBytes)
+    {
+      case 1: return AverageRowsBytes<1>(row0, row1, dest, destWidth, forcedBits);
+      case 2: return AverageRowsBytes<2>(row0, row1, dest, destWidth, forcedBits);
+      case 4: return AverageRowsBytes<4>(row0, row1, dest, destWidth, forcedBits);
+      default: UNREACHABLE(); return 0;
+    }
+#else
+    UNIMPLEMENTED();
+    return 0;
+#endif
+}
+
+size_t AverageMipRowsFloats_SSE2(const float *row0, const float *row1, float *dest, size_t destWidth,
+                                 size_t componentCount)
+{
+#if defined(ANGLE_USE_SSE)
+    switch (componentCount)
+    {
+      case 1: return AverageRowsFloats<1>(row0, row1, dest, destWidth);
+      case 2: return AverageRowsFloats<2>(row0, row1, dest, destWidth);
+      case 4: return AverageRowsFloats<4>(row0, row1, dest, destWidth);
+      default: UNREACHABLE(); return 0;
+    }
+#else
+    UNIMPLEMENTED();
+    return 0;
+#endif
+}
+
+}
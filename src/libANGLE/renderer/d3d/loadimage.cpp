@@ -8,9 +8,15 @@
 
 #include "libANGLE/renderer/d3d/loadimage.h"
 
+#include <algorithm>
+
 namespace rx
 {
 
+// Rows that go through an intermediate float format are converted this many pixels at a time
+// using a stack buffer.
+static const size_t FloatRowChunkPixels = 64;
+
 void LoadA8ToRGBA8(size_t width, size_t height, size_t depth,
                    const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
                    uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
@@ -513,11 +519,12 @@ void LoadRGB16FToRGB9E5(size_t width, size_t height, size_t depth,
         {
             const uint16_t *source = OffsetDataPointer<uint16_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint32_t *dest = OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = 0; x < width; x += FloatRowChunkPixels)
             {
-                dest[x] = gl::convertRGBFloatsTo999E5(gl::float16ToFloat32(source[x * 3 + 0]),
-                                                      gl::float16ToFloat32(source[x * 3 + 1]),
-                                                      gl::float16ToFloat32(source[x * 3 + 2]));
+                size_t chunkWidth = std::min(FloatRowChunkPixels, width - x);
+                float chunk[FloatRowChunkPixels * 3];
+                gl::float16ToFloat32Array(&source[x * 3], chunk, chunkWidth * 3);
+                gl::convertRGBFloatsTo999E5Array(chunk, &dest[x], chunkWidth);
             }
         }
     }
@@ -533,10 +540,7 @@ void LoadRGB32FToRGB9E5(size_t width, size_t height, size_t depth,
         {
             const float *source = OffsetDataPointer<float>(input, y, z, inputRowPitch, inputDepthPitch);
             uint32_t *dest = OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
-            {
-                dest[x] = gl::convertRGBFloatsTo999E5(source[x * 3 + 0], source[x * 3 + 1], source[x * 3 + 2]);
-            }
+            gl::convertRGBFloatsTo999E5Array(source, dest, width);
         }
     }
 }
@@ -551,11 +555,12 @@ void LoadRGB16FToRG11B10F(size_t width, size_t height, size_t depth,
         {
             const uint16_t *source = OffsetDataPointer<uint16_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint32_t *dest = OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = 0; x < width; x += FloatRowChunkPixels)
             {
-                dest[x] = (gl::float32ToFloat11(gl::float16ToFloat32(source[x * 3 + 0])) <<  0) |
-                          (gl::float32ToFloat11(gl::float16ToFloat32(source[x * 3 + 1])) << 11) |
-                          (gl::float32ToFloat10(gl::float16ToFloat32(source[x * 3 + 2])) << 22);
+                size_t chunkWidth = std::min(FloatRowChunkPixels, width - x);
+                float chunk[FloatRowChunkPixels * 3];
+                gl::float16ToFloat32Array(&source[x * 3], chunk, chunkWidth * 3);
+                gl::convertRGBFloatsToR11G11B10Array(chunk, &dest[x], chunkWidth);
             }
         }
     }
@@ -571,12 +576,7 @@ void LoadRGB32FToRG11B10F(size_t width, size_t height, size_t depth,
         {
             const float *source = OffsetDataPointer<float>(input, y, z, inputRowPitch, inputDepthPitch);
             uint32_t *dest = OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
-            {
-                dest[x] = (gl::float32ToFloat11(source[x * 3 + 0]) <<  0) |
-                          (gl::float32ToFloat11(source[x * 3 + 1]) << 11) |
-                          (gl::float32ToFloat10(source[x * 3 + 2]) << 22);
-            }
+            gl::convertRGBFloatsToR11G11B10Array(source, dest, width);
         }
     }
 }
@@ -611,12 +611,18 @@ void LoadRGB32FToRGBA16F(size_t width, size_t height, size_t depth,
         {
             const float *source = OffsetDataPointer<float>(input, y, z, inputRowPitch, inputDepthPitch);
             uint16_t *dest = OffsetDataPointer<uint16_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = 0; x < width; x += FloatRowChunkPixels)
             {
-                dest[x * 4 + 0] = gl::float32ToFloat16(source[x * 3 + 0]);
-                dest[x * 4 + 1] = gl::float32ToFloat16(source[x * 3 + 1]);
-                dest[x * 4 + 2] = gl::float32ToFloat16(source[x * 3 + 2]);
-                dest[x * 4 + 3] = gl::Float16One;
+                size_t chunkWidth = std::min(FloatRowChunkPixels, width - x);
+                uint16_t chunk[FloatRowChunkPixels * 3];
+                gl::float32ToFloat16Array(&source[x * 3], chunk, chunkWidth * 3);
+                for (size_t i = 0; i < chunkWidth; i++)
+                {
+                    dest[(x + i) * 4 + 0] = chunk[i * 3 + 0];
+                    dest[(x + i) * 4 + 1] = chunk[i * 3 + 1];
+                    dest[(x + i) * 4 + 2] = chunk[i * 3 + 2];
+                    dest[(x + i) * 4 + 3] = gl::Float16One;
+                }
             }
         }
     }
@@ -659,4 +665,29 @@ void LoadR32ToR24G8(size_t width, size_t height, size_t depth,
     }
 }
 
+bool IsLoadToNative(LoadImageFunction loadFunction)
+{
+    static const LoadImageFunction nativeLoadFunctions[] =
+    {
+        LoadToNative<GLubyte, 1>,  LoadToNative<GLubyte, 2>,  LoadToNative<GLubyte, 3>,  LoadToNative<GLubyte, 4>,
+        LoadToNative<GLbyte, 1>,   LoadToNative<GLbyte, 2>,   LoadToNative<GLbyte, 3>,   LoadToNative<GLbyte, 4>,
+        LoadToNative<GLushort, 1>, LoadToNative<GLushort, 2>, LoadToNative<GLushort, 3>, LoadToNative<GLushort, 4>,
+        LoadToNative<GLshort, 1>,  LoadToNative<GLshort, 2>,  LoadToNative<GLshort, 3>,  LoadToNative<GLshort, 4>,
+        LoadToNative<GLuint, 1>,   LoadToNative<GLuint, 2>,   LoadToNative<GLuint, 3>,   LoadToNative<GLuint, 4>,
+        LoadToNative<GLint, 1>,    LoadToNative<GLint, 2>,    LoadToNative<GLint, 3>,    LoadToNative<GLint, 4>,
+        LoadToNative<GLfloat, 1>,  LoadToNative<GLfloat, 2>,  LoadToNative<GLfloat, 3>,  LoadToNative<GLfloat, 4>,
+    };
+
+    // GLhalf is the same type as GLushort, so its loads are already in the list
+    for (size_t i = 0; i < ArraySize(nativeLoadFunctions); i++)
+    {
+        if (loadFunction == nativeLoadFunctions[i])
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 }
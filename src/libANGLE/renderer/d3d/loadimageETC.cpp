@@ -0,0 +1,527 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// loadimageETC.cpp: Decodes ETC2 and EAC compressed images, as defined in
+// appendix C of the OpenGL ES 3.0 specification, to uncompressed formats.
+
+#include "libANGLE/renderer/d3d/loadimage.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace rx
+{
+
+namespace
+{
+
+// Images with more decoded data than this are decoded on several threads
+const size_t DecodeThreadingMinimumBytes = 1024 * 1024;
+const size_t DecodeMaxThreads = 8;
+
+// Table C.5, intensity modifiers of the individual and differential modes
+const int ETCIntensityModifiers[8][2] =
+{
+    {  2,   8 },
+    {  5,  17 },
+    {  9,  29 },
+    { 13,  42 },
+    { 18,  60 },
+    { 24,  80 },
+    { 33, 106 },
+    { 47, 183 },
+};
+
+// Table C.8, distances of the T and H modes
+const int ETCDistances[8] = { 3, 6, 11, 16, 23, 32, 41, 64 };
+
+// Table C.10, modifiers of EAC blocks
+const int EACModifiers[16][8] =
+{
+    { -3, -6,  -9, -15, 2, 5, 8, 14 },
+    { -3, -7, -10, -13, 2, 6, 9, 12 },
+    { -2, -5,  -8, -13, 1, 4, 7, 12 },
+    { -2, -4,  -6, -13, 1, 3, 5, 12 },
+    { -3, -6,  -8, -12, 2, 5, 7, 11 },
+    { -3, -7,  -9, -11, 2, 6, 8, 10 },
+    { -4, -7,  -8, -11, 3, 6, 7, 10 },
+    { -3, -5,  -8, -11, 2, 4, 7, 10 },
+    { -2, -6,  -8, -10, 1, 5, 7,  9 },
+    { -2, -5,  -8, -10, 1, 4, 7,  9 },
+    { -2, -4,  -8, -10, 1, 3, 7,  9 },
+    { -2, -5,  -7, -10, 1, 4, 6,  9 },
+    { -3, -4,  -7, -10, 2, 3, 6,  9 },
+    { -1, -2,  -3, -10, 0, 1, 2,  9 },
+    { -4, -6,  -8,  -9, 3, 5, 7,  8 },
+    { -3, -5,  -7,  -9, 2, 4, 6,  8 },
+};
+
+// Blocks are stored as 64-bit big endian words
+inline uint64_t ReadBlockBits(const uint8_t *block)
+{
+    uint64_t bits = 0;
+    for (size_t i = 0; i < 8; i++)
+    {
+        bits = (bits << 8) | block[i];
+    }
+    return bits;
+}
+
+inline int GetBits(uint64_t bits, size_t lowestBit, size_t count)
+{
+    return static_cast<int>((bits >> lowestBit) & ((1u << count) - 1));
+}
+
+// Pixels are numbered down the columns of the block
+inline size_t GetPixelNumber(size_t x, size_t y)
+{
+    return x * 4 + y;
+}
+
+inline uint8_t ClampByte(int value)
+{
+    return static_cast<uint8_t>(std::min(std::max(value, 0), 255));
+}
+
+inline int Extend4To8(int value) { return (value << 4) | value; }
+inline int Extend5To8(int value) { return (value << 3) | (value >> 2); }
+inline int Extend6To8(int value) { return (value << 2) | (value >> 4); }
+inline int Extend7To8(int value) { return (value << 1) | (value >> 6); }
+
+inline void SetColor(uint8_t *color, int red, int green, int blue)
+{
+    color[0] = ClampByte(red);
+    color[1] = ClampByte(green);
+    color[2] = ClampByte(blue);
+    color[3] = 255;
+}
+
+inline void SetTransparent(uint8_t *color)
+{
+    color[0] = 0;
+    color[1] = 0;
+    color[2] = 0;
+    color[3] = 0;
+}
+
+// Fills the four colors a subblock of the individual or differential modes can select. Punchthrough
+// blocks without the opaque flag lose the smaller modifiers: index 0 selects the base color and
+// index 2 is transparent.
+void FillSubblockPalette(int red, int green, int blue, int table, bool opaque, uint8_t palette[4][4])
+{
+    const int smallModifier = opaque ? ETCIntensityModifiers[table][0] : 0;
+    const int largeModifier = ETCIntensityModifiers[table][1];
+
+    SetColor(palette[0], red + smallModifier, green + smallModifier, blue + smallModifier);
+    SetColor(palette[1], red + largeModifier, green + largeModifier, blue + largeModifier);
+    SetColor(palette[2], red - smallModifier, green - smallModifier, blue - smallModifier);
+    SetColor(palette[3], red - largeModifier, green - largeModifier, blue - largeModifier);
+
+    if (!opaque)
+    {
+        SetTransparent(palette[2]);
+    }
+}
+
+void DecodePlanarBlock(uint64_t bits, uint8_t *pixels)
+{
+    const int redOrigin = Extend6To8(GetBits(bits, 57, 6));
+    const int greenOrigin = Extend7To8((GetBits(bits, 56, 1) << 6) | GetBits(bits, 49, 6));
+    const int blueOrigin = Extend6To8((GetBits(bits, 48, 1) << 5) | (GetBits(bits, 43, 2) << 3) | GetBits(bits, 39, 3));
+    const int redHorizontal = Extend6To8((GetBits(bits, 34, 5) << 1) | GetBits(bits, 32, 1));
+    const int greenHorizontal = Extend7To8(GetBits(bits, 25, 7));
+    const int blueHorizontal = Extend6To8(GetBits(bits, 19, 6));
+    const int redVertical = Extend6To8(GetBits(bits, 13, 6));
+    const int greenVertical = Extend7To8(GetBits(bits, 6, 7));
+    const int blueVertical = Extend6To8(GetBits(bits, 0, 6));
+
+    for (int y = 0; y < 4; y++)
+    {
+        for (int x = 0; x < 4; x++)
+        {
+            // Negative sums clamp to zero, so only shift the positive ones
+            int red = x * (redHorizontal - redOrigin) + y * (redVertical - redOrigin) + 4 * redOrigin + 2;
+            int green = x * (greenHorizontal - greenOrigin) + y * (greenVertical - greenOrigin) + 4 * greenOrigin + 2;
+            int blue = x * (blueHorizontal - blueOrigin) + y * (blueVertical - blueOrigin) + 4 * blueOrigin + 2;
+            SetColor(pixels + (y * 4 + x) * 4, std::max(red, 0) >> 2, std::max(green, 0) >> 2, std::max(blue, 0) >> 2);
+        }
+    }
+}
+
+// Decodes the RGB part of an ETC2 block to 16 RGBA8 pixels, stored row by row. Punchthrough blocks
+// are always in one of the differential modes and use bit 33 as an opaque flag instead.
+void DecodeETC2RGBBlock(uint64_t bits, bool punchthrough, uint8_t *pixels)
+{
+    const bool differential = punchthrough || GetBits(bits, 33, 1) != 0;
+    const bool opaque = !punchthrough || GetBits(bits, 33, 1) != 0;
+
+    // The T and H modes use the first palette for the whole block
+    uint8_t palettes[2][4][4];
+    bool subblocks = true;
+
+    if (!differential)
+    {
+        const int table0 = GetBits(bits, 37, 3);
+        const int table1 = GetBits(bits, 34, 3);
+        FillSubblockPalette(Extend4To8(GetBits(bits, 60, 4)), Extend4To8(GetBits(bits, 52, 4)), Extend4To8(GetBits(bits, 44, 4)),
+                            table0, opaque, palettes[0]);
+        FillSubblockPalette(Extend4To8(GetBits(bits, 56, 4)), Extend4To8(GetBits(bits, 48, 4)), Extend4To8(GetBits(bits, 40, 4)),
+                            table1, opaque, palettes[1]);
+    }
+    else
+    {
+        const int red = GetBits(bits, 59, 5);
+        const int green = GetBits(bits, 51, 5);
+        const int blue = GetBits(bits, 43, 5);
+
+        // The deltas are 3-bit two's complement values
+        const int red2 = red + ((GetBits(bits, 56, 3) ^ 4) - 4);
+        const int green2 = green + ((GetBits(bits, 48, 3) ^ 4) - 4);
+        const int blue2 = blue + ((GetBits(bits, 40, 3) ^ 4) - 4);
+
+        if (red2 < 0 || red2 > 31)
+        {
+            // T mode
+            const int red0 = Extend4To8((GetBits(bits, 59, 2) << 2) | GetBits(bits, 56, 2));
+            const int green0 = Extend4To8(GetBits(bits, 52, 4));
+            const int blue0 = Extend4To8(GetBits(bits, 48, 4));
+            const int red1 = Extend4To8(GetBits(bits, 44, 4));
+            const int green1 = Extend4To8(GetBits(bits, 40, 4));
+            const int blue1 = Extend4To8(GetBits(bits, 36, 4));
+            const int distance = ETCDistances[(GetBits(bits, 34, 2) << 1) | GetBits(bits, 32, 1)];
+
+            SetColor(palettes[0][0], red0, green0, blue0);
+            SetColor(palettes[0][1], red1 + distance, green1 + distance, blue1 + distance);
+            SetColor(palettes[0][2], red1, green1, blue1);
+            SetColor(palettes[0][3], red1 - distance, green1 - distance, blue1 - distance);
+            subblocks = false;
+        }
+        else if (green2 < 0 || green2 > 31)
+        {
+            // H mode
+            const int packed0 = (GetBits(bits, 59, 4) << 8) | (((GetBits(bits, 56, 3) << 1) | GetBits(bits, 52, 1)) << 4) |
+                                ((GetBits(bits, 51, 1) << 3) | GetBits(bits, 47, 3));
+            const int packed1 = (GetBits(bits, 43, 4) << 8) | (GetBits(bits, 39, 4) << 4) | GetBits(bits, 35, 4);
+
+            // The lowest bit of the distance index comes from the ordering of the two colors
+            const int distanceIndex = (GetBits(bits, 34, 1) << 2) | (GetBits(bits, 32, 1) << 1) | (packed0 >= packed1 ? 1 : 0);
+            const int distance = ETCDistances[distanceIndex];
+
+            const int red0 = Extend4To8(packed0 >> 8);
+            const int green0 = Extend4To8((packed0 >> 4) & 0xF);
+            const int blue0 = Extend4To8(packed0 & 0xF);
+            const int red1 = Extend4To8(packed1 >> 8);
+            const int green1 = Extend4To8((packed1 >> 4) & 0xF);
+            const int blue1 = Extend4To8(packed1 & 0xF);
+
+            SetColor(palettes[0][0], red0 + distance, green0 + distance, blue0 + distance);
+            SetColor(palettes[0][1], red0 - distance, green0 - distance, blue0 - distance);
+            SetColor(palettes[0][2], red1 + distance, green1 + distance, blue1 + distance);
+            SetColor(palettes[0][3], red1 - distance, green1 - distance, blue1 - distance);
+            subblocks = false;
+        }
+        else if (blue2 < 0 || blue2 > 31)
+        {
+            // Planar blocks are opaque even in punchthrough images
+            DecodePlanarBlock(bits, pixels);
+            return;
+        }
+        else
+        {
+            const int table0 = GetBits(bits, 37, 3);
+            const int table1 = GetBits(bits, 34, 3);
+            FillSubblockPalette(Extend5To8(red), Extend5To8(green), Extend5To8(blue), table0, opaque, palettes[0]);
+            FillSubblockPalette(Extend5To8(red2), Extend5To8(green2), Extend5To8(blue2), table1, opaque, palettes[1]);
+        }
+
+        if (!subblocks && !opaque)
+        {
+            SetTransparent(palettes[0][2]);
+        }
+    }
+
+    const bool flip = GetBits(bits, 32, 1) != 0;
+    for (size_t y = 0; y < 4; y++)
+    {
+        for (size_t x = 0; x < 4; x++)
+        {
+            size_t pixel = GetPixelNumber(x, y);
+            int index = (GetBits(bits, 16 + pixel, 1) << 1) | GetBits(bits, pixel, 1);
+            size_t subblock = subblocks ? (flip ? y / 2 : x / 2) : 0;
+
+            const uint8_t *color = palettes[subblock][index];
+            std::copy(color, color + 4, pixels + (y * 4 + x) * 4);
+        }
+    }
+}
+
+// Decodes the 8-bit values of an EAC alpha block, stored row by row with the given stride.
+void DecodeEACAlphaBlock(uint64_t bits, uint8_t *values, size_t stride)
+{
+    const int base = GetBits(bits, 56, 8);
+    const int multiplier = GetBits(bits, 52, 4);
+    const int *modifiers = EACModifiers[GetBits(bits, 48, 4)];
+
+    for (size_t y = 0; y < 4; y++)
+    {
+        for (size_t x = 0; x < 4; x++)
+        {
+            int index = GetBits(bits, 45 - 3 * GetPixelNumber(x, y), 3);
+            values[(y * 4 + x) * stride] = ClampByte(base + modifiers[index] * multiplier);
+        }
+    }
+}
+
+// Decodes the 11-bit values of an R11 or signed R11 EAC block, stored row by row. Signed values
+// range from -1023 to 1023.
+void DecodeEAC11Block(uint64_t bits, bool isSigned, int *values)
+{
+    const int multiplier = GetBits(bits, 52, 4);
+    const int *modifiers = EACModifiers[GetBits(bits, 48, 4)];
+
+    int base = 0;
+    if (isSigned)
+    {
+        base = std::max(static_cast<int>(static_cast<int8_t>(GetBits(bits, 56, 8))), -127) * 8;
+    }
+    else
+    {
+        base = GetBits(bits, 56, 8) * 8 + 4;
+    }
+
+    const int minimum = isSigned ? -1023 : 0;
+    const int maximum = isSigned ? 1023 : 2047;
+
+    for (size_t y = 0; y < 4; y++)
+    {
+        for (size_t x = 0; x < 4; x++)
+        {
+            // A zero multiplier still applies the modifiers, at an eighth of the usual scale
+            int modifier = modifiers[GetBits(bits, 45 - 3 * GetPixelNumber(x, y), 3)];
+            int value = base + ((multiplier != 0) ? modifier * multiplier * 8 : modifier);
+            values[y * 4 + x] = std::min(std::max(value, minimum), maximum);
+        }
+    }
+}
+
+inline uint8_t Unorm11ToUnorm8(int value)
+{
+    return static_cast<uint8_t>((value * 255 + 1023) / 2047);
+}
+
+inline int16_t Snorm11ToSnorm16(int value)
+{
+    int magnitude = std::abs(value);
+    magnitude = (magnitude << 5) | (magnitude >> 5);
+    return static_cast<int16_t>((value < 0) ? -magnitude : magnitude);
+}
+
+void DecodeETC2RGB8Block(const uint8_t *block, uint8_t *pixels)
+{
+    DecodeETC2RGBBlock(ReadBlockBits(block), false, pixels);
+}
+
+void DecodeETC2RGB8A1Block(const uint8_t *block, uint8_t *pixels)
+{
+    DecodeETC2RGBBlock(ReadBlockBits(block), true, pixels);
+}
+
+void DecodeETC2RGBA8Block(const uint8_t *block, uint8_t *pixels)
+{
+    // The alpha block comes first
+    DecodeETC2RGBBlock(ReadBlockBits(block + 8), false, pixels);
+    DecodeEACAlphaBlock(ReadBlockBits(block), pixels + 3, 4);
+}
+
+void DecodeEACR11Block(const uint8_t *block, uint8_t *pixels)
+{
+    int values[16];
+    DecodeEAC11Block(ReadBlockBits(block), false, values);
+    for (size_t i = 0; i < 16; i++)
+    {
+        pixels[i] = Unorm11ToUnorm8(values[i]);
+    }
+}
+
+void DecodeEACR11SBlock(const uint8_t *block, uint8_t *pixels)
+{
+    int values[16];
+    DecodeEAC11Block(ReadBlockBits(block), true, values);
+
+    int16_t *dest = reinterpret_cast<int16_t*>(pixels);
+    for (size_t i = 0; i < 16; i++)
+    {
+        dest[i] = Snorm11ToSnorm16(values[i]);
+    }
+}
+
+void DecodeEACRG11Block(const uint8_t *block, uint8_t *pixels)
+{
+    for (size_t channel = 0; channel < 2; channel++)
+    {
+        int values[16];
+        DecodeEAC11Block(ReadBlockBits(block + channel * 8), false, values);
+        for (size_t i = 0; i < 16; i++)
+        {
+            pixels[i * 2 + channel] = Unorm11ToUnorm8(values[i]);
+        }
+    }
+}
+
+void DecodeEACRG11SBlock(const uint8_t *block, uint8_t *pixels)
+{
+    int16_t *dest = reinterpret_cast<int16_t*>(pixels);
+    for (size_t channel = 0; channel < 2; channel++)
+    {
+        int values[16];
+        DecodeEAC11Block(ReadBlockBits(block + channel * 8), true, values);
+        for (size_t i = 0; i < 16; i++)
+        {
+            dest[i * 2 + channel] = Snorm11ToSnorm16(values[i]);
+        }
+    }
+}
+
+typedef void (*DecodeBlockFunction)(const uint8_t *block, uint8_t *pixels);
+
+struct BlockImage
+{
+    size_t width;
+    size_t height;
+    const uint8_t *input;
+    size_t inputRowPitch;
+    size_t inputDepthPitch;
+    uint8_t *output;
+    size_t outputRowPitch;
+    size_t outputDepthPitch;
+};
+
+// Decodes rows of blocks [firstRow, lastRow), counted across all the slices of the image. Blocks
+// on the right and bottom edges are clipped to the image.
+template <size_t blockBytes, size_t pixelBytes, DecodeBlockFunction decodeBlock>
+void DecodeBlockRows(const BlockImage *image, size_t firstRow, size_t lastRow)
+{
+    const size_t rowsPerSlice = (image->height + 3) / 4;
+    const size_t columns = (image->width + 3) / 4;
+
+    for (size_t row = firstRow; row < lastRow; row++)
+    {
+        const size_t z = row / rowsPerSlice;
+        const size_t y = (row % rowsPerSlice) * 4;
+        const size_t rowHeight = std::min<size_t>(4, image->height - y);
+
+        const uint8_t *source = OffsetDataPointer<uint8_t>(image->input, row % rowsPerSlice, z, image->inputRowPitch, image->inputDepthPitch);
+        uint8_t *dest = OffsetDataPointer<uint8_t>(image->output, y, z, image->outputRowPitch, image->outputDepthPitch);
+
+        for (size_t column = 0; column < columns; column++)
+        {
+            uint32_t pixels[16 * pixelBytes / sizeof(uint32_t)];
+            uint8_t *decoded = reinterpret_cast<uint8_t*>(pixels);
+            decodeBlock(source + column * blockBytes, decoded);
+
+            const size_t x = column * 4;
+            const size_t columnWidth = std::min<size_t>(4, image->width - x);
+            for (size_t blockY = 0; blockY < rowHeight; blockY++)
+            {
+                memcpy(dest + blockY * image->outputRowPitch + x * pixelBytes, decoded + blockY * 4 * pixelBytes,
+                       columnWidth * pixelBytes);
+            }
+        }
+    }
+}
+
+template <size_t blockBytes, size_t pixelBytes, DecodeBlockFunction decodeBlock>
+void LoadBlocks(size_t width, size_t height, size_t depth,
+                const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    const BlockImage image = { width, height, input, inputRowPitch, inputDepthPitch, output, outputRowPitch, outputDepthPitch };
+    const size_t rowCount = depth * ((height + 3) / 4);
+
+    size_t threadCount = 1;
+    if (width * height * depth * pixelBytes >= DecodeThreadingMinimumBytes)
+    {
+        size_t hardwareThreads = std::thread::hardware_concurrency();
+        threadCount = std::max<size_t>(1, std::min(std::min(hardwareThreads, DecodeMaxThreads), rowCount));
+    }
+
+    // Rows of blocks are independent, so each thread decodes its own run of them
+    std::vector<std::thread> workers;
+    for (size_t thread = 1; thread < threadCount; thread++)
+    {
+        workers.push_back(std::thread(DecodeBlockRows<blockBytes, pixelBytes, decodeBlock>, &image,
+                                      rowCount * thread / threadCount, rowCount * (thread + 1) / threadCount));
+    }
+    DecodeBlockRows<blockBytes, pixelBytes, decodeBlock>(&image, 0, rowCount / threadCount);
+
+    for (size_t thread = 0; thread < workers.size(); thread++)
+    {
+        workers[thread].join();
+    }
+}
+
+}
+
+void LoadETC2RGB8ToRGBA8(size_t width, size_t height, size_t depth,
+                         const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                         uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    LoadBlocks<8, 4, DecodeETC2RGB8Block>(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                                          output, outputRowPitch, outputDepthPitch);
+}
+
+void LoadETC2RGB8A1ToRGBA8(size_t width, size_t height, size_t depth,
+                           const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                           uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    LoadBlocks<8, 4, DecodeETC2RGB8A1Block>(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                                            output, outputRowPitch, outputDepthPitch);
+}
+
+void LoadETC2RGBA8ToRGBA8(size_t width, size_t height, size_t depth,
+                          const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                          uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    LoadBlocks<16, 4, DecodeETC2RGBA8Block>(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                                            output, outputRowPitch, outputDepthPitch);
+}
+
+void LoadEACR11ToR8(size_t width, size_t height, size_t depth,
+                    const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                    uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    LoadBlocks<8, 1, DecodeEACR11Block>(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                                        output, outputRowPitch, outputDepthPitch);
+}
+
+void LoadEACR11SToR16(size_t width, size_t height, size_t depth,
+                      const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                      uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    LoadBlocks<8, 2, DecodeEACR11SBlock>(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                                         output, outputRowPitch, outputDepthPitch);
+}
+
+void LoadEACRG11ToRG8(size_t width, size_t height, size_t depth,
+                      const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                      uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    LoadBlocks<16, 2, DecodeEACRG11Block>(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                                          output, outputRowPitch, outputDepthPitch);
+}
+
+void LoadEACRG11SToRG16(size_t width, size_t height, size_t depth,
+                        const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                        uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    LoadBlocks<16, 4, DecodeEACRG11SBlock>(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                                           output, outputRowPitch, outputDepthPitch);
+}
+
+}
@@ -19,6 +19,242 @@
 namespace rx
 {
 
+#if defined(ANGLE_USE_SSE)
+namespace
+{
+
+// Drives a converter from a source format to 32-bit pixels. Leading pixels are converted one at a time
+// until the destination is 16-byte aligned, then Converter::Block handles BlockPixels pixels per step
+// while at least BlockReadPixels pixels remain. Converter::Pixel matches the scalar loader exactly.
+template <typename Converter>
+void LoadTo32Bit(size_t width, size_t height, size_t depth,
+                 const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                 uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    for (size_t z = 0; z < depth; z++)
+    {
+        for (size_t y = 0; y < height; y++)
+        {
+            const uint8_t *source = OffsetDataPointer<uint8_t>(input, y, z, inputRowPitch, inputDepthPitch);
+            uint32_t *dest = OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch, outputDepthPitch);
+
+            size_t x = 0;
+
+            // Make output writes aligned
+            for (; ((reinterpret_cast<intptr_t>(&dest[x]) & 15) != 0) && x < width; x++)
+            {
+                dest[x] = Converter::Pixel(source, x);
+            }
+
+            for (; x + Converter::BlockReadPixels <= width; x += Converter::BlockPixels)
+            {
+                Converter::Block(source, x, &dest[x]);
+            }
+
+            // Handle the remainder
+            for (; x < width; x++)
+            {
+                dest[x] = Converter::Pixel(source, x);
+            }
+        }
+    }
+}
+
+// Interleaves two registers of 16-bit channel pairs into eight 32-bit pixels.
+inline void StorePixelPairs(const __m128i &lowPairs, const __m128i &highPairs, uint32_t *dest)
+{
+    _mm_store_si128(reinterpret_cast<__m128i*>(dest), _mm_unpacklo_epi16(lowPairs, highPairs));
+    _mm_store_si128(reinterpret_cast<__m128i*>(dest + 4), _mm_unpackhi_epi16(lowPairs, highPairs));
+}
+
+// Stores 16-bit lanes holding 8-bit channel values as eight RGBA8 or BGRA8 pixels.
+template <bool bgra>
+inline void StoreChannels(const __m128i &r, const __m128i &g, const __m128i &b, const __m128i &a, uint32_t *dest)
+{
+    const __m128i &first = (bgra ? b : r);
+    const __m128i &third = (bgra ? r : b);
+    StorePixelPairs(_mm_or_si128(first, _mm_slli_epi16(g, 8)), _mm_or_si128(third, _mm_slli_epi16(a, 8)), dest);
+}
+
+template <bool bgra>
+inline uint32_t PackChannels(uint32_t r, uint32_t g, uint32_t b, uint32_t a)
+{
+    return (bgra ? (b | (g << 8) | (r << 16)) : (r | (g << 8) | (b << 16))) | (a << 24);
+}
+
+inline __m128i Expand4To8(const __m128i &value)
+{
+    return _mm_or_si128(_mm_slli_epi16(value, 4), value);
+}
+
+inline __m128i Expand5To8(const __m128i &value)
+{
+    return _mm_or_si128(_mm_slli_epi16(value, 3), _mm_srli_epi16(value, 2));
+}
+
+inline __m128i Expand6To8(const __m128i &value)
+{
+    return _mm_or_si128(_mm_slli_epi16(value, 2), _mm_srli_epi16(value, 4));
+}
+
+struct L8Converter
+{
+    static const size_t BlockPixels = 16;
+    static const size_t BlockReadPixels = 16;
+
+    static uint32_t Pixel(const uint8_t *source, size_t x)
+    {
+        return (source[x] * 0x00010101u) | 0xFF000000u;
+    }
+
+    static void Block(const uint8_t *source, size_t x, uint32_t *dest)
+    {
+        __m128i luminance = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&source[x]));
+        __m128i alpha = _mm_set1_epi8(static_cast<char>(0xFF));
+        // (L, L) and (L, A) byte pairs
+        __m128i llLo = _mm_unpacklo_epi8(luminance, luminance);
+        __m128i llHi = _mm_unpackhi_epi8(luminance, luminance);
+        __m128i laLo = _mm_unpacklo_epi8(luminance, alpha);
+        __m128i laHi = _mm_unpackhi_epi8(luminance, alpha);
+        StorePixelPairs(llLo, laLo, dest);
+        StorePixelPairs(llHi, laHi, dest + 8);
+    }
+};
+
+struct LA8Converter
+{
+    static const size_t BlockPixels = 8;
+    static const size_t BlockReadPixels = 8;
+
+    static uint32_t Pixel(const uint8_t *source, size_t x)
+    {
+        return (source[2 * x] * 0x00010101u) | (static_cast<uint32_t>(source[2 * x + 1]) << 24);
+    }
+
+    static void Block(const uint8_t *source, size_t x, uint32_t *dest)
+    {
+        __m128i la = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&source[2 * x]));
+        __m128i luminance = _mm_and_si128(la, _mm_set1_epi16(0x00FF));
+        __m128i ll = _mm_or_si128(luminance, _mm_slli_epi16(luminance, 8));
+        StorePixelPairs(ll, la, dest);
+    }
+};
+
+struct RGB8ToBGRX8Converter
+{
+    // Four pixels are converted per step, but the 16-byte load reads into a sixth pixel
+    static const size_t BlockPixels = 4;
+    static const size_t BlockReadPixels = 6;
+
+    static uint32_t Pixel(const uint8_t *source, size_t x)
+    {
+        return PackChannels<true>(source[3 * x], source[3 * x + 1], source[3 * x + 2], 0xFF);
+    }
+
+    static void Block(const uint8_t *source, size_t x, uint32_t *dest)
+    {
+        __m128i rgb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&source[3 * x]));
+        // Gather each pixel's three bytes into the low bytes of its own 32-bit lane
+        __m128i pixels01 = _mm_unpacklo_epi32(rgb, _mm_srli_si128(rgb, 3));
+        __m128i pixels23 = _mm_unpacklo_epi32(_mm_srli_si128(rgb, 6), _mm_srli_si128(rgb, 9));
+        __m128i pixels = _mm_unpacklo_epi64(pixels01, pixels23);
+
+        __m128i byteMask = _mm_set1_epi32(0xFF);
+        __m128i red = _mm_slli_epi32(_mm_and_si128(pixels, byteMask), 16);
+        __m128i green = _mm_and_si128(pixels, _mm_set1_epi32(0xFF00));
+        __m128i blue = _mm_and_si128(_mm_srli_epi32(pixels, 16), byteMask);
+        __m128i alpha = _mm_set1_epi32(0xFF000000);
+
+        __m128i result = _mm_or_si128(_mm_or_si128(red, green), _mm_or_si128(blue, alpha));
+        _mm_store_si128(reinterpret_cast<__m128i*>(dest), result);
+    }
+};
+
+template <bool bgra>
+struct R5G6B5Converter
+{
+    static const size_t BlockPixels = 8;
+    static const size_t BlockReadPixels = 8;
+
+    static uint32_t Pixel(const uint8_t *source, size_t x)
+    {
+        uint16_t rgb = reinterpret_cast<const uint16_t*>(source)[x];
+        uint32_t r = ((rgb & 0xF800) >> 8) | ((rgb & 0xF800) >> 13);
+        uint32_t g = (((rgb & 0x07E0) >> 3) | ((rgb & 0x07E0) >> 9)) & 0xFF;
+        uint32_t b = (((rgb & 0x001F) << 3) | ((rgb & 0x001F) >> 2));
+        return PackChannels<bgra>(r, g, b, 0xFF);
+    }
+
+    static void Block(const uint8_t *source, size_t x, uint32_t *dest)
+    {
+        __m128i rgb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&source[2 * x]));
+        __m128i r = Expand5To8(_mm_srli_epi16(rgb, 11));
+        __m128i g = Expand6To8(_mm_and_si128(_mm_srli_epi16(rgb, 5), _mm_set1_epi16(0x3F)));
+        __m128i b = Expand5To8(_mm_and_si128(rgb, _mm_set1_epi16(0x1F)));
+        StoreChannels<bgra>(r, g, b, _mm_set1_epi16(0xFF), dest);
+    }
+};
+
+template <bool bgra>
+struct RGBA4Converter
+{
+    static const size_t BlockPixels = 8;
+    static const size_t BlockReadPixels = 8;
+
+    static uint32_t Pixel(const uint8_t *source, size_t x)
+    {
+        uint16_t rgba = reinterpret_cast<const uint16_t*>(source)[x];
+        uint32_t r = ((rgba & 0xF000) >> 8) | ((rgba & 0xF000) >> 12);
+        uint32_t g = ((rgba & 0x0F00) >> 4) | ((rgba & 0x0F00) >> 8);
+        uint32_t b = ((rgba & 0x00F0) << 0) | ((rgba & 0x00F0) >> 4);
+        uint32_t a = ((rgba & 0x000F) << 4) | ((rgba & 0x000F) >> 0);
+        return PackChannels<bgra>(r, g, b, a);
+    }
+
+    static void Block(const uint8_t *source, size_t x, uint32_t *dest)
+    {
+        __m128i rgba = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&source[2 * x]));
+        __m128i nibbleMask = _mm_set1_epi16(0xF);
+        __m128i r = Expand4To8(_mm_srli_epi16(rgba, 12));
+        __m128i g = Expand4To8(_mm_and_si128(_mm_srli_epi16(rgba, 8), nibbleMask));
+        __m128i b = Expand4To8(_mm_and_si128(_mm_srli_epi16(rgba, 4), nibbleMask));
+        __m128i a = Expand4To8(_mm_and_si128(rgba, nibbleMask));
+        StoreChannels<bgra>(r, g, b, a, dest);
+    }
+};
+
+template <bool bgra>
+struct RGB5A1Converter
+{
+    static const size_t BlockPixels = 8;
+    static const size_t BlockReadPixels = 8;
+
+    static uint32_t Pixel(const uint8_t *source, size_t x)
+    {
+        uint16_t rgba = reinterpret_cast<const uint16_t*>(source)[x];
+        uint32_t r = ((rgba & 0xF800) >> 8) | ((rgba & 0xF800) >> 13);
+        uint32_t g = (((rgba & 0x07C0) >> 3) | ((rgba & 0x07C0) >> 8)) & 0xFF;
+        uint32_t b = (((rgba & 0x003E) << 2) | ((rgba & 0x003E) >> 3)) & 0xFF;
+        uint32_t a = (rgba & 0x0001) ? 0xFF : 0;
+        return PackChannels<bgra>(r, g, b, a);
+    }
+
+    static void Block(const uint8_t *source, size_t x, uint32_t *dest)
+    {
+        __m128i rgba = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&source[2 * x]));
+        __m128i fiveBitMask = _mm_set1_epi16(0x1F);
+        __m128i r = Expand5To8(_mm_srli_epi16(rgba, 11));
+        __m128i g = Expand5To8(_mm_and_si128(_mm_srli_epi16(rgba, 6), fiveBitMask));
+        __m128i b = Expand5To8(_mm_and_si128(_mm_srli_epi16(rgba, 1), fiveBitMask));
+        // Replicate the alpha bit across the lane, then keep the low byte
+        __m128i a = _mm_srli_epi16(_mm_srai_epi16(_mm_slli_epi16(rgba, 15), 15), 8);
+        StoreChannels<bgra>(r, g, b, a, dest);
+    }
+};
+
+}
+#endif // ANGLE_USE_SSE
+
 void LoadA8ToBGRA8_SSE2(size_t width, size_t height, size_t depth,
                         const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
                         uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
@@ -121,5 +357,112 @@ void LoadRGBA8ToBGRA8_SSE2(size_t width, size_t height, size_t depth,
 #endif
 }
 
+void LoadL8ToRGBA8_SSE2(size_t width, size_t height, size_t depth,
+                        const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                        uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+#if defined(ANGLE_USE_SSE)
+    LoadTo32Bit<L8Converter>(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                             output, outputRowPitch, outputDepthPitch);
+#else
+    UNIMPLEMENTED();
+#endif
+}
+
+void LoadLA8ToRGBA8_SSE2(size_t width, size_t height, size_t depth,
+                         const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                         uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+#if defined(ANGLE_USE_SSE)
+    LoadTo32Bit<LA8Converter>(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                              output, outputRowPitch, outputDepthPitch);
+#else
+    UNIMPLEMENTED();
+#endif
 }
 
+void LoadRGB8ToBGRX8_SSE2(size_t width, size_t height, size_t depth,
+                          const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                          uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+#if defined(ANGLE_USE_SSE)
+    LoadTo32Bit<RGB8ToBGRX8Converter>(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                                      output, outputRowPitch, outputDepthPitch);
+#else
+    UNIMPLEMENTED();
+#endif
+}
+
+void LoadR5G6B5ToBGRA8_SSE2(size_t width, size_t height, size_t depth,
+                            const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                            uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+#if defined(ANGLE_USE_SSE)
+    LoadTo32Bit<R5G6B5Converter<true> >(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                                        output, outputRowPitch, outputDepthPitch);
+#else
+    UNIMPLEMENTED();
+#endif
+}
+
+void LoadR5G6B5ToRGBA8_SSE2(size_t width, size_t height, size_t depth,
+                            const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                            uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+#if defined(ANGLE_USE_SSE)
+    LoadTo32Bit<R5G6B5Converter<false> >(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                                         output, outputRowPitch, outputDepthPitch);
+#else
+    UNIMPLEMENTED();
+#endif
+}
+
+void LoadRGBA4ToBGRA8_SSE2(size_t width, size_t height, size_t depth,
+                           const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                           uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+#if defined(ANGLE_USE_SSE)
+    LoadTo32Bit<RGBA4Converter<true> >(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                                       output, outputRowPitch, outputDepthPitch);
+#else
+    UNIMPLEMENTED();
+#endif
+}
+
+void LoadRGBA4ToRGBA8_SSE2(size_t width, size_t height, size_t depth,
+                           const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                           uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+#if defined(ANGLE_USE_SSE)
+    LoadTo32Bit<RGBA4Converter<false> >(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                                        output, outputRowPitch, outputDepthPitch);
+#else
+    UNIMPLEMENTED();
+#endif
+}
+
+void LoadRGB5A1ToBGRA8_SSE2(size_t width, size_t height, size_t depth,
+                            const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                            uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+#if defined(ANGLE_USE_SSE)
+    LoadTo32Bit<RGB5A1Converter<true> >(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                                        output, outputRowPitch, outputDepthPitch);
+#else
+    UNIMPLEMENTED();
+#endif
+}
+
+void LoadRGB5A1ToRGBA8_SSE2(size_t width, size_t height, size_t depth,
+                            const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                            uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+#if defined(ANGLE_USE_SSE)
+    LoadTo32Bit<RGB5A1Converter<false> >(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                                         output, outputRowPitch, outputDepthPitch);
+#else
+    UNIMPLEMENTED();
+#endif
+}
+
+}
@@ -0,0 +1,96 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// primitiveindices.cpp: Defines the functions that write the indices drawing GL_LINE_LOOP as a
+// line strip and GL_TRIANGLE_FAN as a triangle list.
+
+#include "libANGLE/renderer/d3d/primitiveindices.h"
+
+#include "common/debug.h"
+#include "common/mathutil.h"
+#include "common/platform.h"
+
+namespace rx
+{
+
+namespace
+{
+
+// Reads the indices of a non-indexed draw
+struct SequentialIndices
+{
+    GLuint operator[](size_t i) const { return static_cast<GLuint>(i); }
+};
+
+template <typename IndexSource>
+void WriteLineLoop(const IndexSource &source, size_t first, size_t count, GLuint *output)
+{
+    for (size_t i = first; i < count; i++)
+    {
+        output[i] = source[i];
+    }
+    output[count] = source[0];
+}
+
+template <typename IndexSource>
+void WriteTriangleFan(const IndexSource &source, size_t firstTriangle, size_t triangleCount, GLuint *output)
+{
+    const GLuint fanCenter = source[0];
+    for (size_t i = firstTriangle; i < triangleCount; i++)
+    {
+        output[i * 3 + 0] = fanCenter;
+        output[i * 3 + 1] = source[i + 1];
+        output[i * 3 + 2] = source[i + 2];
+    }
+}
+
+}
+
+void GenerateLineLoopIndices(GLenum type, const void *indices, GLuint count, GLuint *output)
+{
+    size_t first = 0;
+
+#if defined(ANGLE_USE_SSE)
+    if (gl::supportsSSE2())
+    {
+        first = GenerateLineLoopIndices_SSE2(type, indices, count, output);
+    }
+#endif
+
+    switch (type)
+    {
+      case GL_NONE:           WriteLineLoop(SequentialIndices(), first, count, output);                 break;
+      case GL_UNSIGNED_BYTE:  WriteLineLoop(static_cast<const GLubyte*>(indices), first, count, output);  break;
+      case GL_UNSIGNED_SHORT: WriteLineLoop(static_cast<const GLushort*>(indices), first, count, output); break;
+      case GL_UNSIGNED_INT:   WriteLineLoop(static_cast<const GLuint*>(indices), first, count, output);   break;
+      default: UNREACHABLE();
+    }
+}
+
+void GenerateTriangleFanIndices(GLenum type, const void *indices, GLuint count, GLuint *output)
+{
+    ASSERT(count >= 3);
+    const size_t triangleCount = count - 2;
+    size_t first = 0;
+
+#if defined(ANGLE_USE_SSE)
+    if (gl::supportsSSE2())
+    {
+        first = GenerateTriangleFanIndices_SSE2(type, indices, triangleCount, output);
+    }
+#endif
+
+    switch (type)
+    {
+      case GL_NONE:           WriteTriangleFan(SequentialIndices(), first, triangleCount, output);                 break;
+      case GL_UNSIGNED_BYTE:  WriteTriangleFan(static_cast<const GLubyte*>(indices), first, triangleCount, output);  break;
+      case GL_UNSIGNED_SHORT: WriteTriangleFan(static_cast<const GLushort*>(indices), first, triangleCount, output); break;
+      case GL_UNSIGNED_INT:   WriteTriangleFan(static_cast<const GLuint*>(indices), first, triangleCount, output);   break;
+      default: UNREACHABLE();
+    }
+}
+
+}
@@ -0,0 +1,37 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// primitiveindices.h: Defines the functions that write the indices drawing GL_LINE_LOOP as a line
+// strip and GL_TRIANGLE_FAN as a triangle list, for renderers that lack these primitive types.
+
+#ifndef LIBANGLE_RENDERER_D3D_PRIMITIVEINDICES_H_
+#define LIBANGLE_RENDERER_D3D_PRIMITIVEINDICES_H_
+
+#include "angle_gl.h"
+
+#include <cstddef>
+
+namespace rx
+{
+
+// In all of these functions, type is the GL type of the source indices, or GL_NONE for a
+// non-indexed draw whose vertices are numbered from zero. Output indices are 32-bit.
+
+// Writes the count vertices of a line loop, followed by its first vertex which closes the loop.
+void GenerateLineLoopIndices(GLenum type, const void *indices, GLuint count, GLuint *output);
+
+// Writes the count - 2 triangles of a triangle fan, three indices each. count must be at least 3.
+void GenerateTriangleFanIndices(GLenum type, const void *indices, GLuint count, GLuint *output);
+
+// Write as many groups of line loop vertices or of four fan triangles as count allows, without the
+// closing vertex of the loop. They return the number of vertices or triangles written; the caller
+// finishes the rest.
+size_t GenerateLineLoopIndices_SSE2(GLenum type, const void *indices, size_t count, GLuint *output);
+size_t GenerateTriangleFanIndices_SSE2(GLenum type, const void *indices, size_t triangleCount, GLuint *output);
+
+}
+
+#endif // LIBANGLE_RENDERER_D3D_PRIMITIVEINDICES_H_
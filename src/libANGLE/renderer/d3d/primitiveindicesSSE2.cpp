@@ -0,0 +1,177 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// primitiveindicesSSE2.cpp: Defines the SSE2 loops used by GenerateLineLoopIndices and
+// GenerateTriangleFanIndices. It's in a separated file for GCC, which can enable SSE usage only
+// per-file, not for code blocks that use SSE2 explicitly.
+
+#include "libANGLE/renderer/d3d/primitiveindices.h"
+
+#include "common/debug.h"
+#include "common/platform.h"
+
+#include <string.h>
+
+#ifdef ANGLE_USE_SSE
+#include <emmintrin.h>
+#endif
+
+namespace rx
+{
+
+#if defined(ANGLE_USE_SSE)
+namespace
+{
+
+// Each reader loads four consecutive indices, starting at index i, widened to 32 bits. Unused bytes
+// past the fourth index are never read, so that a load never crosses the end of the indices.
+struct SequentialReader
+{
+    explicit SequentialReader(const void *) {}
+    __m128i load(size_t i) const
+    {
+        GLuint first = static_cast<GLuint>(i);
+        return _mm_setr_epi32(first, first + 1, first + 2, first + 3);
+    }
+    GLuint get(size_t i) const { return static_cast<GLuint>(i); }
+};
+
+struct ByteReader
+{
+    explicit ByteReader(const void *indices) : mIndices(static_cast<const GLubyte*>(indices)) {}
+    __m128i load(size_t i) const
+    {
+        int bytes;
+        memcpy(&bytes, mIndices + i, sizeof(bytes));
+        const __m128i zero = _mm_setzero_si128();
+        return _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(bytes), zero), zero);
+    }
+    GLuint get(size_t i) const { return mIndices[i]; }
+
+    const GLubyte *mIndices;
+};
+
+struct ShortReader
+{
+    explicit ShortReader(const void *indices) : mIndices(static_cast<const GLushort*>(indices)) {}
+    __m128i load(size_t i) const
+    {
+        __m128i shorts = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(mIndices + i));
+        return _mm_unpacklo_epi16(shorts, _mm_setzero_si128());
+    }
+    GLuint get(size_t i) const { return mIndices[i]; }
+
+    const GLushort *mIndices;
+};
+
+struct IntReader
+{
+    explicit IntReader(const void *indices) : mIndices(static_cast<const GLuint*>(indices)) {}
+    __m128i load(size_t i) const
+    {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(mIndices + i));
+    }
+    GLuint get(size_t i) const { return mIndices[i]; }
+
+    const GLuint *mIndices;
+};
+
+template <typename Reader>
+size_t WriteLineLoop(const void *indices, size_t count, GLuint *output)
+{
+    const Reader reader(indices);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), reader.load(i));
+    }
+
+    return i;
+}
+
+// Selects the lanes of a that are set in mask, and the other lanes of b.
+inline __m128i Select(const __m128i &mask, const __m128i &a, const __m128i &b)
+{
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+template <typename Reader>
+size_t WriteTriangleFan(const void *indices, size_t triangleCount, GLuint *output)
+{
+    const Reader reader(indices);
+    const __m128i fanCenter = _mm_set1_epi32(reader.get(0));
+
+    const __m128i mask0 = _mm_setr_epi32(0, -1, -1, 0);
+    const __m128i mask1 = _mm_setr_epi32(-1, -1, 0, -1);
+    const __m128i mask2 = _mm_setr_epi32(-1, 0, -1, -1);
+
+    // Triangles i to i + 3 are (c, a0, b0), (c, a1, b1), (c, a2, b2), (c, a3, b3), where a holds
+    // indices i + 1 to i + 4 and b holds indices i + 2 to i + 5.
+    size_t i = 0;
+    for (; i + 4 <= triangleCount; i += 4)
+    {
+        __m128i a = reader.load(i + 1);
+        __m128i b = reader.load(i + 2);
+
+        __m128i low = _mm_unpacklo_epi32(a, b);  // a0 b0 a1 b1
+        __m128i high = _mm_unpackhi_epi32(a, b); // a2 b2 a3 b3
+        __m128i middle = _mm_unpacklo_epi64(_mm_srli_si128(low, 8), high); // a1 b1 a2 b2
+
+        // c a0 b0 c
+        __m128i out0 = Select(mask0, _mm_slli_si128(low, 4), fanCenter);
+        // a1 b1 c a2
+        __m128i out1 = Select(mask1, _mm_shuffle_epi32(middle, _MM_SHUFFLE(2, 2, 1, 0)), fanCenter);
+        // b2 c a3 b3
+        __m128i out2 = Select(mask2, _mm_shuffle_epi32(high, _MM_SHUFFLE(3, 2, 1, 1)), fanCenter);
+
+        __m128i *dest = reinterpret_cast<__m128i*>(output + i * 3);
+        _mm_storeu_si128(dest + 0, out0);
+        _mm_storeu_si128(dest + 1, out1);
+        _mm_storeu_si128(dest + 2, out2);
+    }
+
+    return i;
+}
+
+}
+#endif // ANGLE_USE_SSE
+
+size_t GenerateLineLoopIndices_SSE2(GLenum type, const void *indices, size_t count, GLuint *output)
+{
+#if defined(ANGLE_USE_SSE)
+    switch (type)
+    {
+      case GL_NONE:           return WriteLineLoop<SequentialReader>(indices, count, output);
+      case GL_UNSIGNED_BYTE:  return WriteLineLoop<ByteReader>(indices, count, output);
+      case GL_UNSIGNED_SHORT: return WriteLineLoop<ShortReader>(indices, count, output);
+      case GL_UNSIGNED_INT:   return WriteLineLoop<IntReader>(indices, count, output);
+      default: UNREACHABLE(); return 0;
+    }
+#else
+    UNIMPLEMENTED();
+    return 0;
+#endif
+}
+
+size_t GenerateTriangleFanIndices_SSE2(GLenum type, const void *indices, size_t triangleCount, GLuint *output)
+{
+#if defined(ANGLE_USE_SSE)
+    switch (type)
+    {
+      case GL_NONE:           return WriteTriangleFan<SequentialReader>(indices, triangleCount, output);
+      case GL_UNSIGNED_BYTE:  return WriteTriangleFan<ByteReader>(indices, triangleCount, output);
+      case GL_UNSIGNED_SHORT: return WriteTriangleFan<ShortReader>(indices, triangleCount, output);
+      case GL_UNSIGNED_INT:   return WriteTriangleFan<IntReader>(indices, triangleCount, output);
+      default: UNREACHABLE(); return 0;
+    }
+#else
+    UNIMPLEMENTED();
+    return 0;
+#endif
+}
+
+}
@@ -150,6 +150,17 @@ Error ValidateCreateContext(Display *display, Config *configuration, gl::Context
             }
             break;
 
+          case EGL_CONTEXT_DRAW_COALESCING_ANGLE:
+            if (!display->getExtensions().createContextDrawCoalescing)
+            {
+                return Error(EGL_BAD_ATTRIBUTE);
+            }
+            if (value != EGL_TRUE && value != EGL_FALSE)
+            {
+                return Error(EGL_BAD_ATTRIBUTE);
+            }
+            break;
+
           default:
             return Error(EGL_BAD_ATTRIBUTE);
         }
@@ -1322,7 +1322,7 @@ bool ValidateCopyTexImageParametersBase(gl::Context* context, GLenum target, GLi
     return true;
 }
 
-static bool ValidateDrawBase(Context *context, GLenum mode, GLsizei count, GLsizei maxVertex, GLsizei primcount)
+static bool ValidateDrawMode(Context *context, GLenum mode)
 {
     switch (mode)
     {
@@ -1339,12 +1339,12 @@ static bool ValidateDrawBase(Context *context, GLenum mode, GLsizei count, GLsiz
         return false;
     }
 
-    if (count < 0)
-    {
-        context->recordError(Error(GL_INVALID_VALUE));
-        return false;
-    }
+    return true;
+}
 
+// Validates the state a draw depends on, whatever its vertices
+static bool ValidateDrawState(Context *context)
+{
     const State &state = context->getState();
 
     // Check for mapped buffers
@@ -1387,6 +1387,15 @@ static bool ValidateDrawBase(Context *context, GLenum mode, GLsizei count, GLsiz
         return false;
     }
 
+    return true;
+}
+
+// Validates that the enabled attribute buffers hold maxVertex vertices and primcount instances
+static bool ValidateDrawAttributes(Context *context, GLsizei maxVertex, GLsizei primcount)
+{
+    const State &state = context->getState();
+    gl::Program *program = state.getProgram();
+
     // Buffer validations
     const VertexArray *vao = state.getVertexArray();
     for (int attributeIndex = 0; attributeIndex < MAX_VERTEX_ATTRIBS; attributeIndex++)
@@ -1432,18 +1441,33 @@ static bool ValidateDrawBase(Context *context, GLenum mode, GLsizei count, GLsiz
         }
     }
 
-    // No-op if zero count
-    return (count > 0);
+    return true;
 }
 
-bool ValidateDrawArrays(Context *context, GLenum mode, GLint first, GLsizei count, GLsizei primcount)
+static bool ValidateDrawBase(Context *context, GLenum mode, GLsizei count, GLsizei maxVertex, GLsizei primcount)
 {
-    if (first < 0)
+    if (!ValidateDrawMode(context, mode))
+    {
+        return false;
+    }
+
+    if (count < 0)
     {
         context->recordError(Error(GL_INVALID_VALUE));
         return false;
     }
 
+    if (!ValidateDrawState(context) || !ValidateDrawAttributes(context, maxVertex, primcount))
+    {
+        return false;
+    }
+
+    // No-op if zero count
+    return (count > 0);
+}
+
+static bool ValidateDrawArraysTransformFeedback(Context *context, GLenum mode)
+{
     const State &state = context->getState();
     gl::TransformFeedback *curTransformFeedback = state.getCurrentTransformFeedback();
     if (curTransformFeedback && curTransformFeedback->isStarted() && !curTransformFeedback->isPaused() &&
@@ -1456,6 +1480,22 @@ bool ValidateDrawArrays(Context *context, GLenum mode, GLint first, GLsizei coun
         return false;
     }
 
+    return true;
+}
+
+bool ValidateDrawArrays(Context *context, GLenum mode, GLint first, GLsizei count, GLsizei primcount)
+{
+    if (first < 0)
+    {
+        context->recordError(Error(GL_INVALID_VALUE));
+        return false;
+    }
+
+    if (!ValidateDrawArraysTransformFeedback(context, mode))
+    {
+        return false;
+    }
+
     if (!ValidateDrawBase(context, mode, count, count, primcount))
     {
         return false;
@@ -1514,8 +1554,7 @@ bool ValidateDrawArraysInstancedANGLE(Context *context, GLenum mode, GLint first
     return ValidateDrawArraysInstanced(context, mode, first, count, primcount);
 }
 
-bool ValidateDrawElements(Context *context, GLenum mode, GLsizei count, GLenum type,
-                          const GLvoid* indices, GLsizei primcount, rx::RangeUI *indexRangeOut)
+static bool ValidateDrawElementsState(Context *context, GLenum type)
 {
     switch (type)
     {
@@ -1552,6 +1591,34 @@ bool ValidateDrawElements(Context *context, GLenum mode, GLsizei count, GLenum t
         return false;
     }
 
+    return true;
+}
+
+// Whether the bounds checks of the vertex attributes need the largest index of the draw: they do
+// for every active attribute read from a buffer once per vertex.
+static bool AttributeBoundsDependOnIndices(const State &state)
+{
+    gl::Program *program = state.getProgram();
+    const VertexArray *vao = state.getVertexArray();
+    for (int attributeIndex = 0; attributeIndex < MAX_VERTEX_ATTRIBS; attributeIndex++)
+    {
+        const VertexAttribute &attrib = vao->getVertexAttribute(attributeIndex);
+        if (attrib.enabled && attrib.divisor == 0 && attrib.buffer.get() != NULL &&
+            program->getSemanticIndex(attributeIndex) != -1)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Validates that count indices can be read from indices, and finds their range unless it can be left
+// to the backend
+static bool ValidateDrawElementsIndices(Context *context, GLsizei count, GLenum type, const GLvoid *indices,
+                                        rx::DrawIndexRange *indexRangeOut)
+{
+    const State &state = context->getState();
     const gl::VertexArray *vao = state.getVertexArray();
     const gl::Buffer *elementArrayBuffer = vao->getElementArrayBuffer();
     if (!indices && !elementArrayBuffer)
@@ -1592,10 +1659,13 @@ bool ValidateDrawElements(Context *context, GLenum mode, GLsizei count, GLenum t
     // Use max index to validate if our vertex buffers are large enough for the pull.
     // TODO: offer fast path, with disabled index validation.
     // TODO: also disable index checking on back-ends that are robust to out-of-range accesses.
+    bool primitiveRestartEnabled = state.isPrimitiveRestartEnabled();
     if (elementArrayBuffer)
     {
         uintptr_t offset = reinterpret_cast<uintptr_t>(indices);
-        if (!elementArrayBuffer->getIndexRangeCache()->findRange(type, offset, count, indexRangeOut, NULL))
+        rx::RangeUI range;
+        if (!elementArrayBuffer->getIndexRangeCache()->findRange(type, offset, count, primitiveRestartEnabled,
+                                                                 &range, NULL))
         {
             rx::BufferImpl *bufferImpl = elementArrayBuffer->getImplementation();
             const uint8_t *dataPointer = NULL;
@@ -1606,16 +1676,44 @@ bool ValidateDrawElements(Context *context, GLenum mode, GLsizei count, GLenum t
                 return false;
             }
 
-            const uint8_t *offsetPointer = dataPointer + offset;
-            *indexRangeOut = rx::IndexRangeCache::ComputeRange(type, offsetPointer, count);
+            range = elementArrayBuffer->getIndexRangeCache()->computeBufferRange(
+                type, dataPointer, static_cast<size_t>(elementArrayBuffer->getSize()), offset, count,
+                primitiveRestartEnabled);
         }
+        *indexRangeOut = rx::DrawIndexRange(range);
+    }
+    else if (primitiveRestartEnabled || AttributeBoundsDependOnIndices(state))
+    {
+        *indexRangeOut = rx::DrawIndexRange(rx::IndexRangeCache::ComputeRange(type, indices, count,
+                                                                            primitiveRestartEnabled));
     }
     else
     {
-        *indexRangeOut = rx::IndexRangeCache::ComputeRange(type, indices, count);
+        // Client memory indices are converted for every draw, and the backend finds their range in
+        // the same pass (see IndexDataManager). Nothing here needs it sooner.
+        *indexRangeOut = rx::DrawIndexRange();
+    }
+
+    return true;
+}
+
+// The largest vertex the attribute bounds checks must allow for. An unresolved range is only left
+// when no attribute is checked against it.
+static GLsizei GetMaxVertex(const rx::DrawIndexRange &indexRange)
+{
+    return indexRange.resolved ? static_cast<GLsizei>(indexRange.range.end) : 0;
+}
+
+bool ValidateDrawElements(Context *context, GLenum mode, GLsizei count, GLenum type,
+                          const GLvoid* indices, GLsizei primcount, rx::DrawIndexRange *indexRangeOut)
+{
+    if (!ValidateDrawElementsState(context, type) ||
+        !ValidateDrawElementsIndices(context, count, type, indices, indexRangeOut))
+    {
+        return false;
     }
 
-    if (!ValidateDrawBase(context, mode, count, static_cast<GLsizei>(indexRangeOut->end), primcount))
+    if (!ValidateDrawBase(context, mode, count, GetMaxVertex(*indexRangeOut), primcount))
     {
         return false;
     }
@@ -1626,7 +1724,7 @@ bool ValidateDrawElements(Context *context, GLenum mode, GLsizei count, GLenum t
 bool ValidateDrawElementsInstanced(Context *context,
                                    GLenum mode, GLsizei count, GLenum type,
                                    const GLvoid *indices, GLsizei primcount,
-                                   rx::RangeUI *indexRangeOut)
+                                   rx::DrawIndexRange *indexRangeOut)
 {
     if (primcount < 0)
     {
@@ -1644,7 +1742,7 @@ bool ValidateDrawElementsInstanced(Context *context,
 }
 
 bool ValidateDrawElementsInstancedANGLE(Context *context, GLenum mode, GLsizei count, GLenum type,
-                                        const GLvoid *indices, GLsizei primcount, rx::RangeUI *indexRangeOut)
+                                        const GLvoid *indices, GLsizei primcount, rx::DrawIndexRange *indexRangeOut)
 {
     if (!ValidateDrawInstancedANGLE(context))
     {
@@ -1654,6 +1752,190 @@ bool ValidateDrawElementsInstancedANGLE(Context *context, GLenum mode, GLsizei c
     return ValidateDrawElementsInstanced(context, mode, count, type, indices, primcount, indexRangeOut);
 }
 
+// The draws of a batch are validated as one command: the state they share is validated once, the
+// vertex attributes once for the largest of them, and an error in any draw leaves all undrawn.
+// |drawArray| is the array of firsts or of index offsets, which must be given like the counts
+static bool ValidateMultiDrawBase(Context *context, GLenum mode, const GLsizei *counts, const void *drawArray,
+                                  const GLsizei *instanceCounts, GLsizei drawCount)
+{
+    if (drawCount < 0)
+    {
+        context->recordError(Error(GL_INVALID_VALUE));
+        return false;
+    }
+
+    if (drawCount > 0 && (counts == NULL || drawArray == NULL))
+    {
+        context->recordError(Error(GL_INVALID_VALUE, "The draw arrays must not be NULL."));
+        return false;
+    }
+
+    if (!ValidateDrawMode(context, mode))
+    {
+        return false;
+    }
+
+    for (GLsizei drawIndex = 0; drawIndex < drawCount; drawIndex++)
+    {
+        if (counts[drawIndex] < 0 || (instanceCounts && instanceCounts[drawIndex] < 0))
+        {
+            context->recordError(Error(GL_INVALID_VALUE));
+            return false;
+        }
+    }
+
+    return ValidateDrawState(context);
+}
+
+static bool ValidateMultiDrawArraysBase(Context *context, GLenum mode, const GLint *firsts, const GLsizei *counts,
+                                        const GLsizei *instanceCounts, GLsizei drawCount)
+{
+    if (!ValidateMultiDrawBase(context, mode, counts, firsts, instanceCounts, drawCount))
+    {
+        return false;
+    }
+
+    if (!ValidateDrawArraysTransformFeedback(context, mode))
+    {
+        return false;
+    }
+
+    GLsizei maxVertex = 0;
+    GLsizei maxInstances = 0;
+    for (GLsizei drawIndex = 0; drawIndex < drawCount; drawIndex++)
+    {
+        if (firsts[drawIndex] < 0)
+        {
+            context->recordError(Error(GL_INVALID_VALUE));
+            return false;
+        }
+
+        maxVertex = std::max(maxVertex, counts[drawIndex]);
+        maxInstances = (instanceCounts ? std::max(maxInstances, instanceCounts[drawIndex]) : 0);
+    }
+
+    if (!ValidateDrawAttributes(context, maxVertex, maxInstances))
+    {
+        return false;
+    }
+
+    // No-op if no draws
+    return (drawCount > 0);
+}
+
+bool ValidateMultiDrawArraysEXT(Context *context, GLenum mode, const GLint *firsts, const GLsizei *counts,
+                                GLsizei drawCount)
+{
+    if (!context->getExtensions().multiDrawArrays)
+    {
+        context->recordError(Error(GL_INVALID_OPERATION));
+        return false;
+    }
+
+    return ValidateMultiDrawArraysBase(context, mode, firsts, counts, NULL, drawCount);
+}
+
+bool ValidateMultiDrawArraysInstancedANGLE(Context *context, GLenum mode, const GLint *firsts, const GLsizei *counts,
+                                           const GLsizei *instanceCounts, GLsizei drawCount)
+{
+    if (!context->getExtensions().multiDraw)
+    {
+        context->recordError(Error(GL_INVALID_OPERATION));
+        return false;
+    }
+
+    // A NULL instance count array would otherwise read as a non-instanced batch
+    if (drawCount > 0 && instanceCounts == NULL)
+    {
+        context->recordError(Error(GL_INVALID_VALUE, "The draw arrays must not be NULL."));
+        return false;
+    }
+
+    if (!ValidateMultiDrawArraysBase(context, mode, firsts, counts, instanceCounts, drawCount))
+    {
+        return false;
+    }
+
+    return ValidateDrawInstancedANGLE(context);
+}
+
+static bool ValidateMultiDrawElementsBase(Context *context, GLenum mode, const GLsizei *counts, GLenum type,
+                                          const GLvoid *const *indices, const GLsizei *instanceCounts,
+                                          GLsizei drawCount, std::vector<rx::DrawIndexRange> *indexRangesOut)
+{
+    if (!ValidateMultiDrawBase(context, mode, counts, indices, instanceCounts, drawCount))
+    {
+        return false;
+    }
+
+    if (!ValidateDrawElementsState(context, type))
+    {
+        return false;
+    }
+
+    indexRangesOut->resize(drawCount);
+
+    GLsizei maxVertex = 0;
+    GLsizei maxInstances = 0;
+    for (GLsizei drawIndex = 0; drawIndex < drawCount; drawIndex++)
+    {
+        rx::DrawIndexRange *indexRange = &(*indexRangesOut)[drawIndex];
+        if (!ValidateDrawElementsIndices(context, counts[drawIndex], type, indices[drawIndex], indexRange))
+        {
+            return false;
+        }
+
+        maxVertex = std::max(maxVertex, GetMaxVertex(*indexRange));
+        maxInstances = (instanceCounts ? std::max(maxInstances, instanceCounts[drawIndex]) : 0);
+    }
+
+    if (!ValidateDrawAttributes(context, maxVertex, maxInstances))
+    {
+        return false;
+    }
+
+    // No-op if no draws
+    return (drawCount > 0);
+}
+
+bool ValidateMultiDrawElementsEXT(Context *context, GLenum mode, const GLsizei *counts, GLenum type,
+                                  const GLvoid *const *indices, GLsizei drawCount,
+                                  std::vector<rx::DrawIndexRange> *indexRangesOut)
+{
+    if (!context->getExtensions().multiDrawArrays)
+    {
+        context->recordError(Error(GL_INVALID_OPERATION));
+        return false;
+    }
+
+    return ValidateMultiDrawElementsBase(context, mode, counts, type, indices, NULL, drawCount, indexRangesOut);
+}
+
+bool ValidateMultiDrawElementsInstancedANGLE(Context *context, GLenum mode, const GLsizei *counts, GLenum type,
+                                             const GLvoid *const *indices, const GLsizei *instanceCounts,
+                                             GLsizei drawCount, std::vector<rx::DrawIndexRange> *indexRangesOut)
+{
+    if (!context->getExtensions().multiDraw)
+    {
+        context->recordError(Error(GL_INVALID_OPERATION));
+        return false;
+    }
+
+    if (drawCount > 0 && instanceCounts == NULL)
+    {
+        context->recordError(Error(GL_INVALID_VALUE, "The draw arrays must not be NULL."));
+        return false;
+    }
+
+    if (!ValidateMultiDrawElementsBase(context, mode, counts, type, indices, instanceCounts, drawCount,
+                                       indexRangesOut))
+    {
+        return false;
+    }
+
+    return ValidateDrawInstancedANGLE(context);
+}
+
 bool ValidateFramebufferTextureBase(Context *context, GLenum target, GLenum attachment,
                                     GLuint texture, GLint level)
 {
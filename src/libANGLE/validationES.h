@@ -14,6 +14,8 @@
 #include <GLES2/gl2.h>
 #include <GLES3/gl3.h>
 
+#include <vector>
+
 namespace gl
 {
 
@@ -71,12 +73,23 @@ bool ValidateDrawArraysInstanced(Context *context, GLenum mode, GLint first, GLs
 bool ValidateDrawArraysInstancedANGLE(Context *context, GLenum mode, GLint first, GLsizei count, GLsizei primcount);
 
 bool ValidateDrawElements(Context *context, GLenum mode, GLsizei count, GLenum type,
-                          const GLvoid* indices, GLsizei primcount, rx::RangeUI *indexRangeOut);
+                          const GLvoid* indices, GLsizei primcount, rx::DrawIndexRange *indexRangeOut);
 
 bool ValidateDrawElementsInstanced(Context *context, GLenum mode, GLsizei count, GLenum type,
-                                   const GLvoid *indices, GLsizei primcount, rx::RangeUI *indexRangeOut);
+                                   const GLvoid *indices, GLsizei primcount, rx::DrawIndexRange *indexRangeOut);
 bool ValidateDrawElementsInstancedANGLE(Context *context, GLenum mode, GLsizei count, GLenum type,
-                                        const GLvoid *indices, GLsizei primcount, rx::RangeUI *indexRangeOut);
+                                        const GLvoid *indices, GLsizei primcount, rx::DrawIndexRange *indexRangeOut);
+
+bool ValidateMultiDrawArraysEXT(Context *context, GLenum mode, const GLint *firsts, const GLsizei *counts,
+                                GLsizei drawCount);
+bool ValidateMultiDrawArraysInstancedANGLE(Context *context, GLenum mode, const GLint *firsts, const GLsizei *counts,
+                                           const GLsizei *instanceCounts, GLsizei drawCount);
+bool ValidateMultiDrawElementsEXT(Context *context, GLenum mode, const GLsizei *counts, GLenum type,
+                                  const GLvoid *const *indices, GLsizei drawCount,
+                                  std::vector<rx::DrawIndexRange> *indexRangesOut);
+bool ValidateMultiDrawElementsInstancedANGLE(Context *context, GLenum mode, const GLsizei *counts, GLenum type,
+                                             const GLvoid *const *indices, const GLsizei *instanceCounts,
+                                             GLsizei drawCount, std::vector<rx::DrawIndexRange> *indexRangesOut);
 
 bool ValidateFramebufferTextureBase(Context *context, GLenum target, GLenum attachment,
                                     GLuint texture, GLint level);
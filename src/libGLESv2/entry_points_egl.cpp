@@ -26,6 +26,17 @@
 namespace egl
 {
 
+// Draws held back by the current context must be drawn before its surface is presented or read
+// through a texture, and before it stops being current
+static void FlushCurrentContextDraws()
+{
+    gl::Context *context = GetGlobalContext();
+    if (context != nullptr)
+    {
+        context->flushDeferredDraws();
+    }
+}
+
 // EGL 1.0
 EGLint EGLAPIENTRY GetError(void)
 {
@@ -85,6 +96,7 @@ EGLBoolean EGLAPIENTRY Terminate(EGLDisplay dpy)
 
     if (display->isValidContext(context))
     {
+        FlushCurrentContextDraws();
         SetGlobalContext(NULL);
         SetGlobalDisplay(NULL);
     }
@@ -486,6 +498,7 @@ EGLBoolean EGLAPIENTRY DestroyContext(EGLDisplay dpy, EGLContext ctx)
 
     if (context == GetGlobalContext())
     {
+        FlushCurrentContextDraws();
         SetGlobalDisplay(NULL);
         SetGlobalContext(NULL);
     }
@@ -564,6 +577,8 @@ EGLBoolean EGLAPIENTRY MakeCurrent(EGLDisplay dpy, EGLSurface draw, EGLSurface r
         UNIMPLEMENTED();   // FIXME
     }
 
+    FlushCurrentContextDraws();
+
     SetGlobalDisplay(display);
     SetGlobalDrawSurface(drawSurface);
     SetGlobalReadSurface(readSurface);
@@ -693,6 +708,8 @@ EGLBoolean EGLAPIENTRY SwapBuffers(EGLDisplay dpy, EGLSurface surface)
         return EGL_FALSE;
     }
 
+    FlushCurrentContextDraws();
+
     error = eglSurface->swap();
     if (error.isError())
     {
@@ -772,6 +789,8 @@ EGLBoolean EGLAPIENTRY BindTexImage(EGLDisplay dpy, EGLSurface surface, EGLint b
     gl::Context *context = GetGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         gl::Texture *textureObject = context->getTargetTexture(GL_TEXTURE_2D);
         ASSERT(textureObject != NULL);
 
@@ -845,6 +864,7 @@ EGLBoolean EGLAPIENTRY ReleaseTexImage(EGLDisplay dpy, EGLSurface surface, EGLin
 
     if (texture)
     {
+        FlushCurrentContextDraws();
         eglSurface->releaseTexImage(buffer);
     }
 
@@ -1100,6 +1120,10 @@ __eglMustCastToProperFunctionPointerType EGLAPIENTRY GetProcAddress(const char *
         { "glVertexAttribDivisorANGLE", (__eglMustCastToProperFunctionPointerType)gl::VertexAttribDivisorANGLE },
         { "glDrawArraysInstancedANGLE", (__eglMustCastToProperFunctionPointerType)gl::DrawArraysInstancedANGLE },
         { "glDrawElementsInstancedANGLE", (__eglMustCastToProperFunctionPointerType)gl::DrawElementsInstancedANGLE },
+        { "glMultiDrawArraysEXT", (__eglMustCastToProperFunctionPointerType)gl::MultiDrawArraysEXT },
+        { "glMultiDrawElementsEXT", (__eglMustCastToProperFunctionPointerType)gl::MultiDrawElementsEXT },
+        { "glMultiDrawArraysInstancedANGLE", (__eglMustCastToProperFunctionPointerType)gl::MultiDrawArraysInstancedANGLE },
+        { "glMultiDrawElementsInstancedANGLE", (__eglMustCastToProperFunctionPointerType)gl::MultiDrawElementsInstancedANGLE },
         { "glGetProgramBinaryOES", (__eglMustCastToProperFunctionPointerType)gl::GetProgramBinaryOES },
         { "glProgramBinaryOES", (__eglMustCastToProperFunctionPointerType)gl::ProgramBinaryOES },
         { "glGetBufferPointervOES", (__eglMustCastToProperFunctionPointerType)gl::GetBufferPointervOES },
@@ -144,6 +144,8 @@ void GL_APIENTRY BindBuffer(GLenum target, GLuint buffer)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (!ValidBufferTarget(context, target))
         {
             context->recordError(Error(GL_INVALID_ENUM));
@@ -191,6 +193,8 @@ void GL_APIENTRY BindFramebuffer(GLenum target, GLuint framebuffer)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (!ValidFramebufferTarget(target))
         {
             context->recordError(Error(GL_INVALID_ENUM));
@@ -216,6 +220,8 @@ void GL_APIENTRY BindRenderbuffer(GLenum target, GLuint renderbuffer)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (target != GL_RENDERBUFFER)
         {
             context->recordError(Error(GL_INVALID_ENUM));
@@ -233,6 +239,8 @@ void GL_APIENTRY BindTexture(GLenum target, GLuint texture)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         Texture *textureObject = context->getTexture(texture);
 
         if (textureObject && textureObject->getTarget() != target && texture != 0)
@@ -273,6 +281,8 @@ void GL_APIENTRY BlendColor(GLclampf red, GLclampf green, GLclampf blue, GLclamp
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         context->getState().setBlendColor(clamp01(red), clamp01(green), clamp01(blue), clamp01(alpha));
     }
 }
@@ -289,6 +299,8 @@ void GL_APIENTRY BlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         switch (modeRGB)
         {
           case GL_FUNC_ADD:
@@ -334,6 +346,8 @@ void GL_APIENTRY BlendFuncSeparate(GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         switch (srcRGB)
         {
           case GL_ZERO:
@@ -469,6 +483,8 @@ void GL_APIENTRY BufferData(GLenum target, GLsizeiptr size, const GLvoid* data,
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (size < 0)
         {
             context->recordError(Error(GL_INVALID_VALUE));
@@ -531,6 +547,8 @@ void GL_APIENTRY BufferSubData(GLenum target, GLintptr offset, GLsizeiptr size,
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (size < 0 || offset < 0)
         {
             context->recordError(Error(GL_INVALID_VALUE));
@@ -613,6 +631,8 @@ void GL_APIENTRY Clear(GLbitfield mask)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         Framebuffer *framebufferObject = context->getState().getDrawFramebuffer();
         ASSERT(framebufferObject);
 
@@ -645,6 +665,8 @@ void GL_APIENTRY ClearColor(GLclampf red, GLclampf green, GLclampf blue, GLclamp
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         context->getState().setClearColor(red, green, blue, alpha);
     }
 }
@@ -656,6 +678,8 @@ void GL_APIENTRY ClearDepthf(GLclampf depth)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         context->getState().setClearDepth(depth);
     }
 }
@@ -667,6 +691,8 @@ void GL_APIENTRY ClearStencil(GLint s)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         context->getState().setClearStencil(s);
     }
 }
@@ -679,6 +705,8 @@ void GL_APIENTRY ColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboo
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         context->getState().setColorMask(red == GL_TRUE, green == GL_TRUE, blue == GL_TRUE, alpha == GL_TRUE);
     }
 }
@@ -720,6 +748,8 @@ void GL_APIENTRY CompressedTexImage2D(GLenum target, GLint level, GLenum interna
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3 &&
             !ValidateES2TexImageParameters(context, target, level, internalformat, true, false,
                                            0, 0, width, height, border, GL_NONE, GL_NONE, data))
@@ -764,6 +794,8 @@ void GL_APIENTRY CompressedTexSubImage2D(GLenum target, GLint level, GLint xoffs
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3 &&
             !ValidateES2TexImageParameters(context, target, level, GL_NONE, true, true,
                                            xoffset, yoffset, width, height, 0, GL_NONE, GL_NONE, data))
@@ -807,6 +839,8 @@ void GL_APIENTRY CopyTexImage2D(GLenum target, GLint level, GLenum internalforma
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3 &&
             !ValidateES2CopyTexImageParameters(context, target, level, internalformat, false,
                                                0, 0, x, y, width, height, border))
@@ -843,6 +877,8 @@ void GL_APIENTRY CopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GL
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3 &&
             !ValidateES2CopyTexImageParameters(context, target, level, GL_NONE, true,
                                                xoffset, yoffset, x, y, width, height, 0))
@@ -913,6 +949,8 @@ void GL_APIENTRY CullFace(GLenum mode)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         switch (mode)
         {
           case GL_FRONT:
@@ -936,6 +974,8 @@ void GL_APIENTRY DeleteBuffers(GLsizei n, const GLuint* buffers)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (n < 0)
         {
             context->recordError(Error(GL_INVALID_VALUE));
@@ -956,6 +996,8 @@ void GL_APIENTRY DeleteFramebuffers(GLsizei n, const GLuint* framebuffers)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (n < 0)
         {
             context->recordError(Error(GL_INVALID_VALUE));
@@ -979,6 +1021,8 @@ void GL_APIENTRY DeleteProgram(GLuint program)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (program == 0)
         {
             return;
@@ -1009,6 +1053,8 @@ void GL_APIENTRY DeleteRenderbuffers(GLsizei n, const GLuint* renderbuffers)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (n < 0)
         {
             context->recordError(Error(GL_INVALID_VALUE));
@@ -1059,6 +1105,8 @@ void GL_APIENTRY DeleteTextures(GLsizei n, const GLuint* textures)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (n < 0)
         {
             context->recordError(Error(GL_INVALID_VALUE));
@@ -1082,6 +1130,8 @@ void GL_APIENTRY DepthFunc(GLenum func)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         switch (func)
         {
           case GL_NEVER:
@@ -1109,6 +1159,8 @@ void GL_APIENTRY DepthMask(GLboolean flag)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         context->getState().setDepthMask(flag != GL_FALSE);
     }
 }
@@ -1120,6 +1172,8 @@ void GL_APIENTRY DepthRangef(GLclampf zNear, GLclampf zFar)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         context->getState().setDepthRange(zNear, zFar);
     }
 }
@@ -1180,6 +1234,8 @@ void GL_APIENTRY Disable(GLenum cap)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (!ValidCap(context, cap))
         {
             context->recordError(Error(GL_INVALID_ENUM));
@@ -1197,6 +1253,8 @@ void GL_APIENTRY DisableVertexAttribArray(GLuint index)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (index >= MAX_VERTEX_ATTRIBS)
         {
             context->recordError(Error(GL_INVALID_VALUE));
@@ -1236,7 +1294,7 @@ void GL_APIENTRY DrawElements(GLenum mode, GLsizei count, GLenum type, const GLv
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        rx::RangeUI indexRange;
+        rx::DrawIndexRange indexRange;
         if (!ValidateDrawElements(context, mode, count, type, indices, 0, &indexRange))
         {
             return;
@@ -1258,6 +1316,8 @@ void GL_APIENTRY Enable(GLenum cap)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (!ValidCap(context, cap))
         {
             context->recordError(Error(GL_INVALID_ENUM));
@@ -1275,6 +1335,8 @@ void GL_APIENTRY EnableVertexAttribArray(GLuint index)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (index >= MAX_VERTEX_ATTRIBS)
         {
             context->recordError(Error(GL_INVALID_VALUE));
@@ -1325,6 +1387,8 @@ void GL_APIENTRY FramebufferRenderbuffer(GLenum target, GLenum attachment, GLenu
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (!ValidFramebufferTarget(target) || (renderbuffertarget != GL_RENDERBUFFER && renderbuffer != 0))
         {
             context->recordError(Error(GL_INVALID_ENUM));
@@ -1359,6 +1423,8 @@ void GL_APIENTRY FramebufferTexture2D(GLenum target, GLenum attachment, GLenum t
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (!ValidateFramebufferTexture2D(context, target, attachment, textarget, texture, level))
         {
             return;
@@ -1399,6 +1465,8 @@ void GL_APIENTRY FrontFace(GLenum mode)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         switch (mode)
         {
           case GL_CW:
@@ -1439,6 +1507,8 @@ void GL_APIENTRY GenerateMipmap(GLenum target)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (!ValidTextureTarget(context, target))
         {
             context->recordError(Error(GL_INVALID_ENUM));
@@ -3079,6 +3149,8 @@ void GL_APIENTRY LineWidth(GLfloat width)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (width <= 0.0f)
         {
             context->recordError(Error(GL_INVALID_VALUE));
@@ -3096,6 +3168,8 @@ void GL_APIENTRY LinkProgram(GLuint program)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         Program *programObject = context->getProgram(program);
 
         if (!programObject)
@@ -3201,6 +3275,8 @@ void GL_APIENTRY PolygonOffset(GLfloat factor, GLfloat units)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         context->getState().setPolygonOffsetParams(factor, units);
     }
 }
@@ -3215,6 +3291,8 @@ void GL_APIENTRY ReadPixels(GLint x, GLint y, GLsizei width, GLsizei height,
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (width < 0 || height < 0)
         {
             context->recordError(Error(GL_INVALID_VALUE));
@@ -3266,6 +3344,8 @@ void GL_APIENTRY RenderbufferStorage(GLenum target, GLenum internalformat, GLsiz
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (!ValidateRenderbufferStorageParametersANGLE(context, target, 0, internalformat,
                                                         width, height))
         {
@@ -3290,6 +3370,8 @@ void GL_APIENTRY SampleCoverage(GLclampf value, GLboolean invert)
 
     if (context)
     {
+        context->flushDeferredDraws();
+
         context->getState().setSampleCoverageParams(clamp01(value), invert == GL_TRUE);
     }
 }
@@ -3301,6 +3383,8 @@ void GL_APIENTRY Scissor(GLint x, GLint y, GLsizei width, GLsizei height)
     Context* context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (width < 0 || height < 0)
         {
             context->recordError(Error(GL_INVALID_VALUE));
@@ -3378,6 +3462,8 @@ void GL_APIENTRY StencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         switch (face)
         {
           case GL_FRONT:
@@ -3431,6 +3517,8 @@ void GL_APIENTRY StencilMaskSeparate(GLenum face, GLuint mask)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         switch (face)
         {
           case GL_FRONT:
@@ -3468,6 +3556,8 @@ void GL_APIENTRY StencilOpSeparate(GLenum face, GLenum fail, GLenum zfail, GLenu
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         switch (face)
         {
           case GL_FRONT:
@@ -3553,6 +3643,8 @@ void GL_APIENTRY TexImage2D(GLenum target, GLint level, GLint internalformat, GL
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3 &&
             !ValidateES2TexImageParameters(context, target, level, internalformat, false, false,
                                            0, 0, width, height, border, format, type, pixels))
@@ -3586,6 +3678,8 @@ void GL_APIENTRY TexParameterf(GLenum target, GLenum pname, GLfloat param)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (!ValidateTexParamParameters(context, pname, static_cast<GLint>(param)))
         {
             return;
@@ -3635,6 +3729,8 @@ void GL_APIENTRY TexParameteri(GLenum target, GLenum pname, GLint param)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (!ValidateTexParamParameters(context, pname, param))
         {
             return;
@@ -3688,6 +3784,8 @@ void GL_APIENTRY TexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3 &&
             !ValidateES2TexImageParameters(context, target, level, GL_NONE, false, true,
                                            xoffset, yoffset, width, height, 0, format, type, pixels))
@@ -3732,6 +3830,8 @@ void GL_APIENTRY Uniform1fv(GLint location, GLsizei count, const GLfloat* v)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (!ValidateUniform(context, GL_FLOAT, location, count))
         {
             return;
@@ -3754,6 +3854,8 @@ void GL_APIENTRY Uniform1iv(GLint location, GLsizei count, const GLint* v)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (!ValidateUniform(context, GL_INT, location, count))
         {
             return;
@@ -3778,6 +3880,8 @@ void GL_APIENTRY Uniform2fv(GLint location, GLsizei count, const GLfloat* v)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (!ValidateUniform(context, GL_FLOAT_VEC2, location, count))
         {
             return;
@@ -3802,6 +3906,8 @@ void GL_APIENTRY Uniform2iv(GLint location, GLsizei count, const GLint* v)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (!ValidateUniform(context, GL_INT_VEC2, location, count))
         {
             return;
@@ -3826,6 +3932,8 @@ void GL_APIENTRY Uniform3fv(GLint location, GLsizei count, const GLfloat* v)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (!ValidateUniform(context, GL_FLOAT_VEC3, location, count))
         {
             return;
@@ -3850,6 +3958,8 @@ void GL_APIENTRY Uniform3iv(GLint location, GLsizei count, const GLint* v)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (!ValidateUniform(context, GL_INT_VEC3, location, count))
         {
             return;
@@ -3874,6 +3984,8 @@ void GL_APIENTRY Uniform4fv(GLint location, GLsizei count, const GLfloat* v)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (!ValidateUniform(context, GL_FLOAT_VEC4, location, count))
         {
             return;
@@ -3898,6 +4010,8 @@ void GL_APIENTRY Uniform4iv(GLint location, GLsizei count, const GLint* v)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (!ValidateUniform(context, GL_INT_VEC4, location, count))
         {
             return;
@@ -3916,6 +4030,8 @@ void GL_APIENTRY UniformMatrix2fv(GLint location, GLsizei count, GLboolean trans
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (!ValidateUniformMatrix(context, GL_FLOAT_MAT2, location, count, transpose))
         {
             return;
@@ -3934,6 +4050,8 @@ void GL_APIENTRY UniformMatrix3fv(GLint location, GLsizei count, GLboolean trans
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (!ValidateUniformMatrix(context, GL_FLOAT_MAT3, location, count, transpose))
         {
             return;
@@ -3952,6 +4070,8 @@ void GL_APIENTRY UniformMatrix4fv(GLint location, GLsizei count, GLboolean trans
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (!ValidateUniformMatrix(context, GL_FLOAT_MAT4, location, count, transpose))
         {
             return;
@@ -3969,6 +4089,8 @@ void GL_APIENTRY UseProgram(GLuint program)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         Program *programObject = context->getProgram(program);
 
         if (!programObject && program != 0)
@@ -4002,6 +4124,8 @@ void GL_APIENTRY ValidateProgram(GLuint program)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         Program *programObject = context->getProgram(program);
 
         if (!programObject)
@@ -4029,6 +4153,8 @@ void GL_APIENTRY VertexAttrib1f(GLuint index, GLfloat x)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (index >= MAX_VERTEX_ATTRIBS)
         {
             context->recordError(Error(GL_INVALID_VALUE));
@@ -4047,6 +4173,8 @@ void GL_APIENTRY VertexAttrib1fv(GLuint index, const GLfloat* values)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (index >= MAX_VERTEX_ATTRIBS)
         {
             context->recordError(Error(GL_INVALID_VALUE));
@@ -4065,6 +4193,8 @@ void GL_APIENTRY VertexAttrib2f(GLuint index, GLfloat x, GLfloat y)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (index >= MAX_VERTEX_ATTRIBS)
         {
             context->recordError(Error(GL_INVALID_VALUE));
@@ -4083,6 +4213,8 @@ void GL_APIENTRY VertexAttrib2fv(GLuint index, const GLfloat* values)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (index >= MAX_VERTEX_ATTRIBS)
         {
             context->recordError(Error(GL_INVALID_VALUE));
@@ -4101,6 +4233,8 @@ void GL_APIENTRY VertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (index >= MAX_VERTEX_ATTRIBS)
         {
             context->recordError(Error(GL_INVALID_VALUE));
@@ -4119,6 +4253,8 @@ void GL_APIENTRY VertexAttrib3fv(GLuint index, const GLfloat* values)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (index >= MAX_VERTEX_ATTRIBS)
         {
             context->recordError(Error(GL_INVALID_VALUE));
@@ -4137,6 +4273,8 @@ void GL_APIENTRY VertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, G
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (index >= MAX_VERTEX_ATTRIBS)
         {
             context->recordError(Error(GL_INVALID_VALUE));
@@ -4155,6 +4293,8 @@ void GL_APIENTRY VertexAttrib4fv(GLuint index, const GLfloat* values)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (index >= MAX_VERTEX_ATTRIBS)
         {
             context->recordError(Error(GL_INVALID_VALUE));
@@ -4174,6 +4314,8 @@ void GL_APIENTRY VertexAttribPointer(GLuint index, GLint size, GLenum type, GLbo
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (index >= MAX_VERTEX_ATTRIBS)
         {
             context->recordError(Error(GL_INVALID_VALUE));
@@ -4247,6 +4389,8 @@ void GL_APIENTRY Viewport(GLint x, GLint y, GLsizei width, GLsizei height)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (width < 0 || height < 0)
         {
             context->recordError(Error(GL_INVALID_VALUE));
@@ -34,6 +34,8 @@ void GL_APIENTRY BeginQueryEXT(GLenum target, GLuint id)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (!ValidateBeginQuery(context, target, id))
         {
             return;
@@ -55,6 +57,8 @@ void GL_APIENTRY DeleteFencesNV(GLsizei n, const GLuint* fences)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (n < 0)
         {
             context->recordError(Error(GL_INVALID_VALUE));
@@ -75,6 +79,8 @@ void GL_APIENTRY DeleteQueriesEXT(GLsizei n, const GLuint *ids)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (n < 0)
         {
             context->recordError(Error(GL_INVALID_VALUE));
@@ -117,7 +123,7 @@ void GL_APIENTRY DrawElementsInstancedANGLE(GLenum mode, GLsizei count, GLenum t
     Context *context = GetValidGlobalContext();
     if (context)
     {
-        rx::RangeUI indexRange;
+        rx::DrawIndexRange indexRange;
         if (!ValidateDrawElementsInstancedANGLE(context, mode, count, type, indices, primcount, &indexRange))
         {
             return;
@@ -139,6 +145,8 @@ void GL_APIENTRY EndQueryEXT(GLenum target)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (!ValidateEndQuery(context, target))
         {
             return;
@@ -160,6 +168,8 @@ void GL_APIENTRY FinishFenceNV(GLuint fence)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         FenceNV *fenceObject = context->getFenceNV(fence);
 
         if (fenceObject == NULL)
@@ -478,6 +488,8 @@ void GL_APIENTRY ReadnPixelsEXT(GLint x, GLint y, GLsizei width, GLsizei height,
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (width < 0 || height < 0 || bufSize < 0)
         {
             context->recordError(Error(GL_INVALID_VALUE));
@@ -511,6 +523,8 @@ void GL_APIENTRY RenderbufferStorageMultisampleANGLE(GLenum target, GLsizei samp
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (!ValidateRenderbufferStorageParametersANGLE(context, target, samples, internalformat,
             width, height))
         {
@@ -534,6 +548,8 @@ void GL_APIENTRY SetFenceNV(GLuint fence, GLenum condition)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (condition != GL_ALL_COMPLETED_NV)
         {
             context->recordError(Error(GL_INVALID_ENUM));
@@ -564,6 +580,8 @@ GLboolean GL_APIENTRY TestFenceNV(GLuint fence)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         FenceNV *fenceObject = context->getFenceNV(fence);
 
         if (fenceObject == NULL)
@@ -600,6 +618,8 @@ void GL_APIENTRY TexStorage2DEXT(GLenum target, GLsizei levels, GLenum internalf
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (!context->getExtensions().textureStorage)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -636,6 +656,8 @@ void GL_APIENTRY VertexAttribDivisorANGLE(GLuint index, GLuint divisor)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (index >= MAX_VERTEX_ATTRIBS)
         {
             context->recordError(Error(GL_INVALID_VALUE));
@@ -646,6 +668,98 @@ void GL_APIENTRY VertexAttribDivisorANGLE(GLuint index, GLuint divisor)
     }
 }
 
+void GL_APIENTRY MultiDrawArraysEXT(GLenum mode, const GLint *first, const GLsizei *count, GLsizei primcount)
+{
+    EVENT("(GLenum mode = 0x%X, const GLint* first = 0x%0.8p, const GLsizei* count = 0x%0.8p, GLsizei primcount = %d)",
+          mode, first, count, primcount);
+
+    Context *context = GetValidGlobalContext();
+    if (context)
+    {
+        if (!ValidateMultiDrawArraysEXT(context, mode, first, count, primcount))
+        {
+            return;
+        }
+
+        Error error = context->multiDrawArrays(mode, first, count, NULL, primcount);
+        if (error.isError())
+        {
+            context->recordError(error);
+            return;
+        }
+    }
+}
+
+void GL_APIENTRY MultiDrawElementsEXT(GLenum mode, const GLsizei *count, GLenum type, const GLvoid *const *indices, GLsizei primcount)
+{
+    EVENT("(GLenum mode = 0x%X, const GLsizei* count = 0x%0.8p, GLenum type = 0x%X, const GLvoid* const* indices = 0x%0.8p, "
+          "GLsizei primcount = %d)", mode, count, type, indices, primcount);
+
+    Context *context = GetValidGlobalContext();
+    if (context)
+    {
+        std::vector<rx::DrawIndexRange> indexRanges;
+        if (!ValidateMultiDrawElementsEXT(context, mode, count, type, indices, primcount, &indexRanges))
+        {
+            return;
+        }
+
+        Error error = context->multiDrawElements(mode, count, type, indices, NULL, indexRanges.data(), primcount);
+        if (error.isError())
+        {
+            context->recordError(error);
+            return;
+        }
+    }
+}
+
+void GL_APIENTRY MultiDrawArraysInstancedANGLE(GLenum mode, const GLint *firsts, const GLsizei *counts, const GLsizei *instanceCounts, GLsizei drawcount)
+{
+    EVENT("(GLenum mode = 0x%X, const GLint* firsts = 0x%0.8p, const GLsizei* counts = 0x%0.8p, "
+          "const GLsizei* instanceCounts = 0x%0.8p, GLsizei drawcount = %d)", mode, firsts, counts, instanceCounts, drawcount);
+
+    Context *context = GetValidGlobalContext();
+    if (context)
+    {
+        if (!ValidateMultiDrawArraysInstancedANGLE(context, mode, firsts, counts, instanceCounts, drawcount))
+        {
+            return;
+        }
+
+        Error error = context->multiDrawArrays(mode, firsts, counts, instanceCounts, drawcount);
+        if (error.isError())
+        {
+            context->recordError(error);
+            return;
+        }
+    }
+}
+
+void GL_APIENTRY MultiDrawElementsInstancedANGLE(GLenum mode, const GLsizei *counts, GLenum type, const GLvoid *const *indices, const GLsizei *instanceCounts, GLsizei drawcount)
+{
+    EVENT("(GLenum mode = 0x%X, const GLsizei* counts = 0x%0.8p, GLenum type = 0x%X, const GLvoid* const* indices = 0x%0.8p, "
+          "const GLsizei* instanceCounts = 0x%0.8p, GLsizei drawcount = %d)", mode, counts, type, indices, instanceCounts, drawcount);
+
+    Context *context = GetValidGlobalContext();
+    if (context)
+    {
+        std::vector<rx::DrawIndexRange> indexRanges;
+        if (!ValidateMultiDrawElementsInstancedANGLE(context, mode, counts, type, indices, instanceCounts, drawcount,
+                                                     &indexRanges))
+        {
+            return;
+        }
+
+        Error error = context->multiDrawElements(mode, counts, type, indices, instanceCounts, indexRanges.data(),
+                                                 drawcount);
+        if (error.isError())
+        {
+            context->recordError(error);
+            return;
+        }
+    }
+}
+
 void GL_APIENTRY BlitFramebufferANGLE(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1,
                           GLbitfield mask, GLenum filter)
 {
@@ -657,6 +771,8 @@ void GL_APIENTRY BlitFramebufferANGLE(GLint srcX0, GLint srcY0, GLint srcX1, GLi
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (!ValidateBlitFramebufferParameters(context, srcX0, srcY0, srcX1, srcY1,
                                                dstX0, dstY0, dstX1, dstY1, mask, filter,
                                                true))
@@ -726,6 +842,8 @@ void GL_APIENTRY ProgramBinaryOES(GLuint program, GLenum binaryFormat, const voi
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         const std::vector<GLenum> &programBinaryFormats = context->getCaps().programBinaryFormats;
         if (std::find(programBinaryFormats.begin(), programBinaryFormats.end(), binaryFormat) == programBinaryFormats.end())
         {
@@ -756,6 +874,8 @@ void GL_APIENTRY DrawBuffersEXT(GLsizei n, const GLenum *bufs)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (n < 0 || static_cast<GLuint>(n) > context->getCaps().maxDrawBuffers)
         {
             context->recordError(Error(GL_INVALID_VALUE));
@@ -837,6 +957,8 @@ void *GL_APIENTRY MapBufferOES(GLenum target, GLenum access)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (!ValidBufferTarget(context, target))
         {
             context->recordError(Error(GL_INVALID_ENUM));
@@ -883,6 +1005,8 @@ GLboolean GL_APIENTRY UnmapBufferOES(GLenum target)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (!ValidBufferTarget(context, target))
         {
             context->recordError(Error(GL_INVALID_ENUM));
@@ -920,6 +1044,8 @@ void *GL_APIENTRY MapBufferRangeEXT(GLenum target, GLintptr offset, GLsizeiptr l
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (!ValidBufferTarget(context, target))
         {
             context->recordError(Error(GL_INVALID_ENUM));
@@ -1014,6 +1140,8 @@ void GL_APIENTRY FlushMappedBufferRangeEXT(GLenum target, GLintptr offset, GLsiz
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (offset < 0 || length < 0)
         {
             context->recordError(Error(GL_INVALID_VALUE));
@@ -35,6 +35,8 @@ void GL_APIENTRY ReadBuffer(GLenum mode)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (!ValidateReadBuffer(context, mode))
         {
             return;
@@ -74,6 +76,8 @@ void GL_APIENTRY TexImage3D(GLenum target, GLint level, GLint internalformat, GL
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -109,6 +113,8 @@ void GL_APIENTRY TexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -150,6 +156,8 @@ void GL_APIENTRY CopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GL
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -186,6 +194,8 @@ void GL_APIENTRY CompressedTexImage3D(GLenum target, GLint level, GLenum interna
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -228,6 +238,8 @@ void GL_APIENTRY CompressedTexSubImage3D(GLenum target, GLint level, GLint xoffs
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -305,6 +317,8 @@ void GL_APIENTRY DeleteQueries(GLsizei n, const GLuint* ids)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -350,6 +364,8 @@ void GL_APIENTRY BeginQuery(GLenum target, GLuint id)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -377,6 +393,8 @@ void GL_APIENTRY EndQuery(GLenum target)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -494,6 +512,8 @@ GLboolean GL_APIENTRY UnmapBuffer(GLenum target)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -528,6 +548,8 @@ void GL_APIENTRY DrawBuffers(GLsizei n, const GLenum* bufs)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -546,6 +568,8 @@ void GL_APIENTRY UniformMatrix2x3fv(GLint location, GLsizei count, GLboolean tra
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (!ValidateUniformMatrix(context, GL_FLOAT_MAT2x3, location, count, transpose))
         {
             return;
@@ -564,6 +588,8 @@ void GL_APIENTRY UniformMatrix3x2fv(GLint location, GLsizei count, GLboolean tra
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (!ValidateUniformMatrix(context, GL_FLOAT_MAT3x2, location, count, transpose))
         {
             return;
@@ -582,6 +608,8 @@ void GL_APIENTRY UniformMatrix2x4fv(GLint location, GLsizei count, GLboolean tra
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (!ValidateUniformMatrix(context, GL_FLOAT_MAT2x4, location, count, transpose))
         {
             return;
@@ -600,6 +628,8 @@ void GL_APIENTRY UniformMatrix4x2fv(GLint location, GLsizei count, GLboolean tra
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (!ValidateUniformMatrix(context, GL_FLOAT_MAT4x2, location, count, transpose))
         {
             return;
@@ -618,6 +648,8 @@ void GL_APIENTRY UniformMatrix3x4fv(GLint location, GLsizei count, GLboolean tra
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (!ValidateUniformMatrix(context, GL_FLOAT_MAT3x4, location, count, transpose))
         {
             return;
@@ -636,6 +668,8 @@ void GL_APIENTRY UniformMatrix4x3fv(GLint location, GLsizei count, GLboolean tra
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (!ValidateUniformMatrix(context, GL_FLOAT_MAT4x3, location, count, transpose))
         {
             return;
@@ -655,6 +689,8 @@ void GL_APIENTRY BlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint sr
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -694,6 +730,8 @@ void GL_APIENTRY RenderbufferStorageMultisample(GLenum target, GLsizei samples,
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -718,6 +756,8 @@ void GL_APIENTRY FramebufferTextureLayer(GLenum target, GLenum attachment, GLuin
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (!ValidateFramebufferTextureLayer(context, target, attachment, texture,
                                              level, layer))
         {
@@ -760,6 +800,8 @@ GLvoid *GL_APIENTRY MapBufferRange(GLenum target, GLintptr offset, GLsizeiptr le
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -779,6 +821,8 @@ void GL_APIENTRY FlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeip
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -796,6 +840,8 @@ void GL_APIENTRY BindVertexArray(GLuint array)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -823,6 +869,8 @@ void GL_APIENTRY DeleteVertexArrays(GLsizei n, const GLuint* arrays)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -985,6 +1033,8 @@ void GL_APIENTRY BeginTransformFeedback(GLenum primitiveMode)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -1030,6 +1080,8 @@ void GL_APIENTRY EndTransformFeedback(void)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -1057,6 +1109,8 @@ void GL_APIENTRY BindBufferRange(GLenum target, GLuint index, GLuint buffer, GLi
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -1144,6 +1198,8 @@ void GL_APIENTRY BindBufferBase(GLenum target, GLuint index, GLuint buffer)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -1209,6 +1265,8 @@ void GL_APIENTRY TransformFeedbackVaryings(GLuint program, GLsizei count, const
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -1297,6 +1355,8 @@ void GL_APIENTRY VertexAttribIPointer(GLuint index, GLint size, GLenum type, GLs
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -1451,6 +1511,8 @@ void GL_APIENTRY VertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -1476,6 +1538,8 @@ void GL_APIENTRY VertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GL
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -1500,6 +1564,8 @@ void GL_APIENTRY VertexAttribI4iv(GLuint index, const GLint* v)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -1523,6 +1589,8 @@ void GL_APIENTRY VertexAttribI4uiv(GLuint index, const GLuint* v)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -1624,6 +1692,8 @@ void GL_APIENTRY Uniform1uiv(GLint location, GLsizei count, const GLuint* value)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (!ValidateUniform(context, GL_UNSIGNED_INT, location, count))
         {
             return;
@@ -1642,6 +1712,8 @@ void GL_APIENTRY Uniform2uiv(GLint location, GLsizei count, const GLuint* value)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (!ValidateUniform(context, GL_UNSIGNED_INT_VEC2, location, count))
         {
             return;
@@ -1660,6 +1732,8 @@ void GL_APIENTRY Uniform3uiv(GLint location, GLsizei count, const GLuint* value)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (!ValidateUniform(context, GL_UNSIGNED_INT_VEC3, location, count))
         {
             return;
@@ -1678,6 +1752,8 @@ void GL_APIENTRY Uniform4uiv(GLint location, GLsizei count, const GLuint* value)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (!ValidateUniform(context, GL_UNSIGNED_INT_VEC4, location, count))
         {
             return;
@@ -1696,6 +1772,8 @@ void GL_APIENTRY ClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint* val
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (!ValidateClearBuffer(context))
         {
             return;
@@ -1744,6 +1822,8 @@ void GL_APIENTRY ClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint* v
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (!ValidateClearBuffer(context))
         {
             return;
@@ -1784,6 +1864,8 @@ void GL_APIENTRY ClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat* v
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (!ValidateClearBuffer(context))
         {
             return;
@@ -1832,6 +1914,8 @@ void GL_APIENTRY ClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, G
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (!ValidateClearBuffer(context))
         {
             return;
@@ -1903,6 +1987,8 @@ void GL_APIENTRY CopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintp
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -2229,6 +2315,8 @@ void GL_APIENTRY UniformBlockBinding(GLuint program, GLuint uniformBlockIndex, G
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -2310,7 +2398,7 @@ void GL_APIENTRY DrawElementsInstanced(GLenum mode, GLsizei count, GLenum type,
             return;
         }
 
-        rx::RangeUI indexRange;
+        rx::DrawIndexRange indexRange;
         if (!ValidateDrawElementsInstanced(context, mode, count, type, indices, instanceCount, &indexRange))
         {
             return;
@@ -2332,6 +2420,8 @@ GLsync GL_APIENTRY FenceSync_(GLenum condition, GLbitfield flags)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -2393,6 +2483,8 @@ void GL_APIENTRY DeleteSync(GLsync sync)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -2417,6 +2509,8 @@ GLenum GL_APIENTRY ClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeou
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -2459,6 +2553,8 @@ void GL_APIENTRY WaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -2746,6 +2842,8 @@ void GL_APIENTRY DeleteSamplers(GLsizei count, const GLuint* samplers)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -2791,6 +2889,8 @@ void GL_APIENTRY BindSampler(GLuint unit, GLuint sampler)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -2820,6 +2920,8 @@ void GL_APIENTRY SamplerParameteri(GLuint sampler, GLenum pname, GLint param)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -2858,6 +2960,8 @@ void GL_APIENTRY SamplerParameterf(GLuint sampler, GLenum pname, GLfloat param)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -2952,6 +3056,8 @@ void GL_APIENTRY VertexAttribDivisor(GLuint index, GLuint divisor)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -2975,6 +3081,8 @@ void GL_APIENTRY BindTransformFeedback(GLenum target, GLuint id)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -3018,6 +3126,8 @@ void GL_APIENTRY DeleteTransformFeedbacks(GLsizei n, const GLuint* ids)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -3077,6 +3187,8 @@ void GL_APIENTRY PauseTransformFeedback(void)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -3104,6 +3216,8 @@ void GL_APIENTRY ResumeTransformFeedback(void)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -3151,6 +3265,8 @@ void GL_APIENTRY ProgramBinary(GLuint program, GLenum binaryFormat, const GLvoid
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -3170,6 +3286,8 @@ void GL_APIENTRY ProgramParameteri(GLuint program, GLenum pname, GLint value)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -3189,6 +3307,8 @@ void GL_APIENTRY InvalidateFramebuffer(GLenum target, GLsizei numAttachments, co
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -3224,6 +3344,8 @@ void GL_APIENTRY InvalidateSubFramebuffer(GLenum target, GLsizei numAttachments,
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -3259,6 +3381,8 @@ void GL_APIENTRY TexStorage2D(GLenum target, GLsizei levels, GLenum internalform
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -3290,6 +3414,8 @@ void GL_APIENTRY TexStorage3D(GLenum target, GLsizei levels, GLenum internalform
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        context->flushDeferredDraws();
+
         if (context->getClientVersion() < 3)
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -18,8 +18,6 @@
 namespace
 {
 
-static TLSIndex currentTLS = TLS_INVALID_INDEX;
-
 struct Current
 {
     EGLint error;
@@ -27,9 +25,34 @@ struct Current
     egl::Display *display;
     egl::Surface *drawSurface;
     egl::Surface *readSurface;
+#if !defined(ANGLE_PLATFORM_POSIX)
     gl::Context *context;
+#endif
+};
+
+#if defined(ANGLE_PLATFORM_POSIX)
+
+// The thread's state is a statically initialized thread_local, so reading it needs neither a lazy
+// TLS index nor an allocation. EGL_NO_DISPLAY and EGL_NO_SURFACE are both null. The current
+// context is kept apart in gl::gCurrentContext.
+static thread_local Current currentData =
+{
+    EGL_SUCCESS,
+    EGL_OPENGL_ES_API,
+    nullptr,
+    nullptr,
+    nullptr,
 };
 
+inline Current *GetCurrentData()
+{
+    return &currentData;
+}
+
+#else
+
+static TLSIndex currentTLS = TLS_INVALID_INDEX;
+
 Current *AllocateCurrent()
 {
     ASSERT(currentTLS != TLS_INVALID_INDEX);
@@ -111,36 +134,29 @@ extern "C" BOOL WINAPI DllMain(HINSTANCE, DWORD reason, LPVOID)
 
     return TRUE;
 }
-#endif
+#endif // ANGLE_PLATFORM_WINDOWS
+
+#endif // ANGLE_PLATFORM_POSIX
 
 }
 
 namespace gl
 {
 
+#if defined(ANGLE_PLATFORM_POSIX)
+thread_local Context *gCurrentContext = nullptr;
+#else
 Context *GetGlobalContext()
 {
     Current *current = GetCurrentData();
 
     return current->context;
 }
+#endif
 
-Context *GetValidGlobalContext()
+void RecordContextLost(Context *context)
 {
-    gl::Context *context = GetGlobalContext();
-    if (context)
-    {
-        if (context->isContextLost())
-        {
-            context->recordError(gl::Error(GL_OUT_OF_MEMORY, "Context has been lost."));
-            return nullptr;
-        }
-        else
-        {
-            return context;
-        }
-    }
-    return nullptr;
+    context->recordError(gl::Error(GL_OUT_OF_MEMORY, "Context has been lost."));
 }
 
 }
@@ -220,16 +236,18 @@ Surface *GetGlobalReadSurface()
 
 void SetGlobalContext(gl::Context *context)
 {
+#if defined(ANGLE_PLATFORM_POSIX)
+    gl::gCurrentContext = context;
+#else
     Current *current = GetCurrentData();
 
     current->context = context;
+#endif
 }
 
 gl::Context *GetGlobalContext()
 {
-    Current *current = GetCurrentData();
-
-    return current->context;
+    return gl::GetGlobalContext();
 }
 
 }
@@ -9,14 +9,42 @@
 #ifndef LIBGLESV2_GLOBALSTATE_H_
 #define LIBGLESV2_GLOBALSTATE_H_
 
+#include "libANGLE/Context.h"
+
+#include "common/platform.h"
+
 #include <EGL/egl.h>
 
 namespace gl
 {
-class Context;
 
+#if defined(ANGLE_PLATFORM_POSIX)
+// Every GL entry point looks up the current context, so on POSIX it is kept in a thread_local of
+// its own that the lookups below read inline.
+extern thread_local Context *gCurrentContext;
+
+inline Context *GetGlobalContext()
+{
+    return gCurrentContext;
+}
+#else
 Context *GetGlobalContext();
-Context *GetValidGlobalContext();
+#endif
+
+// Records the error for a call made on a lost context, rarely enough to be kept out of line.
+void RecordContextLost(Context *context);
+
+inline Context *GetValidGlobalContext()
+{
+    Context *context = GetGlobalContext();
+    if (context != nullptr && context->isContextLost())
+    {
+        RecordContextLost(context);
+        return nullptr;
+    }
+
+    return context;
+}
 
 }
 
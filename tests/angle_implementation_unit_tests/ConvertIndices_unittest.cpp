@@ -0,0 +1,111 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "libANGLE/renderer/d3d/convertindices.h"
+
+#include <cstdlib>
+#include <limits>
+#include <vector>
+
+using namespace rx;
+
+namespace
+{
+
+// Written around the converted indices, to catch writes past either end
+const GLuint Canary = 0xCDCDCDCD;
+
+template <typename InT, typename OutT>
+void CheckConversion(GLenum sourceType, GLenum destinationType, const std::vector<InT> &indices, size_t count,
+                     bool primitiveRestartEnabled)
+{
+    // Copy the indices to memory that ends right after them, so that over-reads show up under ASan
+    std::vector<InT> exactIndices(indices.begin(), indices.begin() + count);
+    const void *source = exactIndices.empty() ? NULL : exactIndices.data();
+
+    const InT restartIndex = std::numeric_limits<InT>::max();
+
+    std::vector<OutT> expected;
+    expected.push_back(static_cast<OutT>(Canary));
+    GLuint expectedMin = std::numeric_limits<GLuint>::max();
+    GLuint expectedMax = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        if (primitiveRestartEnabled && indices[i] == restartIndex)
+        {
+            expected.push_back(std::numeric_limits<OutT>::max());
+        }
+        else
+        {
+            expected.push_back(indices[i]);
+            expectedMin = std::min<GLuint>(expectedMin, indices[i]);
+            expectedMax = std::max<GLuint>(expectedMax, indices[i]);
+        }
+    }
+    expected.push_back(static_cast<OutT>(Canary));
+
+    if (expectedMin > expectedMax)
+    {
+        expectedMin = 0;
+        expectedMax = 0;
+    }
+
+    std::vector<OutT> output(count + 2, static_cast<OutT>(Canary));
+    RangeUI range = ConvertIndices(sourceType, destinationType, source, count, &output[1], primitiveRestartEnabled);
+
+    EXPECT_EQ(expected, output) << count << " indices, primitive restart " << primitiveRestartEnabled;
+    EXPECT_EQ(expectedMin, range.start) << count << " indices, primitive restart " << primitiveRestartEnabled;
+    EXPECT_EQ(expectedMax, range.end) << count << " indices, primitive restart " << primitiveRestartEnabled;
+}
+
+template <typename InT, typename OutT>
+void CheckIndexTypes(GLenum sourceType, GLenum destinationType)
+{
+    std::vector<InT> indices;
+    for (size_t i = 0; i < 200; i++)
+    {
+        // Keep the top bit of each type in play, which the comparisons must not treat as a sign,
+        // and make restart indices common
+        InT index = static_cast<InT>(rand() * 65537u);
+        indices.push_back((rand() % 8 == 0) ? std::numeric_limits<InT>::max() : index);
+    }
+
+    for (size_t count = 0; count < 70; count++)
+    {
+        CheckConversion<InT, OutT>(sourceType, destinationType, indices, count, false);
+        CheckConversion<InT, OutT>(sourceType, destinationType, indices, count, true);
+    }
+
+    // Only restart indices, which leave nothing to draw
+    std::vector<InT> restarts(40, std::numeric_limits<InT>::max());
+    CheckConversion<InT, OutT>(sourceType, destinationType, restarts, restarts.size(), true);
+    CheckConversion<InT, OutT>(sourceType, destinationType, restarts, restarts.size(), false);
+}
+
+TEST(ConvertIndicesTest, WidensBytes)
+{
+    CheckIndexTypes<GLubyte, GLushort>(GL_UNSIGNED_BYTE, GL_UNSIGNED_SHORT);
+}
+
+TEST(ConvertIndicesTest, CopiesShorts)
+{
+    CheckIndexTypes<GLushort, GLushort>(GL_UNSIGNED_SHORT, GL_UNSIGNED_SHORT);
+}
+
+TEST(ConvertIndicesTest, WidensShorts)
+{
+    CheckIndexTypes<GLushort, GLuint>(GL_UNSIGNED_SHORT, GL_UNSIGNED_INT);
+}
+
+TEST(ConvertIndicesTest, CopiesInts)
+{
+    CheckIndexTypes<GLuint, GLuint>(GL_UNSIGNED_INT, GL_UNSIGNED_INT);
+}
+
+}
@@ -0,0 +1,134 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "libANGLE/renderer/d3d/copyimage.h"
+
+#include <cstdlib>
+#include <vector>
+
+using namespace rx;
+
+namespace
+{
+
+// Source pixels covering every value of 16-bit formats, or random values and single channel ramps
+// for 32-bit formats.
+template <typename T>
+std::vector<uint8_t> GetSourcePixels()
+{
+    std::vector<uint8_t> pixels;
+    if (sizeof(T) == 2)
+    {
+        for (uint32_t value = 0; value <= 0xFFFF; value++)
+        {
+            pixels.push_back(static_cast<uint8_t>(value));
+            pixels.push_back(static_cast<uint8_t>(value >> 8));
+        }
+    }
+    else
+    {
+        for (uint32_t shift = 0; shift < 32; shift += 8)
+        {
+            for (uint32_t value = 0; value < 1024; value++)
+            {
+                uint32_t word = value << shift;
+                pixels.insert(pixels.end(), reinterpret_cast<uint8_t*>(&word), reinterpret_cast<uint8_t*>(&word) + 4);
+            }
+        }
+        for (size_t i = 0; i < 4 * 4096; i++)
+        {
+            pixels.push_back(static_cast<uint8_t>(rand()));
+        }
+    }
+    return pixels;
+}
+
+template <typename sourceType, typename destType>
+void CheckUnormCopy()
+{
+    const std::vector<uint8_t> source = GetSourcePixels<sourceType>();
+    const size_t count = source.size() / sizeof(sourceType);
+
+    std::vector<uint8_t> expected(count * sizeof(destType));
+    for (size_t i = 0; i < count; i++)
+    {
+        CopyPixel<sourceType, destType, GLfloat>(&source[i * sizeof(sourceType)], &expected[i * sizeof(destType)]);
+    }
+
+    std::vector<uint8_t> actual(count * sizeof(destType));
+    CopyUnormPixels<sourceType, destType>(source.data(), actual.data(), count);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const uint8_t *expectedPixel = &expected[i * sizeof(destType)];
+        const uint8_t *actualPixel = &actual[i * sizeof(destType)];
+        ASSERT_TRUE(std::equal(expectedPixel, expectedPixel + sizeof(destType), actualPixel)) << "pixel " << i;
+    }
+}
+
+template <typename T>
+class CopyUnormPixelsTest : public testing::Test
+{
+};
+
+typedef testing::Types<R8G8B8A8, B8G8R8A8, B8G8R8X8, A8R8G8B8, R10G10B10A2,
+                       R5G6B5, B5G5R5A1, R5G5B5A1, R4G4B4A4, B4G4R4A4, A4R4G4B4> UnormFormats;
+TYPED_TEST_CASE(CopyUnormPixelsTest, UnormFormats);
+
+// Integer copies give the same results as going through gl::ColorF
+TYPED_TEST(CopyUnormPixelsTest, MatchesColorF)
+{
+    srand(0);
+
+    CheckUnormCopy<TypeParam, R8G8B8A8>();
+    CheckUnormCopy<TypeParam, B8G8R8A8>();
+    CheckUnormCopy<TypeParam, B8G8R8X8>();
+    CheckUnormCopy<TypeParam, A8R8G8B8>();
+    CheckUnormCopy<TypeParam, R10G10B10A2>();
+    CheckUnormCopy<TypeParam, R5G6B5>();
+    CheckUnormCopy<TypeParam, B5G5R5A1>();
+    CheckUnormCopy<TypeParam, R5G5B5A1>();
+    CheckUnormCopy<TypeParam, R4G4B4A4>();
+    CheckUnormCopy<TypeParam, B4G4R4A4>();
+    CheckUnormCopy<TypeParam, A4R4G4B4>();
+}
+
+// Red and blue swaps of every row length and alignment, covering the vectorized part and the
+// scalar tail
+TEST(CopyUnormPixelsTest, SwapRedBlueRows)
+{
+    srand(0);
+
+    std::vector<uint8_t> source(4 * 64 + 3);
+    for (size_t i = 0; i < source.size(); i++)
+    {
+        source[i] = static_cast<uint8_t>(rand());
+    }
+
+    for (size_t offset = 0; offset < 4; offset++)
+    {
+        for (size_t count = 0; count <= 37; count++)
+        {
+            std::vector<uint8_t> expected(4 * count + offset, 0);
+            std::vector<uint8_t> actual(4 * count + offset, 0);
+            for (size_t i = 0; i < count; i++)
+            {
+                CopyPixel<B8G8R8A8, R8G8B8A8, GLfloat>(&source[offset + i * 4], &expected[offset + i * 4]);
+            }
+
+            CopyUnormPixels<B8G8R8A8, R8G8B8A8>(source.data() + offset, actual.data() + offset, count);
+            EXPECT_EQ(expected, actual) << "BGRA8 to RGBA8, " << count << " pixels at offset " << offset;
+
+            CopyUnormPixels<R8G8B8A8, B8G8R8A8>(source.data() + offset, actual.data() + offset, count);
+            EXPECT_EQ(expected, actual) << "RGBA8 to BGRA8, " << count << " pixels at offset " << offset;
+        }
+    }
+}
+
+}
@@ -0,0 +1,265 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "libANGLE/renderer/d3d/convertvertex.h"
+#include "libANGLE/renderer/d3d/d3d9/vertexconversion.h"
+#include "libANGLE/renderer/d3d/d3d11/copyvertex.h"
+
+#include <cstdlib>
+#include <vector>
+
+using namespace rx;
+
+namespace
+{
+
+// Written around the converted vertices, to catch writes past either end
+const uint8_t CanaryByte = 0xCD;
+const size_t CanarySize = 16;
+
+typedef void (*VertexCopyFunction)(const uint8_t *input, size_t stride, size_t count, uint8_t *output);
+
+// Converts a single vertex, one component at a time, as the scalar conversions define it
+typedef void (*ReferenceVertexCopy)(const uint8_t *input, uint8_t *output);
+
+template <typename T>
+T ReadComponent(const uint8_t *input, size_t index)
+{
+    T value;
+    memcpy(&value, input + index * sizeof(T), sizeof(T));
+    return value;
+}
+
+template <typename T>
+void WriteComponent(uint8_t *output, size_t index, T value)
+{
+    memcpy(output + index * sizeof(T), &value, sizeof(T));
+}
+
+template <typename T, size_t inputComponentCount, size_t outputComponentCount, bool normalized>
+void ReferenceTo32F(const uint8_t *input, uint8_t *output)
+{
+    typedef std::numeric_limits<T> NL;
+
+    for (size_t j = 0; j < outputComponentCount; j++)
+    {
+        float value = 0.0f;
+        if (j < inputComponentCount)
+        {
+            T x = ReadComponent<T>(input, j);
+            if (!normalized)
+            {
+                value = static_cast<float>(x);
+            }
+            else if (NL::is_signed)
+            {
+                value = (2 * static_cast<float>(x) + 1) * (1.0f / (2 * static_cast<float>(NL::max()) + 1));
+            }
+            else
+            {
+                value = static_cast<float>(x) / static_cast<float>(NL::max());
+            }
+        }
+        WriteComponent(output, j, value);
+    }
+}
+
+template <size_t inputComponentCount, size_t outputComponentCount>
+void ReferenceFixedTo32F(const uint8_t *input, uint8_t *output)
+{
+    for (size_t j = 0; j < outputComponentCount; j++)
+    {
+        float value = 0.0f;
+        if (j < inputComponentCount)
+        {
+            value = static_cast<float>(ReadComponent<GLfixed>(input, j)) * (1.0f / 65536.0f);
+        }
+        WriteComponent(output, j, value);
+    }
+}
+
+template <size_t inputComponentCount, size_t outputComponentCount, bool normalized>
+void Reference8To16(const uint8_t *input, uint8_t *output)
+{
+    for (size_t j = 0; j < outputComponentCount; j++)
+    {
+        GLshort value = 0;
+        if (j < inputComponentCount)
+        {
+            int x = ReadComponent<GLbyte>(input, j);
+            if (normalized && x > 0)
+            {
+                value = static_cast<GLshort>(x * 256 + x * 2 + ((x & 0x40) >> 6));
+            }
+            else
+            {
+                value = static_cast<GLshort>(normalized ? x * 256 : x);
+            }
+        }
+        else if (j == 3)
+        {
+            value = normalized ? INT16_MAX : 1;
+        }
+        WriteComponent(output, j, value);
+    }
+}
+
+struct VertexCopyCase
+{
+    const char *name;
+    VertexCopyFunction copyFunction;
+    ReferenceVertexCopy referenceCopy;
+    size_t inputBytes;
+    size_t outputBytes;
+};
+
+void CheckVertexCopy(const VertexCopyCase &copyCase, size_t stride, size_t count)
+{
+    // Size the input to end right after the last vertex, so that over-reads show up under ASan
+    std::vector<uint8_t> input(count > 0 ? (count - 1) * stride + copyCase.inputBytes : 0);
+    for (size_t i = 0; i < input.size(); i++)
+    {
+        input[i] = static_cast<uint8_t>(rand());
+    }
+
+    const size_t outputSize = count * copyCase.outputBytes + 2 * CanarySize;
+    std::vector<uint8_t> expected(outputSize, CanaryByte);
+    for (size_t i = 0; i < count; i++)
+    {
+        copyCase.referenceCopy(&input[i * stride], &expected[CanarySize + i * copyCase.outputBytes]);
+    }
+
+    std::vector<uint8_t> actual(outputSize, CanaryByte);
+    copyCase.copyFunction(input.empty() ? NULL : input.data(), stride, count, &actual[CanarySize]);
+
+    ASSERT_TRUE(expected == actual) << copyCase.name << ", " << count << " vertices " << stride << " bytes apart";
+}
+
+void CheckVertexCopies(const VertexCopyCase *copyCases, size_t caseCount)
+{
+    srand(0);
+
+    for (size_t caseIndex = 0; caseIndex < caseCount; caseIndex++)
+    {
+        const VertexCopyCase &copyCase = copyCases[caseIndex];
+        // Strides keep the components aligned, as the scalar conversions read them in place
+        const size_t strides[] = { copyCase.inputBytes, copyCase.inputBytes * 2, (copyCase.inputBytes + 3) & ~3u,
+                                   copyCase.inputBytes + 16 };
+
+        for (size_t strideIndex = 0; strideIndex < ArraySize(strides); strideIndex++)
+        {
+            for (size_t count = 0; count < 40; count++)
+            {
+                CheckVertexCopy(copyCase, strides[strideIndex], count);
+            }
+            CheckVertexCopy(copyCase, strides[strideIndex], 1000);
+        }
+    }
+}
+
+#define VERTEX_COPY_CASE(function, reference, inputBytes, outputBytes) \
+    { #function, function, reference, inputBytes, outputBytes }
+
+// The conversions of the D3D11 vertex format table that have SSE2 versions
+TEST(CopyVertexTest, D3D11Conversions)
+{
+    const VertexCopyCase copyCases[] =
+    {
+        VERTEX_COPY_CASE((CopyTo32FVertexData<GLushort, 1, 2, false>), (ReferenceTo32F<GLushort, 1, 2, false>), 2, 8),
+        VERTEX_COPY_CASE((CopyTo32FVertexData<GLushort, 2, 2, false>), (ReferenceTo32F<GLushort, 2, 2, false>), 4, 8),
+        VERTEX_COPY_CASE((CopyTo32FVertexData<GLushort, 3, 3, false>), (ReferenceTo32F<GLushort, 3, 3, false>), 6, 12),
+        VERTEX_COPY_CASE((CopyTo32FVertexData<GLushort, 4, 4, false>), (ReferenceTo32F<GLushort, 4, 4, false>), 8, 16),
+        VERTEX_COPY_CASE((CopyTo32FVertexData<GLushort, 1, 2, true>), (ReferenceTo32F<GLushort, 1, 2, true>), 2, 8),
+        VERTEX_COPY_CASE((CopyTo32FVertexData<GLushort, 2, 2, true>), (ReferenceTo32F<GLushort, 2, 2, true>), 4, 8),
+        VERTEX_COPY_CASE((CopyTo32FVertexData<GLushort, 3, 3, true>), (ReferenceTo32F<GLushort, 3, 3, true>), 6, 12),
+        VERTEX_COPY_CASE((CopyTo32FVertexData<GLushort, 4, 4, true>), (ReferenceTo32F<GLushort, 4, 4, true>), 8, 16),
+        VERTEX_COPY_CASE((CopyTo32FVertexData<GLint, 1, 1, true>), (ReferenceTo32F<GLint, 1, 1, true>), 4, 4),
+        VERTEX_COPY_CASE((CopyTo32FVertexData<GLint, 2, 2, true>), (ReferenceTo32F<GLint, 2, 2, true>), 8, 8),
+        VERTEX_COPY_CASE((CopyTo32FVertexData<GLint, 3, 3, true>), (ReferenceTo32F<GLint, 3, 3, true>), 12, 12),
+        VERTEX_COPY_CASE((CopyTo32FVertexData<GLint, 4, 4, true>), (ReferenceTo32F<GLint, 4, 4, true>), 16, 16),
+        VERTEX_COPY_CASE((CopyTo32FVertexData<GLuint, 1, 1, true>), (ReferenceTo32F<GLuint, 1, 1, true>), 4, 4),
+        VERTEX_COPY_CASE((CopyTo32FVertexData<GLuint, 2, 2, true>), (ReferenceTo32F<GLuint, 2, 2, true>), 8, 8),
+        VERTEX_COPY_CASE((CopyTo32FVertexData<GLuint, 3, 3, true>), (ReferenceTo32F<GLuint, 3, 3, true>), 12, 12),
+        VERTEX_COPY_CASE((CopyTo32FVertexData<GLuint, 4, 4, true>), (ReferenceTo32F<GLuint, 4, 4, true>), 16, 16),
+        VERTEX_COPY_CASE((Copy32FixedTo32FVertexData<1, 1>), (ReferenceFixedTo32F<1, 1>), 4, 4),
+        VERTEX_COPY_CASE((Copy32FixedTo32FVertexData<1, 2>), (ReferenceFixedTo32F<1, 2>), 4, 8),
+        VERTEX_COPY_CASE((Copy32FixedTo32FVertexData<2, 2>), (ReferenceFixedTo32F<2, 2>), 8, 8),
+        VERTEX_COPY_CASE((Copy32FixedTo32FVertexData<3, 3>), (ReferenceFixedTo32F<3, 3>), 12, 12),
+        VERTEX_COPY_CASE((Copy32FixedTo32FVertexData<4, 4>), (ReferenceFixedTo32F<4, 4>), 16, 16),
+        VERTEX_COPY_CASE((Copy8SintTo16SintVertexData<1, 2>), (Reference8To16<1, 2, false>), 1, 4),
+        VERTEX_COPY_CASE((Copy8SintTo16SintVertexData<2, 2>), (Reference8To16<2, 2, false>), 2, 4),
+        VERTEX_COPY_CASE((Copy8SintTo16SintVertexData<3, 4>), (Reference8To16<3, 4, false>), 3, 8),
+        VERTEX_COPY_CASE((Copy8SintTo16SintVertexData<4, 4>), (Reference8To16<4, 4, false>), 4, 8),
+        VERTEX_COPY_CASE((Copy8SnormTo16SnormVertexData<1, 2>), (Reference8To16<1, 2, true>), 1, 4),
+        VERTEX_COPY_CASE((Copy8SnormTo16SnormVertexData<2, 2>), (Reference8To16<2, 2, true>), 2, 4),
+        VERTEX_COPY_CASE((Copy8SnormTo16SnormVertexData<3, 4>), (Reference8To16<3, 4, true>), 3, 8),
+        VERTEX_COPY_CASE((Copy8SnormTo16SnormVertexData<4, 4>), (Reference8To16<4, 4, true>), 4, 8),
+    };
+
+    CheckVertexCopies(copyCases, ArraySize(copyCases));
+}
+
+// formatutils9.cpp derives its conversions from these, which must still find their SSE2 versions
+struct DerivedNormalize : Normalize<GLshort> {};
+struct DerivedFixedToFloat : FixedToFloat<GLint, 16> {};
+
+// The D3D9 conversions to float that have SSE2 versions
+TEST(CopyVertexTest, D3D9Conversions)
+{
+    const VertexCopyCase copyCases[] =
+    {
+        VERTEX_COPY_CASE((VertexDataConverter<GLbyte, NoWiden<1>, Normalize<GLbyte> >::convertArray), (ReferenceTo32F<GLbyte, 1, 1, true>), 1, 4),
+        VERTEX_COPY_CASE((VertexDataConverter<GLbyte, NoWiden<2>, Normalize<GLbyte> >::convertArray), (ReferenceTo32F<GLbyte, 2, 2, true>), 2, 8),
+        VERTEX_COPY_CASE((VertexDataConverter<GLbyte, NoWiden<3>, Normalize<GLbyte> >::convertArray), (ReferenceTo32F<GLbyte, 3, 3, true>), 3, 12),
+        VERTEX_COPY_CASE((VertexDataConverter<GLbyte, NoWiden<4>, Normalize<GLbyte> >::convertArray), (ReferenceTo32F<GLbyte, 4, 4, true>), 4, 16),
+        VERTEX_COPY_CASE((VertexDataConverter<GLubyte, NoWiden<3>, Normalize<GLubyte> >::convertArray), (ReferenceTo32F<GLubyte, 3, 3, true>), 3, 12),
+        VERTEX_COPY_CASE((VertexDataConverter<GLubyte, NoWiden<4>, Normalize<GLubyte> >::convertArray), (ReferenceTo32F<GLubyte, 4, 4, true>), 4, 16),
+        VERTEX_COPY_CASE((VertexDataConverter<GLshort, NoWiden<2>, DerivedNormalize>::convertArray), (ReferenceTo32F<GLshort, 2, 2, true>), 4, 8),
+        VERTEX_COPY_CASE((VertexDataConverter<GLshort, NoWiden<3>, DerivedNormalize>::convertArray), (ReferenceTo32F<GLshort, 3, 3, true>), 6, 12),
+        VERTEX_COPY_CASE((VertexDataConverter<GLushort, NoWiden<4>, Normalize<GLushort> >::convertArray), (ReferenceTo32F<GLushort, 4, 4, true>), 8, 16),
+        VERTEX_COPY_CASE((VertexDataConverter<GLbyte, NoWiden<4>, Cast<GLbyte, float> >::convertArray), (ReferenceTo32F<GLbyte, 4, 4, false>), 4, 16),
+        VERTEX_COPY_CASE((VertexDataConverter<GLubyte, NoWiden<2>, Cast<GLubyte, float> >::convertArray), (ReferenceTo32F<GLubyte, 2, 2, false>), 2, 8),
+        VERTEX_COPY_CASE((VertexDataConverter<GLushort, NoWiden<3>, Cast<GLushort, float> >::convertArray), (ReferenceTo32F<GLushort, 3, 3, false>), 6, 12),
+        VERTEX_COPY_CASE((VertexDataConverter<GLint, NoWiden<1>, DerivedFixedToFloat>::convertArray), (ReferenceFixedTo32F<1, 1>), 4, 4),
+        VERTEX_COPY_CASE((VertexDataConverter<GLint, NoWiden<4>, DerivedFixedToFloat>::convertArray), (ReferenceFixedTo32F<4, 4>), 16, 16),
+    };
+
+    CheckVertexCopies(copyCases, ArraySize(copyCases));
+}
+
+#undef VERTEX_COPY_CASE
+
+// Checks which layouts the SSE2 conversions take on, so that the common ones don't silently fall
+// back to the scalar loops
+TEST(CopyVertexTest, SSE2Layouts)
+{
+    if (!gl::supportsSSE2())
+    {
+        return;
+    }
+
+    std::vector<uint8_t> input(64 * 20);
+    std::vector<float> output(64 * 4);
+
+    // Tightly packed vertices convert up to the last whole group of four components
+    EXPECT_EQ(64u, CopyIntegerTo32FVertexData_SSE2(2, false, true, 4, input.data(), 8, 64, output.data()));
+    EXPECT_EQ(62u, CopyIntegerTo32FVertexData_SSE2(1, true, true, 3, input.data(), 3, 63, output.data()));
+
+    // Strided vertices of two and four components convert one vertex at a time
+    EXPECT_EQ(63u, Copy32FixedTo32FVertexData_SSE2(4, input.data(), 16 + 4, 63, output.data()));
+    EXPECT_EQ(63u, CopyIntegerTo32FVertexData_SSE2(4, true, true, 2, input.data(), 12, 63, output.data()));
+
+    // Strided vertices of three components leave out the last vertex, whose fourth component can't be read
+    EXPECT_EQ(62u, CopyIntegerTo32FVertexData_SSE2(2, true, true, 3, input.data(), 8, 63, output.data()));
+
+    // Strided single components are left to the scalar loops
+    EXPECT_EQ(0u, CopyIntegerTo32FVertexData_SSE2(4, true, true, 1, input.data(), 8, 63, output.data()));
+}
+
+}
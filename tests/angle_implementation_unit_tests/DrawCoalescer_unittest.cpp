@@ -0,0 +1,133 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "libANGLE/DrawCoalescer.h"
+
+#include <limits>
+#include <vector>
+
+using namespace gl;
+
+namespace
+{
+
+// Stands in for the renderer, recording the draws it is given
+class DrawCoalescerTest : public testing::Test
+{
+  protected:
+    void draw(GLint first, GLsizei count)
+    {
+        CoalescedDraw emitted;
+        if (mCoalescer.add(first, count, &emitted))
+        {
+            mDraws.push_back(emitted);
+        }
+    }
+
+    void flush()
+    {
+        CoalescedDraw emitted;
+        if (mCoalescer.flush(&emitted))
+        {
+            mDraws.push_back(emitted);
+        }
+    }
+
+    void expectDraw(size_t index, GLint first, GLsizei count)
+    {
+        ASSERT_LT(index, mDraws.size());
+        EXPECT_EQ(first, mDraws[index].first);
+        EXPECT_EQ(count, mDraws[index].count);
+    }
+
+    DrawCoalescer mCoalescer;
+    std::vector<CoalescedDraw> mDraws;
+};
+
+TEST_F(DrawCoalescerTest, CoalescesOnlyTriangleLists)
+{
+    EXPECT_TRUE(DrawCoalescer::CanCoalesce(GL_TRIANGLES, 0));
+    EXPECT_FALSE(DrawCoalescer::CanCoalesce(GL_TRIANGLES, 2));
+    EXPECT_FALSE(DrawCoalescer::CanCoalesce(GL_TRIANGLE_STRIP, 0));
+    EXPECT_FALSE(DrawCoalescer::CanCoalesce(GL_TRIANGLE_FAN, 0));
+    EXPECT_FALSE(DrawCoalescer::CanCoalesce(GL_POINTS, 0));
+}
+
+TEST_F(DrawCoalescerTest, MergesAdjacentDraws)
+{
+    draw(0, 6);
+    draw(6, 3);
+    draw(9, 30);
+    EXPECT_TRUE(mDraws.empty());
+    EXPECT_TRUE(mCoalescer.hasPendingDraw());
+
+    flush();
+    ASSERT_EQ(1u, mDraws.size());
+    expectDraw(0, 0, 39);
+    EXPECT_FALSE(mCoalescer.hasPendingDraw());
+
+    EXPECT_EQ(2u, mCoalescer.getStats().mergedDraws);
+    EXPECT_EQ(1u, mCoalescer.getStats().emittedDraws);
+}
+
+TEST_F(DrawCoalescerTest, EmitsDrawsThatDontContinueTheRange)
+{
+    draw(0, 6);
+    draw(12, 6);  // Gap
+    draw(6, 6);   // Behind
+    draw(12, 6);
+    flush();
+
+    ASSERT_EQ(3u, mDraws.size());
+    expectDraw(0, 0, 6);
+    expectDraw(1, 12, 6);
+    expectDraw(2, 6, 12);
+
+    EXPECT_EQ(1u, mCoalescer.getStats().mergedDraws);
+    EXPECT_EQ(3u, mCoalescer.getStats().emittedDraws);
+}
+
+TEST_F(DrawCoalescerTest, KeepsPartialTrianglesApart)
+{
+    // The last vertex of the first draw is ignored, and must not become part of a triangle
+    draw(0, 4);
+    draw(4, 3);
+    flush();
+
+    ASSERT_EQ(2u, mDraws.size());
+    expectDraw(0, 0, 4);
+    expectDraw(1, 4, 3);
+}
+
+TEST_F(DrawCoalescerTest, KeepsCountsInRange)
+{
+    const GLsizei maxCount = std::numeric_limits<GLsizei>::max();
+    draw(0, maxCount - 1);
+    draw(maxCount - 1, 6);
+    flush();
+
+    ASSERT_EQ(2u, mDraws.size());
+    expectDraw(0, 0, maxCount - 1);
+    expectDraw(1, maxCount - 1, 6);
+}
+
+TEST_F(DrawCoalescerTest, FlushesOnlyOnce)
+{
+    flush();
+    EXPECT_TRUE(mDraws.empty());
+
+    draw(3, 3);
+    flush();
+    flush();
+    ASSERT_EQ(1u, mDraws.size());
+    expectDraw(0, 3, 3);
+    EXPECT_EQ(1u, mCoalescer.getStats().emittedDraws);
+}
+
+}
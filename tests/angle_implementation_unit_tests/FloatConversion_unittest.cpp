@@ -0,0 +1,119 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "common/mathutil.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+
+// Float bit patterns covering every exponent with a spread of mantissas, plus the special values.
+std::vector<float> GetTestFloats()
+{
+    std::vector<float> values;
+    for (unsigned int bits = 0; bits < 0x7FFFFFFF - 4093; bits += 4093)
+    {
+        values.push_back(gl::bitCast<float>(bits));
+        values.push_back(gl::bitCast<float>(bits | 0x80000000));
+    }
+
+    const unsigned int specials[] =
+    {
+        0x00000000, 0x80000000, 0x3F800000, 0x7F800000, 0xFF800000, 0x7FC00000, 0xFFC00000, 0x7F800001,
+        0x38800000, 0x387FFFFF, 0x33000000, 0x33000001, 0x477E0000, 0x477E0001, 0x477C0000, 0x477C0001,
+        0x47FFEFFF, 0x47FFF000, 0x00000001, 0x007FFFFF,
+    };
+    for (size_t i = 0; i < ArraySize(specials); i++)
+    {
+        values.push_back(gl::bitCast<float>(specials[i]));
+    }
+
+    // Pad so that the count is not a multiple of the vector width
+    values.push_back(1.0f);
+    return values;
+}
+
+TEST(FloatConversionTest, Float32ToFloat16Array)
+{
+    std::vector<float> input = GetTestFloats();
+    std::vector<unsigned short> output(input.size());
+    gl::float32ToFloat16Array(input.data(), output.data(), input.size());
+
+    for (size_t i = 0; i < input.size(); i++)
+    {
+        ASSERT_EQ(gl::float32ToFloat16(input[i]), output[i]) << "input bits " << gl::bitCast<unsigned int>(input[i]);
+    }
+}
+
+TEST(FloatConversionTest, Float16ToFloat32Array)
+{
+    std::vector<unsigned short> input(0x10001);
+    for (size_t i = 0; i < input.size(); i++)
+    {
+        input[i] = static_cast<unsigned short>(i);
+    }
+
+    std::vector<float> output(input.size());
+    gl::float16ToFloat32Array(input.data(), output.data(), input.size());
+
+    for (size_t i = 0; i < input.size(); i++)
+    {
+        ASSERT_EQ(gl::bitCast<unsigned int>(gl::float16ToFloat32(input[i])), gl::bitCast<unsigned int>(output[i]))
+            << "input " << input[i];
+    }
+}
+
+TEST(FloatConversionTest, RGBFloatsToR11G11B10Array)
+{
+    std::vector<float> input = GetTestFloats();
+    input.resize(input.size() - (input.size() % 3) + 3, 0.5f);
+    size_t pixelCount = input.size() / 3;
+
+    // Rotate the values through every channel so each one is also converted to float10
+    for (size_t rotation = 0; rotation < 3; rotation++)
+    {
+        std::rotate(input.begin(), input.begin() + 1, input.end());
+
+        std::vector<unsigned int> output(pixelCount);
+        gl::convertRGBFloatsToR11G11B10Array(input.data(), output.data(), pixelCount);
+
+        for (size_t i = 0; i < pixelCount; i++)
+        {
+            unsigned int expected = (gl::float32ToFloat11(input[i * 3 + 0]) <<  0) |
+                                    (gl::float32ToFloat11(input[i * 3 + 1]) << 11) |
+                                    (gl::float32ToFloat10(input[i * 3 + 2]) << 22);
+            ASSERT_EQ(expected, output[i]) << "pixel " << i;
+        }
+    }
+}
+
+TEST(FloatConversionTest, RGBFloatsTo999E5Array)
+{
+    const float input[] =
+    {
+        0.0f, 0.0f, 0.0f,
+        1.0f, 0.5f, 0.25f,
+        65408.0f, 1.0e-6f, 3.0f,
+        -1.0f, 100000.0f, 0.125f,
+        7.5f, 7.5f, 7.5f,
+    };
+    const size_t pixelCount = ArraySize(input) / 3;
+
+    std::vector<unsigned int> output(pixelCount);
+    gl::convertRGBFloatsTo999E5Array(input, output.data(), pixelCount);
+
+    for (size_t i = 0; i < pixelCount; i++)
+    {
+        EXPECT_EQ(gl::convertRGBFloatsTo999E5(input[i * 3 + 0], input[i * 3 + 1], input[i * 3 + 2]), output[i]);
+    }
+}
+
+}
@@ -0,0 +1,179 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "libANGLE/renderer/d3d/generatemip.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+using namespace rx;
+
+namespace
+{
+
+// Float formats get finite values, since which NaN payload survives an average depends on how the
+// compiler orders the operands.
+template <typename T>
+struct HasFloatChannels
+{
+    static const bool value = false;
+};
+
+template <> struct HasFloatChannels<R32F>          { static const bool value = true; };
+template <> struct HasFloatChannels<R32G32F>       { static const bool value = true; };
+template <> struct HasFloatChannels<R32G32B32A32F> { static const bool value = true; };
+
+// Storage for a full mip chain, with padded rows so that pitches differ from the packed size.
+template <typename T>
+class MipChainStorage
+{
+  public:
+    MipChainStorage(size_t width, size_t height, size_t depth)
+    {
+        while (true)
+        {
+            MipChainLevel level;
+            level.width = width;
+            level.height = height;
+            level.depth = depth;
+            level.rowPitch = width * sizeof(T) + 4 * sizeof(T);
+            level.depthPitch = level.rowPitch * height;
+            level.data = NULL;
+            mLevels.push_back(level);
+            mData.push_back(std::vector<uint8_t>(level.depthPitch * depth, 0));
+
+            if (width == 1 && height == 1 && depth == 1)
+            {
+                break;
+            }
+            width = std::max<size_t>(1, width / 2);
+            height = std::max<size_t>(1, height / 2);
+            depth = std::max<size_t>(1, depth / 2);
+        }
+
+        for (size_t i = 0; i < mLevels.size(); i++)
+        {
+            mLevels[i].data = mData[i].data();
+        }
+    }
+
+    void randomize()
+    {
+        if (HasFloatChannels<T>::value)
+        {
+            float *values = reinterpret_cast<float*>(mData[0].data());
+            for (size_t i = 0; i < mData[0].size() / sizeof(float); i++)
+            {
+                values[i] = static_cast<float>(rand() % 20001 - 10000) / 7.0f;
+            }
+        }
+        else
+        {
+            for (size_t i = 0; i < mData[0].size(); i++)
+            {
+                mData[0][i] = static_cast<uint8_t>(rand());
+            }
+        }
+    }
+
+    // Reference generation: one level at a time, with a pixel by pixel 2D filter
+    void generateReference(const MipChainStorage &source)
+    {
+        mData[0] = source.mData[0];
+
+        for (size_t i = 1; i < mLevels.size(); i++)
+        {
+            const MipChainLevel &src = mLevels[i - 1];
+            const MipChainLevel &dst = mLevels[i];
+
+            if (src.width == 1 || src.height == 1 || src.depth > 1)
+            {
+                GenerateMip<T>(src.width, src.height, src.depth, src.data, src.rowPitch, src.depthPitch,
+                               dst.data, dst.rowPitch, dst.depthPitch);
+                continue;
+            }
+
+            for (size_t y = 0; y < dst.height; y++)
+            {
+                for (size_t x = 0; x < dst.width; x++)
+                {
+                    const T *row0 = reinterpret_cast<const T*>(src.data + y * 2 * src.rowPitch);
+                    const T *row1 = reinterpret_cast<const T*>(src.data + (y * 2 + 1) * src.rowPitch);
+                    T *out = reinterpret_cast<T*>(dst.data + y * dst.rowPitch);
+
+                    T tmp0, tmp1;
+                    T::average(&tmp0, &row0[x * 2], &row1[x * 2]);
+                    T::average(&tmp1, &row0[x * 2 + 1], &row1[x * 2 + 1]);
+                    T::average(&out[x], &tmp0, &tmp1);
+                }
+            }
+        }
+    }
+
+    const std::vector<MipChainLevel> &levels() const { return mLevels; }
+    const std::vector<uint8_t> &levelData(size_t level) const { return mData[level]; }
+
+  private:
+    std::vector<MipChainLevel> mLevels;
+    std::vector<std::vector<uint8_t> > mData;
+};
+
+template <typename T>
+void CheckMipChain(size_t width, size_t height, size_t depth)
+{
+    MipChainStorage<T> chain(width, height, depth);
+    chain.randomize();
+    GenerateMipChain(GenerateMip<T>, chain.levels().data(), chain.levels().size());
+
+    MipChainStorage<T> reference(width, height, depth);
+    reference.generateReference(chain);
+
+    for (size_t level = 1; level < chain.levels().size(); level++)
+    {
+        const MipChainLevel &levelInfo = chain.levels()[level];
+        for (size_t z = 0; z < levelInfo.depth; z++)
+        {
+            for (size_t y = 0; y < levelInfo.height; y++)
+            {
+                size_t offset = z * levelInfo.depthPitch + y * levelInfo.rowPitch;
+                const uint8_t *actual = chain.levelData(level).data() + offset;
+                const uint8_t *expected = reference.levelData(level).data() + offset;
+                ASSERT_TRUE(std::equal(expected, expected + levelInfo.width * sizeof(T), actual))
+                    << width << "x" << height << "x" << depth << " level " << level << " row " << y << " slice " << z;
+            }
+        }
+    }
+}
+
+template <typename T>
+class GenerateMipTest : public testing::Test
+{
+};
+
+typedef testing::Types<L8, A8L8, R8G8, R8G8B8A8, B8G8R8X8, R32F, R32G32F, R32G32B32A32F, R16G16B16A16F, R5G6B5> MipFormats;
+TYPED_TEST_CASE(GenerateMipTest, MipFormats);
+
+TYPED_TEST(GenerateMipTest, MatchesReference)
+{
+    srand(0);
+
+    CheckMipChain<TypeParam>(1, 1, 1);
+    CheckMipChain<TypeParam>(2, 2, 1);
+    CheckMipChain<TypeParam>(1, 37, 1);
+    CheckMipChain<TypeParam>(61, 1, 1);
+    CheckMipChain<TypeParam>(64, 64, 1);
+    CheckMipChain<TypeParam>(67, 33, 1);
+    CheckMipChain<TypeParam>(17, 9, 5);
+
+    // Large enough to be split across threads
+    CheckMipChain<TypeParam>(1027, 515, 1);
+}
+
+}
@@ -0,0 +1,82 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "libANGLE/renderer/d3d/ImageLoadTask.h"
+#include "libANGLE/renderer/d3d/loadimage.h"
+
+#include <cstdlib>
+#include <vector>
+
+using namespace rx;
+
+namespace
+{
+
+// Converts an RGB8 image with padded rows both directly and through an ImageLoadTask, and expects
+// the same output. The input is overwritten before waiting, as a client may do once the upload
+// call has returned.
+void CheckAsyncLoad(size_t width, size_t height, size_t depth)
+{
+    const size_t inputRowBytes = width * 3;
+    const size_t inputRowPitch = inputRowBytes + 5;
+    const size_t inputDepthPitch = inputRowPitch * height + 7;
+    const size_t outputRowPitch = width * 4 + 12;
+    const size_t outputDepthPitch = outputRowPitch * height;
+
+    // Only as much input as the load reads, so that reading the padding after the last row is caught
+    std::vector<uint8_t> input((depth - 1) * inputDepthPitch + (height - 1) * inputRowPitch + inputRowBytes);
+    for (size_t i = 0; i < input.size(); i++)
+    {
+        input[i] = static_cast<uint8_t>(rand());
+    }
+
+    std::vector<uint8_t> expected(outputDepthPitch * depth, 0);
+    LoadRGB8ToBGRX8(width, height, depth, input.data(), inputRowPitch, inputDepthPitch,
+                    expected.data(), outputRowPitch, outputDepthPitch);
+
+    std::vector<uint8_t> actual(outputDepthPitch * depth, 0);
+    ScratchMemoryPool pool(0);
+    ImageLoadTask task;
+    task.start(&pool, LoadRGB8ToBGRX8, width, height, depth, input.data(), inputRowPitch, inputDepthPitch, inputRowBytes,
+               actual.data(), outputRowPitch, outputDepthPitch);
+
+    std::fill(input.begin(), input.end(), static_cast<uint8_t>(0));
+    task.wait();
+    EXPECT_FALSE(task.isPending());
+
+    EXPECT_EQ(expected, actual) << width << "x" << height << "x" << depth;
+}
+
+TEST(ImageLoadTaskTest, MatchesSynchronousLoad)
+{
+    srand(0);
+
+    CheckAsyncLoad(1, 1, 1);
+    CheckAsyncLoad(3, 2, 1);
+    CheckAsyncLoad(61, 37, 1);
+    CheckAsyncLoad(512, 512, 1);
+    CheckAsyncLoad(17, 3, 5);
+    CheckAsyncLoad(64, 1, 9);
+}
+
+TEST(ImageLoadTaskTest, EmptyLoadIsNotPending)
+{
+    ScratchMemoryPool pool(0);
+    ImageLoadTask task;
+    task.start(&pool, LoadRGB8ToBGRX8, 0, 4, 1, NULL, 0, 0, 0, NULL, 0, 0);
+    EXPECT_FALSE(task.isPending());
+}
+
+TEST(ImageLoadTaskTest, SmallLoadsRunSynchronously)
+{
+    EXPECT_FALSE(ImageLoadTask::ShouldRunAsync(0));
+    EXPECT_FALSE(ImageLoadTask::ShouldRunAsync(4096));
+}
+
+}
@@ -0,0 +1,287 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "libANGLE/renderer/IndexRangeCache.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+using namespace rx;
+
+namespace
+{
+
+TEST(IndexRangeCacheTest, FindAddedRange)
+{
+    IndexRangeCache cache;
+    cache.addRange(GL_UNSIGNED_SHORT, 16, 6, false, RangeUI(2, 9), 16);
+
+    RangeUI range;
+    unsigned int streamOffset = 0;
+    EXPECT_TRUE(cache.findRange(GL_UNSIGNED_SHORT, 16, 6, false, &range, &streamOffset));
+    EXPECT_EQ(2u, range.start);
+    EXPECT_EQ(9u, range.end);
+    EXPECT_EQ(16u, streamOffset);
+
+    EXPECT_FALSE(cache.findRange(GL_UNSIGNED_BYTE, 16, 6, false, NULL, NULL));
+    EXPECT_FALSE(cache.findRange(GL_UNSIGNED_SHORT, 16, 7, false, NULL, NULL));
+}
+
+TEST(IndexRangeCacheTest, ReplaceRange)
+{
+    IndexRangeCache cache;
+    cache.addRange(GL_UNSIGNED_INT, 0, 4, false, RangeUI(0, 3), 0);
+    cache.addRange(GL_UNSIGNED_INT, 0, 4, false, RangeUI(5, 7), 64);
+    EXPECT_EQ(1u, cache.size());
+
+    // The old stream offset must not be tracked anymore.
+    cache.invalidateRange(0, 16);
+    EXPECT_TRUE(cache.findRange(GL_UNSIGNED_INT, 0, 4, false, NULL, NULL));
+
+    cache.invalidateRange(64, 1);
+    EXPECT_FALSE(cache.findRange(GL_UNSIGNED_INT, 0, 4, false, NULL, NULL));
+}
+
+TEST(IndexRangeCacheTest, InvalidateOnlyOverlapping)
+{
+    IndexRangeCache cache;
+
+    // Bytes [0, 8), [8, 16) and [16, 24).
+    cache.addRange(GL_UNSIGNED_SHORT, 0, 4, false, RangeUI(0, 1), 0);
+    cache.addRange(GL_UNSIGNED_SHORT, 8, 4, false, RangeUI(0, 1), 8);
+    cache.addRange(GL_UNSIGNED_SHORT, 16, 4, false, RangeUI(0, 1), 16);
+
+    cache.invalidateRange(8, 8);
+    EXPECT_TRUE(cache.findRange(GL_UNSIGNED_SHORT, 0, 4, false, NULL, NULL));
+    EXPECT_FALSE(cache.findRange(GL_UNSIGNED_SHORT, 8, 4, false, NULL, NULL));
+    EXPECT_TRUE(cache.findRange(GL_UNSIGNED_SHORT, 16, 4, false, NULL, NULL));
+
+    cache.invalidateRange(7, 10);
+    EXPECT_EQ(0u, cache.size());
+}
+
+TEST(IndexRangeCacheTest, EvictsLeastRecentlyUsed)
+{
+    IndexRangeCache cache(2);
+    cache.addRange(GL_UNSIGNED_BYTE, 0, 1, false, RangeUI(0, 0), 0);
+    cache.addRange(GL_UNSIGNED_BYTE, 1, 1, false, RangeUI(1, 1), 1);
+
+    // Using the first range makes the second one the eviction candidate.
+    EXPECT_TRUE(cache.findRange(GL_UNSIGNED_BYTE, 0, 1, false, NULL, NULL));
+    cache.addRange(GL_UNSIGNED_BYTE, 2, 1, false, RangeUI(2, 2), 2);
+
+    EXPECT_EQ(2u, cache.size());
+    EXPECT_TRUE(cache.findRange(GL_UNSIGNED_BYTE, 0, 1, false, NULL, NULL));
+    EXPECT_FALSE(cache.findRange(GL_UNSIGNED_BYTE, 1, 1, false, NULL, NULL));
+    EXPECT_TRUE(cache.findRange(GL_UNSIGNED_BYTE, 2, 1, false, NULL, NULL));
+}
+
+// Compares the cache against a brute force list of live ranges under random adds and updates.
+TEST(IndexRangeCacheTest, RandomizedStress)
+{
+    struct Reference
+    {
+        unsigned int offset;
+        GLsizei count;
+        bool live;
+    };
+
+    const unsigned int bufferSize = 4096;
+    const size_t maxEntries = 256;
+
+    IndexRangeCache cache(maxEntries);
+    std::vector<Reference> reference;
+
+    srand(1);
+    for (int iteration = 0; iteration < 20000; iteration++)
+    {
+        if (rand() % 3 != 0)
+        {
+            unsigned int offset = (rand() % (bufferSize / 2)) * 2;
+            GLsizei count = 1 + rand() % 64;
+            if (offset + count * 2 > bufferSize)
+            {
+                continue;
+            }
+
+            cache.addRange(GL_UNSIGNED_SHORT, offset, count, false, RangeUI(offset, offset + count), offset);
+
+            Reference ref = { offset, count, true };
+            reference.push_back(ref);
+        }
+        else
+        {
+            unsigned int offset = rand() % bufferSize;
+            unsigned int size = 1 + rand() % 32;
+            cache.invalidateRange(offset, size);
+
+            for (size_t i = 0; i < reference.size(); i++)
+            {
+                unsigned int start = reference[i].offset;
+                unsigned int end = start + reference[i].count * 2;
+                if (start < offset + size && offset < end)
+                {
+                    reference[i].live = false;
+                }
+            }
+        }
+
+        ASSERT_LE(cache.size(), maxEntries);
+    }
+
+    // A range that was invalidated after its last add must never be found. Ranges may be missing
+    // because of eviction, but any range found must hold the values it was added with.
+    for (size_t i = 0; i < reference.size(); i++)
+    {
+        const Reference &ref = reference[i];
+
+        bool laterAdd = false;
+        for (size_t j = i + 1; j < reference.size(); j++)
+        {
+            if (reference[j].offset == ref.offset && reference[j].count == ref.count)
+            {
+                laterAdd = true;
+                break;
+            }
+        }
+        if (laterAdd)
+        {
+            continue;
+        }
+
+        RangeUI range;
+        unsigned int streamOffset = 0;
+        bool found = cache.findRange(GL_UNSIGNED_SHORT, ref.offset, ref.count, false, &range, &streamOffset);
+        if (!ref.live)
+        {
+            EXPECT_FALSE(found);
+        }
+        else if (found)
+        {
+            EXPECT_EQ(ref.offset, range.start);
+            EXPECT_EQ(ref.offset + ref.count, range.end);
+            EXPECT_EQ(ref.offset, streamOffset);
+        }
+    }
+}
+
+// Checks summarized range queries against a full scan while the buffer is patched.
+TEST(IndexRangeCacheTest, BufferRangeMatchesScan)
+{
+    const size_t indexCount = 20000;
+    std::vector<GLushort> indices(indexCount);
+    for (size_t i = 0; i < indexCount; i++)
+    {
+        indices[i] = static_cast<GLushort>(rand());
+    }
+
+    const uint8_t *data = reinterpret_cast<const uint8_t*>(&indices[0]);
+    size_t dataSize = indexCount * sizeof(GLushort);
+
+    IndexRangeCache cache;
+
+    srand(2);
+    for (int iteration = 0; iteration < 500; iteration++)
+    {
+        if (iteration % 5 == 0)
+        {
+            size_t first = rand() % indexCount;
+            size_t count = std::min<size_t>(1 + rand() % 300, indexCount - first);
+            for (size_t i = first; i < first + count; i++)
+            {
+                indices[i] = static_cast<GLushort>(rand());
+            }
+            cache.invalidateRange(static_cast<unsigned int>(first * sizeof(GLushort)),
+                                  static_cast<unsigned int>(count * sizeof(GLushort)));
+        }
+
+        unsigned int first = rand() % indexCount;
+        GLsizei count = static_cast<GLsizei>(1 + rand() % (indexCount - first));
+        unsigned int offset = first * sizeof(GLushort);
+
+        RangeUI expected = IndexRangeCache::ComputeRange(GL_UNSIGNED_SHORT, data + offset, count, false);
+        RangeUI actual = cache.computeBufferRange(GL_UNSIGNED_SHORT, data, dataSize, offset, count, false);
+        ASSERT_EQ(expected.start, actual.start);
+        ASSERT_EQ(expected.end, actual.end);
+    }
+}
+
+TEST(IndexRangeCacheTest, BufferRangeWithAlternatingTypes)
+{
+    const size_t byteCount = 40000;
+    std::vector<GLuint> storage(byteCount / sizeof(GLuint));
+    uint8_t *data = reinterpret_cast<uint8_t*>(&storage[0]);
+    for (size_t i = 0; i < byteCount; i++)
+    {
+        data[i] = static_cast<uint8_t>(rand());
+    }
+
+    const GLenum types[] = { GL_UNSIGNED_BYTE, GL_UNSIGNED_SHORT, GL_UNSIGNED_INT };
+
+    IndexRangeCache cache;
+
+    srand(3);
+    for (int iteration = 0; iteration < 300; iteration++)
+    {
+        // Writes must reach the summary of every type, not just the last one used
+        if (iteration % 7 == 0)
+        {
+            size_t first = rand() % byteCount;
+            size_t count = std::min<size_t>(1 + rand() % 500, byteCount - first);
+            for (size_t i = first; i < first + count; i++)
+            {
+                data[i] = static_cast<uint8_t>(rand());
+            }
+            cache.invalidateRange(static_cast<unsigned int>(first), static_cast<unsigned int>(count));
+        }
+
+        GLenum type = types[iteration % 3];
+        unsigned int typeBytes = (type == GL_UNSIGNED_BYTE) ? 1 : ((type == GL_UNSIGNED_SHORT) ? 2 : 4);
+        unsigned int indexCount = byteCount / typeBytes;
+
+        unsigned int first = rand() % indexCount;
+        GLsizei count = static_cast<GLsizei>(1 + rand() % (indexCount - first));
+        unsigned int offset = first * typeBytes;
+
+        RangeUI expected = IndexRangeCache::ComputeRange(type, data + offset, count, false);
+        RangeUI actual = cache.computeBufferRange(type, data, byteCount, offset, count, false);
+        ASSERT_EQ(expected.start, actual.start);
+        ASSERT_EQ(expected.end, actual.end);
+    }
+}
+
+TEST(IndexRangeCacheTest, RestartIndexExcludedFromRange)
+{
+    const GLushort indices[] = { 4, 0xFFFF, 2, 9, 0xFFFF };
+
+    RangeUI range = IndexRangeCache::ComputeRange(GL_UNSIGNED_SHORT, indices, 5, true);
+    EXPECT_EQ(2u, range.start);
+    EXPECT_EQ(9u, range.end);
+
+    range = IndexRangeCache::ComputeRange(GL_UNSIGNED_SHORT, indices, 5, false);
+    EXPECT_EQ(2u, range.start);
+    EXPECT_EQ(0xFFFFu, range.end);
+
+    const GLubyte restartOnly[] = { 0xFF, 0xFF };
+    range = IndexRangeCache::ComputeRange(GL_UNSIGNED_BYTE, restartOnly, 2, true);
+    EXPECT_EQ(0u, range.start);
+    EXPECT_EQ(0u, range.end);
+}
+
+TEST(IndexRangeCacheTest, RestartStateIsPartOfKey)
+{
+    IndexRangeCache cache;
+    cache.addRange(GL_UNSIGNED_INT, 0, 4, true, RangeUI(1, 3), 0);
+
+    EXPECT_TRUE(cache.findRange(GL_UNSIGNED_INT, 0, 4, true, NULL, NULL));
+    EXPECT_FALSE(cache.findRange(GL_UNSIGNED_INT, 0, 4, false, NULL, NULL));
+}
+
+}
@@ -0,0 +1,337 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "common/mathutil.h"
+#include "libANGLE/renderer/d3d/formatutilsD3D.h"
+#include "libANGLE/renderer/d3d/loadimage.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+using namespace rx;
+
+namespace
+{
+
+// Pixel indices shared by several blocks: (0, 0) uses index 0, (1, 0) index 1, (2, 0) index 2 and
+// (3, 0) index 3, every other pixel index 0.
+const uint8_t FirstRowIndices[4] = { 0x11, 0x00, 0x10, 0x10 };
+
+struct ExpectedPixel
+{
+    size_t x;
+    size_t y;
+    uint8_t rgba[4];
+};
+
+void CheckETCBlock(LoadImageFunction loadFunction, const uint8_t *block, const ExpectedPixel *expected, size_t expectedCount)
+{
+    uint8_t output[4 * 4 * 4];
+    loadFunction(4, 4, 1, block, 8, 8, output, 16, 64);
+
+    for (size_t i = 0; i < expectedCount; i++)
+    {
+        const uint8_t *pixel = output + expected[i].y * 16 + expected[i].x * 4;
+        for (size_t channel = 0; channel < 4; channel++)
+        {
+            EXPECT_EQ(expected[i].rgba[channel], pixel[channel]) << "pixel " << expected[i].x << ", " << expected[i].y
+                                                                 << " channel " << channel;
+        }
+    }
+}
+
+TEST(LoadImageETCTest, IndividualMode)
+{
+    // Red and green subblocks side by side, all pixels using the smallest positive modifier
+    const uint8_t block[8] = { 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+    const ExpectedPixel expected[] =
+    {
+        { 0, 0, { 255,   2, 2, 255 } },
+        { 1, 3, { 255,   2, 2, 255 } },
+        { 2, 0, {   2, 255, 2, 255 } },
+        { 3, 3, {   2, 255, 2, 255 } },
+    };
+    CheckETCBlock(LoadETC2RGB8ToRGBA8, block, expected, ArraySize(expected));
+}
+
+TEST(LoadImageETCTest, IndividualModeFlipped)
+{
+    // Subblocks stacked, the top one using table 7. (1, 0) selects -183 and (0, 3) selects +8.
+    const uint8_t block[8] = { 0xF0, 0x0F, 0x00, 0xE1, 0x00, 0x10, 0x00, 0x18 };
+    const ExpectedPixel expected[] =
+    {
+        { 0, 0, { 255,  47, 47, 255 } },
+        { 1, 0, {  72,   0,  0, 255 } },
+        { 3, 1, { 255,  47, 47, 255 } },
+        { 0, 2, {   2, 255,  2, 255 } },
+        { 0, 3, {   8, 255,  8, 255 } },
+    };
+    CheckETCBlock(LoadETC2RGB8ToRGBA8, block, expected, ArraySize(expected));
+}
+
+TEST(LoadImageETCTest, TMode)
+{
+    // Red overflows: colors (221, 0, 0) and (136, 136, 136) with a distance of 16
+    const uint8_t block[8] = { 0xF9, 0x00, 0x88, 0x87, FirstRowIndices[0], FirstRowIndices[1], FirstRowIndices[2], FirstRowIndices[3] };
+    const ExpectedPixel expected[] =
+    {
+        { 0, 0, { 221,   0,   0, 255 } },
+        { 1, 0, { 152, 152, 152, 255 } },
+        { 2, 0, { 136, 136, 136, 255 } },
+        { 3, 0, { 120, 120, 120, 255 } },
+        { 3, 3, { 221,   0,   0, 255 } },
+    };
+    CheckETCBlock(LoadETC2RGB8ToRGBA8, block, expected, ArraySize(expected));
+}
+
+TEST(LoadImageETCTest, HMode)
+{
+    // Green overflows: colors (136, 17, 170) and (68, 68, 68), distance index 5 with the ordering bit
+    const uint8_t block[8] = { 0x40, 0xF9, 0x22, 0x26, FirstRowIndices[0], FirstRowIndices[1], FirstRowIndices[2], FirstRowIndices[3] };
+    const ExpectedPixel expected[] =
+    {
+        { 0, 0, { 168,  49, 202, 255 } },
+        { 1, 0, { 104,   0, 138, 255 } },
+        { 2, 0, { 100, 100, 100, 255 } },
+        { 3, 0, {  36,  36,  36, 255 } },
+    };
+    CheckETCBlock(LoadETC2RGB8ToRGBA8, block, expected, ArraySize(expected));
+}
+
+TEST(LoadImageETCTest, PlanarMode)
+{
+    // Blue overflows: constant red and green, blue ramping from 0 to 255 horizontally
+    const uint8_t block[8] = { 0x40, 0x40, 0x04, 0x42, 0x41, 0xFC, 0x08, 0x00 };
+    const ExpectedPixel expected[] =
+    {
+        { 0, 0, { 130, 64,   0, 255 } },
+        { 1, 1, { 130, 64,  64, 255 } },
+        { 2, 2, { 130, 64, 128, 255 } },
+        { 3, 3, { 130, 64, 191, 255 } },
+    };
+    CheckETCBlock(LoadETC2RGB8ToRGBA8, block, expected, ArraySize(expected));
+}
+
+TEST(LoadImageETCTest, PunchthroughAlpha)
+{
+    // Differential mode without the opaque flag: index 0 keeps the base color, index 2 is transparent
+    const uint8_t differential[8] = { 0x80, 0x80, 0x80, 0x00, FirstRowIndices[0], FirstRowIndices[1], FirstRowIndices[2], FirstRowIndices[3] };
+    const ExpectedPixel differentialExpected[] =
+    {
+        { 0, 0, { 132, 132, 132, 255 } },
+        { 1, 0, { 140, 140, 140, 255 } },
+        { 2, 0, {   0,   0,   0,   0 } },
+        { 3, 0, { 124, 124, 124, 255 } },
+    };
+    CheckETCBlock(LoadETC2RGB8A1ToRGBA8, differential, differentialExpected, ArraySize(differentialExpected));
+
+    // The T mode block above without the opaque flag
+    const uint8_t tMode[8] = { 0xF9, 0x00, 0x88, 0x85, FirstRowIndices[0], FirstRowIndices[1], FirstRowIndices[2], FirstRowIndices[3] };
+    const ExpectedPixel tModeExpected[] =
+    {
+        { 0, 0, { 221,   0,   0, 255 } },
+        { 1, 0, { 152, 152, 152, 255 } },
+        { 2, 0, {   0,   0,   0,   0 } },
+        { 3, 0, { 120, 120, 120, 255 } },
+    };
+    CheckETCBlock(LoadETC2RGB8A1ToRGBA8, tMode, tModeExpected, ArraySize(tModeExpected));
+}
+
+// EAC payload with multiplier 3 and table 13, pixel i of the block (counted down the columns)
+// using index i % 8.
+const int EACTable13[8] = { -1, -2, -3, -10, 0, 1, 2, 9 };
+const uint8_t EACIndices[6] = { 0x05, 0x39, 0x77, 0x05, 0x39, 0x77 };
+
+TEST(LoadImageETCTest, EACAlpha)
+{
+    const uint8_t block[16] =
+    {
+        100, 0x3D, EACIndices[0], EACIndices[1], EACIndices[2], EACIndices[3], EACIndices[4], EACIndices[5],
+        0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    };
+
+    uint8_t output[4 * 4 * 4];
+    LoadETC2RGBA8ToRGBA8(4, 4, 1, block, 16, 16, output, 16, 64);
+
+    for (size_t y = 0; y < 4; y++)
+    {
+        for (size_t x = 0; x < 4; x++)
+        {
+            EXPECT_EQ(100 + EACTable13[(x * 4 + y) % 8] * 3, output[y * 16 + x * 4 + 3]) << x << ", " << y;
+            EXPECT_EQ((x < 2) ? 255 : 2, output[y * 16 + x * 4]) << x << ", " << y;
+        }
+    }
+}
+
+TEST(LoadImageETCTest, EACR11)
+{
+    // The second channel has a zero multiplier, which scales the modifiers down by 8
+    const uint8_t block[16] =
+    {
+        100, 0x3D, EACIndices[0], EACIndices[1], EACIndices[2], EACIndices[3], EACIndices[4], EACIndices[5],
+        255, 0x0D, EACIndices[0], EACIndices[1], EACIndices[2], EACIndices[3], EACIndices[4], EACIndices[5],
+    };
+
+    uint8_t red[16];
+    LoadEACR11ToR8(4, 4, 1, block, 8, 8, red, 4, 16);
+
+    uint8_t redGreen[16 * 2];
+    LoadEACRG11ToRG8(4, 4, 1, block, 16, 16, redGreen, 8, 32);
+
+    for (size_t y = 0; y < 4; y++)
+    {
+        for (size_t x = 0; x < 4; x++)
+        {
+            int modifier = EACTable13[(x * 4 + y) % 8];
+            int red11 = 100 * 8 + 4 + modifier * 3 * 8;
+            int green11 = std::min(255 * 8 + 4 + modifier, 2047);
+
+            EXPECT_EQ((red11 * 255 + 1023) / 2047, red[y * 4 + x]) << x << ", " << y;
+            EXPECT_EQ((red11 * 255 + 1023) / 2047, redGreen[(y * 4 + x) * 2]) << x << ", " << y;
+            EXPECT_EQ((green11 * 255 + 1023) / 2047, redGreen[(y * 4 + x) * 2 + 1]) << x << ", " << y;
+        }
+    }
+}
+
+int Snorm11ToSnorm16(int value)
+{
+    int magnitude = std::abs(value);
+    magnitude = (magnitude << 5) | (magnitude >> 5);
+    return (value < 0) ? -magnitude : magnitude;
+}
+
+TEST(LoadImageETCTest, EACSignedR11)
+{
+    // -100 as the base of the first channel, and -128, which is treated as -127, for the second
+    const uint8_t block[16] =
+    {
+        0x9C, 0x3D, EACIndices[0], EACIndices[1], EACIndices[2], EACIndices[3], EACIndices[4], EACIndices[5],
+        0x80, 0xFD, EACIndices[0], EACIndices[1], EACIndices[2], EACIndices[3], EACIndices[4], EACIndices[5],
+    };
+
+    int16_t red[16];
+    LoadEACR11SToR16(4, 4, 1, block, 8, 8, reinterpret_cast<uint8_t*>(red), 8, 32);
+
+    int16_t redGreen[16 * 2];
+    LoadEACRG11SToRG16(4, 4, 1, block, 16, 16, reinterpret_cast<uint8_t*>(redGreen), 16, 64);
+
+    for (size_t y = 0; y < 4; y++)
+    {
+        for (size_t x = 0; x < 4; x++)
+        {
+            int modifier = EACTable13[(x * 4 + y) % 8];
+            int red11 = std::max(-100 * 8 + modifier * 3 * 8, -1023);
+            int green11 = std::max(-127 * 8 + modifier * 15 * 8, -1023);
+
+            EXPECT_EQ(Snorm11ToSnorm16(red11), red[y * 4 + x]) << x << ", " << y;
+            EXPECT_EQ(Snorm11ToSnorm16(red11), redGreen[(y * 4 + x) * 2]) << x << ", " << y;
+            EXPECT_EQ(Snorm11ToSnorm16(green11), redGreen[(y * 4 + x) * 2 + 1]) << x << ", " << y;
+        }
+    }
+
+    // The extremes map to the full 16-bit range
+    const uint8_t extremes[8] = { 0x7F, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+    LoadEACR11SToR16(4, 4, 1, extremes, 8, 8, reinterpret_cast<uint8_t*>(red), 8, 32);
+    EXPECT_EQ(32767, red[0]);
+}
+
+struct ETCLoadFunction
+{
+    const char *name;
+    LoadImageFunction function;
+    size_t blockBytes;
+    size_t pixelBytes;
+};
+
+const ETCLoadFunction ETCLoadFunctions[] =
+{
+    { "ETC2RGB8ToRGBA8",   LoadETC2RGB8ToRGBA8,    8, 4 },
+    { "ETC2RGB8A1ToRGBA8", LoadETC2RGB8A1ToRGBA8,  8, 4 },
+    { "ETC2RGBA8ToRGBA8",  LoadETC2RGBA8ToRGBA8,  16, 4 },
+    { "EACR11ToR8",        LoadEACR11ToR8,         8, 1 },
+    { "EACR11SToR16",      LoadEACR11SToR16,       8, 2 },
+    { "EACRG11ToRG8",      LoadEACRG11ToRG8,      16, 2 },
+    { "EACRG11SToRG16",    LoadEACRG11SToRG16,    16, 4 },
+};
+
+// Decodes a whole image of random blocks and compares it with each block decoded on its own, which
+// checks the clipping of edge blocks, the pitches and the split of the rows between threads.
+void CompareWithSingleBlocks(const ETCLoadFunction &load, size_t width, size_t height, size_t depth)
+{
+    const size_t columns = (width + 3) / 4;
+    const size_t rows = (height + 3) / 4;
+    const size_t inputRowPitch = columns * load.blockBytes;
+    const size_t inputDepthPitch = inputRowPitch * rows;
+    const size_t outputRowPitch = width * load.pixelBytes + 12;
+    const size_t outputDepthPitch = outputRowPitch * height + 4;
+
+    std::vector<uint8_t> input(inputDepthPitch * depth);
+    for (size_t i = 0; i < input.size(); i++)
+    {
+        input[i] = static_cast<uint8_t>(rand());
+    }
+
+    std::vector<uint8_t> output(outputDepthPitch * depth, 0xCD);
+    load.function(width, height, depth, input.data(), inputRowPitch, inputDepthPitch,
+                  output.data(), outputRowPitch, outputDepthPitch);
+
+    for (size_t z = 0; z < depth; z++)
+    {
+        for (size_t row = 0; row < rows; row++)
+        {
+            for (size_t column = 0; column < columns; column++)
+            {
+                const uint8_t *block = input.data() + z * inputDepthPitch + row * inputRowPitch + column * load.blockBytes;
+
+                uint8_t pixels[16 * 4];
+                load.function(4, 4, 1, block, load.blockBytes, load.blockBytes, pixels, 4 * load.pixelBytes, 16 * load.pixelBytes);
+
+                for (size_t y = row * 4; y < std::min(height, row * 4 + 4); y++)
+                {
+                    for (size_t x = column * 4; x < std::min(width, column * 4 + 4); x++)
+                    {
+                        const uint8_t *expected = pixels + ((y % 4) * 4 + (x % 4)) * load.pixelBytes;
+                        const uint8_t *actual = output.data() + z * outputDepthPitch + y * outputRowPitch + x * load.pixelBytes;
+                        ASSERT_TRUE(std::equal(expected, expected + load.pixelBytes, actual))
+                            << load.name << " " << width << "x" << height << "x" << depth << " at " << x << ", " << y << ", " << z;
+                    }
+                }
+            }
+        }
+
+        // Padding between the rows must be left alone
+        for (size_t y = 0; y < height; y++)
+        {
+            const uint8_t *padding = output.data() + z * outputDepthPitch + y * outputRowPitch + width * load.pixelBytes;
+            for (size_t i = 0; i < outputRowPitch - width * load.pixelBytes; i++)
+            {
+                ASSERT_EQ(0xCD, padding[i]) << load.name << " row " << y;
+            }
+        }
+    }
+}
+
+TEST(LoadImageETCTest, ImagesMatchSingleBlocks)
+{
+    srand(0);
+
+    for (size_t function = 0; function < ArraySize(ETCLoadFunctions); function++)
+    {
+        CompareWithSingleBlocks(ETCLoadFunctions[function], 1, 1, 1);
+        CompareWithSingleBlocks(ETCLoadFunctions[function], 2, 3, 1);
+        CompareWithSingleBlocks(ETCLoadFunctions[function], 13, 7, 1);
+        CompareWithSingleBlocks(ETCLoadFunctions[function], 16, 16, 3);
+
+        // Large enough to be split across threads
+        CompareWithSingleBlocks(ETCLoadFunctions[function], 1021, 514, 1);
+    }
+}
+
+}
@@ -0,0 +1,143 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "common/mathutil.h"
+#include "libANGLE/renderer/d3d/formatutilsD3D.h"
+#include "libANGLE/renderer/d3d/loadimage.h"
+
+#include <cstdlib>
+#include <vector>
+
+using namespace rx;
+
+namespace
+{
+
+struct LoadFunctionPair
+{
+    const char *name;
+    LoadImageFunction simd;
+    LoadImageFunction reference;
+    size_t sourcePixelBytes;
+};
+
+const LoadFunctionPair SSE2LoadFunctions[] =
+{
+    { "L8ToRGBA8",      LoadL8ToRGBA8_SSE2,      LoadL8ToRGBA8,      1 },
+    { "LA8ToRGBA8",     LoadLA8ToRGBA8_SSE2,     LoadLA8ToRGBA8,     2 },
+    { "RGB8ToBGRX8",    LoadRGB8ToBGRX8_SSE2,    LoadRGB8ToBGRX8,    3 },
+    { "R5G6B5ToBGRA8",  LoadR5G6B5ToBGRA8_SSE2,  LoadR5G6B5ToBGRA8,  2 },
+    { "R5G6B5ToRGBA8",  LoadR5G6B5ToRGBA8_SSE2,  LoadR5G6B5ToRGBA8,  2 },
+    { "RGBA4ToBGRA8",   LoadRGBA4ToBGRA8_SSE2,   LoadRGBA4ToBGRA8,   2 },
+    { "RGBA4ToRGBA8",   LoadRGBA4ToRGBA8_SSE2,   LoadRGBA4ToRGBA8,   2 },
+    { "RGB5A1ToBGRA8",  LoadRGB5A1ToBGRA8_SSE2,  LoadRGB5A1ToBGRA8,  2 },
+    { "RGB5A1ToRGBA8",  LoadRGB5A1ToRGBA8_SSE2,  LoadRGB5A1ToRGBA8,  2 },
+};
+
+// Runs both loaders over the same random source, with the destination starting destOffset pixels into
+// a 16-byte aligned buffer so that the unaligned head, the block loop and the tail are all exercised.
+void CompareLoads(const LoadFunctionPair &functions, size_t width, size_t height, size_t depth, size_t destOffset)
+{
+    const size_t inputRowPitch = (width + 1) * functions.sourcePixelBytes;
+    const size_t inputDepthPitch = inputRowPitch * height;
+    const size_t outputRowPitch = (width + destOffset) * 4 + 4;
+    const size_t outputDepthPitch = outputRowPitch * height;
+
+    // End the source at the last pixel so that reads past it are caught by memory checkers
+    std::vector<uint8_t> input(inputDepthPitch * (depth - 1) + inputRowPitch * (height - 1) + width * functions.sourcePixelBytes);
+    for (size_t i = 0; i < input.size(); i++)
+    {
+        input[i] = static_cast<uint8_t>(rand());
+    }
+
+    const size_t outputSize = outputDepthPitch * depth + 16;
+    std::vector<uint8_t> simdStorage(outputSize + 16, 0xCD);
+    std::vector<uint8_t> referenceStorage(outputSize + 16, 0xCD);
+    uint8_t *simdOutput = simdStorage.data() + ((16 - (reinterpret_cast<uintptr_t>(simdStorage.data()) & 15)) & 15);
+    uint8_t *referenceOutput = referenceStorage.data() + ((16 - (reinterpret_cast<uintptr_t>(referenceStorage.data()) & 15)) & 15);
+
+    functions.simd(width, height, depth, input.data(), inputRowPitch, inputDepthPitch,
+                   simdOutput + destOffset * 4, outputRowPitch, outputDepthPitch);
+    functions.reference(width, height, depth, input.data(), inputRowPitch, inputDepthPitch,
+                        referenceOutput + destOffset * 4, outputRowPitch, outputDepthPitch);
+
+    for (size_t i = 0; i < outputSize; i++)
+    {
+        if (simdOutput[i] != referenceOutput[i])
+        {
+            ADD_FAILURE() << functions.name << " differs at byte " << i << " for width " << width
+                          << ", destination offset " << destOffset;
+            return;
+        }
+    }
+}
+
+TEST(LoadImageTest, SSE2MatchesReference)
+{
+    if (!gl::supportsSSE2())
+    {
+        return;
+    }
+
+    srand(0);
+
+    for (size_t function = 0; function < ArraySize(SSE2LoadFunctions); function++)
+    {
+        for (size_t width = 1; width <= 40; width++)
+        {
+            for (size_t destOffset = 0; destOffset < 4; destOffset++)
+            {
+                CompareLoads(SSE2LoadFunctions[function], width, 3, 2, destOffset);
+            }
+        }
+    }
+}
+
+TEST(LoadImageTest, SSE2CoversAllSourceValues)
+{
+    if (!gl::supportsSSE2())
+    {
+        return;
+    }
+
+    // Every 16-bit source value, laid out as a single row
+    std::vector<uint16_t> input(0x10000);
+    for (size_t i = 0; i < input.size(); i++)
+    {
+        input[i] = static_cast<uint16_t>(i);
+    }
+    const uint8_t *inputBytes = reinterpret_cast<const uint8_t*>(input.data());
+    const size_t rowPitch = input.size() * sizeof(uint16_t);
+
+    for (size_t function = 0; function < ArraySize(SSE2LoadFunctions); function++)
+    {
+        const LoadFunctionPair &functions = SSE2LoadFunctions[function];
+        size_t width = rowPitch / functions.sourcePixelBytes;
+
+        std::vector<uint32_t> simdOutput(width);
+        std::vector<uint32_t> referenceOutput(width);
+        functions.simd(width, 1, 1, inputBytes, rowPitch, rowPitch,
+                       reinterpret_cast<uint8_t*>(simdOutput.data()), width * 4, width * 4);
+        functions.reference(width, 1, 1, inputBytes, rowPitch, rowPitch,
+                            reinterpret_cast<uint8_t*>(referenceOutput.data()), width * 4, width * 4);
+
+        EXPECT_TRUE(simdOutput == referenceOutput) << functions.name;
+    }
+}
+
+TEST(LoadImageTest, IsLoadToNative)
+{
+    EXPECT_TRUE(IsLoadToNative(LoadToNative<GLubyte, 4>));
+    EXPECT_TRUE(IsLoadToNative(LoadToNative<GLushort, 3>));
+    EXPECT_TRUE(IsLoadToNative(LoadToNative<GLfloat, 1>));
+    EXPECT_FALSE(IsLoadToNative(LoadRGB8ToBGRX8));
+    EXPECT_FALSE(IsLoadToNative(LoadToNative3To4<GLubyte, 0xFF>));
+}
+
+}
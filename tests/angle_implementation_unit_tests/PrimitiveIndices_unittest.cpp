@@ -0,0 +1,111 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "libANGLE/renderer/d3d/primitiveindices.h"
+
+#include <cstdlib>
+#include <vector>
+
+using namespace rx;
+
+namespace
+{
+
+// Written around the generated indices, to catch writes past either end
+const GLuint Canary = 0xCDCDCDCD;
+
+// Returns index i of a draw, counting from zero for non-indexed draws
+template <typename T>
+GLuint GetIndex(const std::vector<T> &indices, size_t i)
+{
+    return indices.empty() ? static_cast<GLuint>(i) : indices[i];
+}
+
+template <typename T>
+void CheckPrimitiveIndices(GLenum type, const std::vector<T> &indices, GLuint count)
+{
+    // Copy the indices to memory that ends right after them, so that over-reads show up under ASan
+    std::vector<T> exactIndices(indices.begin(), indices.begin() + (indices.empty() ? 0 : count));
+    const void *source = exactIndices.empty() ? NULL : exactIndices.data();
+
+    std::vector<GLuint> expectedLoop;
+    expectedLoop.push_back(Canary);
+    for (GLuint i = 0; i < count; i++)
+    {
+        expectedLoop.push_back(GetIndex(indices, i));
+    }
+    expectedLoop.push_back(GetIndex(indices, 0));
+    expectedLoop.push_back(Canary);
+
+    std::vector<GLuint> loop(count + 3, Canary);
+    GenerateLineLoopIndices(type, source, count, &loop[1]);
+    EXPECT_EQ(expectedLoop, loop) << "line loop of " << count << " vertices";
+
+    if (count < 3)
+    {
+        return;
+    }
+
+    std::vector<GLuint> expectedFan;
+    expectedFan.push_back(Canary);
+    for (GLuint i = 0; i + 2 < count; i++)
+    {
+        expectedFan.push_back(GetIndex(indices, 0));
+        expectedFan.push_back(GetIndex(indices, i + 1));
+        expectedFan.push_back(GetIndex(indices, i + 2));
+    }
+    expectedFan.push_back(Canary);
+
+    std::vector<GLuint> fan((count - 2) * 3 + 2, Canary);
+    GenerateTriangleFanIndices(type, source, count, &fan[1]);
+    EXPECT_EQ(expectedFan, fan) << "triangle fan of " << count << " vertices";
+}
+
+template <typename T>
+void CheckIndexType(GLenum type)
+{
+    std::vector<T> indices;
+    for (size_t i = 0; i < 1000; i++)
+    {
+        // Keep the top bit of each type in play, which widening must not sign extend
+        indices.push_back(static_cast<T>(rand() * 65537u));
+    }
+
+    for (GLuint count = 1; count < 40; count++)
+    {
+        CheckPrimitiveIndices(type, indices, count);
+    }
+    CheckPrimitiveIndices(type, indices, 1000);
+}
+
+TEST(PrimitiveIndicesTest, NonIndexed)
+{
+    for (GLuint count = 1; count < 40; count++)
+    {
+        CheckPrimitiveIndices(GL_NONE, std::vector<GLuint>(), count);
+    }
+    CheckPrimitiveIndices(GL_NONE, std::vector<GLuint>(), 1000);
+}
+
+TEST(PrimitiveIndicesTest, UnsignedByte)
+{
+    CheckIndexType<GLubyte>(GL_UNSIGNED_BYTE);
+}
+
+TEST(PrimitiveIndicesTest, UnsignedShort)
+{
+    CheckIndexType<GLushort>(GL_UNSIGNED_SHORT);
+}
+
+TEST(PrimitiveIndicesTest, UnsignedInt)
+{
+    CheckIndexType<GLuint>(GL_UNSIGNED_INT);
+}
+
+}
@@ -0,0 +1,249 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "libANGLE/renderer/FenceNVImpl.h"
+#include "libANGLE/renderer/d3d/RingBufferAllocator.h"
+
+using namespace rx;
+
+namespace
+{
+
+// Stands in for the GPU, which finishes the commands fenced so far when told to
+struct FakeGPU
+{
+    FakeGPU() : issued(0), completed(0), liveFences(0) {}
+
+    void finishAll() { completed = issued; }
+
+    unsigned int issued;
+    unsigned int completed;
+    int liveFences;
+};
+
+class FakeFence : public FenceNVImpl
+{
+  public:
+    explicit FakeFence(FakeGPU *gpu)
+        : mGPU(gpu),
+          mIssue(0)
+    {
+        mGPU->liveFences++;
+    }
+
+    ~FakeFence()
+    {
+        mGPU->liveFences--;
+    }
+
+    gl::Error set()
+    {
+        mIssue = ++mGPU->issued;
+        return gl::Error(GL_NO_ERROR);
+    }
+
+    gl::Error test(bool flushCommandBuffer, GLboolean *outFinished)
+    {
+        *outFinished = (mIssue <= mGPU->completed ? GL_TRUE : GL_FALSE);
+        return gl::Error(GL_NO_ERROR);
+    }
+
+    gl::Error finishFence(GLboolean *outFinished)
+    {
+        mGPU->completed = std::max(mGPU->completed, mIssue);
+        *outFinished = GL_TRUE;
+        return gl::Error(GL_NO_ERROR);
+    }
+
+  private:
+    FakeGPU *mGPU;
+    unsigned int mIssue;
+};
+
+class TestRingBufferAllocator : public RingBufferAllocator
+{
+  public:
+    TestRingBufferAllocator(FakeGPU *gpu, bool fencesAvailable)
+        : RingBufferAllocator(4),
+          mGPU(gpu),
+          mFencesAvailable(fencesAvailable)
+    {
+    }
+
+  protected:
+    virtual FenceNVImpl *createFence()
+    {
+        return (mFencesAvailable ? new FakeFence(mGPU) : NULL);
+    }
+
+  private:
+    FakeGPU *mGPU;
+    bool mFencesAvailable;
+};
+
+class RingBufferAllocatorTest : public testing::Test
+{
+  protected:
+    RingBufferAllocatorTest()
+        : mWritePosition(0)
+    {
+    }
+
+    virtual void TearDown()
+    {
+        EXPECT_EQ(0, mGPU.liveFences);
+    }
+
+    // Reserves size bytes and writes them, as a streaming buffer would for a draw
+    RingReservation write(RingBufferAllocator *ring, unsigned int size)
+    {
+        unsigned int writePosition = 0;
+        RingReservation reservation = RING_RESERVED;
+        EXPECT_FALSE(ring->reserve(mWritePosition, size, &writePosition, &reservation).isError());
+        if (reservation == RING_RESERVED)
+        {
+            mWritePosition = writePosition + size;
+        }
+        return reservation;
+    }
+
+    FakeGPU mGPU;
+    unsigned int mWritePosition;
+};
+
+TEST_F(RingBufferAllocatorTest, FencesOnlyWhenLeavingASegment)
+{
+    TestRingBufferAllocator ring(&mGPU, true);
+    ring.reset(1000);
+
+    // The segments are 250 bytes
+    EXPECT_EQ(RING_RESERVED, write(&ring, 100));
+    EXPECT_EQ(RING_RESERVED, write(&ring, 100));
+    EXPECT_EQ(0u, ring.getStats().fencesSet);
+
+    EXPECT_EQ(RING_RESERVED, write(&ring, 100));
+    EXPECT_EQ(300u, mWritePosition);
+    EXPECT_EQ(1u, ring.getStats().fencesSet);
+
+    // Zero-byte reservations continue the previous one
+    unsigned int writePosition = 0;
+    RingReservation reservation = RING_NEEDS_GROWTH;
+    EXPECT_FALSE(ring.reserve(mWritePosition, 0, &writePosition, &reservation).isError());
+    EXPECT_EQ(RING_RESERVED, reservation);
+    EXPECT_EQ(300u, writePosition);
+}
+
+TEST_F(RingBufferAllocatorTest, WrapsWithoutWaitingForFinishedSegments)
+{
+    TestRingBufferAllocator ring(&mGPU, true);
+    ring.reset(1000);
+
+    for (int i = 0; i < 9; i++)
+    {
+        EXPECT_EQ(RING_RESERVED, write(&ring, 100));
+    }
+    mGPU.finishAll();
+
+    // 100 bytes left at the end are skipped
+    EXPECT_EQ(RING_RESERVED, write(&ring, 200));
+    EXPECT_EQ(200u, mWritePosition);
+    EXPECT_EQ(1u, ring.getStats().wraps);
+    EXPECT_EQ(0u, ring.getStats().fenceWaits);
+}
+
+TEST_F(RingBufferAllocatorTest, WaitsForSegmentsInUse)
+{
+    TestRingBufferAllocator ring(&mGPU, true);
+    ring.reset(1000);
+
+    for (int i = 0; i < 10; i++)
+    {
+        EXPECT_EQ(RING_RESERVED, write(&ring, 100));
+    }
+    unsigned int fencesBeforeWrap = mGPU.issued;
+
+    EXPECT_EQ(RING_RESERVED, write(&ring, 100));
+    EXPECT_EQ(100u, mWritePosition);
+    EXPECT_EQ(1u, ring.getStats().fenceWaits);
+
+    // Only the fence behind the first segment had to finish
+    EXPECT_LT(mGPU.completed, fencesBeforeWrap);
+    EXPECT_GT(mGPU.completed, 0u);
+}
+
+TEST_F(RingBufferAllocatorTest, ReusesFinishedFences)
+{
+    TestRingBufferAllocator ring(&mGPU, true);
+    ring.reset(1000);
+
+    for (int i = 0; i < 100; i++)
+    {
+        EXPECT_EQ(RING_RESERVED, write(&ring, 100));
+        mGPU.finishAll();
+    }
+
+    EXPECT_EQ(0u, ring.getStats().fenceWaits);
+    EXPECT_GT(ring.getStats().fencesSet, 30u);
+    EXPECT_LE(mGPU.liveFences, 4);
+}
+
+TEST_F(RingBufferAllocatorTest, GrowsInsteadOfOverwritingUnfencedData)
+{
+    TestRingBufferAllocator ring(&mGPU, true);
+    ring.reset(1000);
+
+    EXPECT_EQ(RING_RESERVED, write(&ring, 900));
+
+    // Wrapping would overwrite the first segment, which holds the data just written
+    EXPECT_EQ(RING_NEEDS_GROWTH, write(&ring, 200));
+    EXPECT_EQ(RING_NEEDS_GROWTH, write(&ring, 2000));
+
+    ring.reset(2000);
+    mWritePosition = 0;
+    EXPECT_EQ(RING_RESERVED, write(&ring, 2000));
+    EXPECT_EQ(0u, ring.getStats().fenceWaits);
+}
+
+TEST_F(RingBufferAllocatorTest, ReservingWithoutWritingKeepsThePosition)
+{
+    TestRingBufferAllocator ring(&mGPU, true);
+    ring.reset(1000);
+
+    // A reservation of the whole buffer that isn't written, as when a buffer is first sized
+    unsigned int writePosition = 0;
+    RingReservation reservation = RING_NEEDS_GROWTH;
+    EXPECT_FALSE(ring.reserve(0, 1000, &writePosition, &reservation).isError());
+    EXPECT_EQ(RING_RESERVED, reservation);
+    EXPECT_EQ(0u, writePosition);
+
+    EXPECT_EQ(RING_RESERVED, write(&ring, 600));
+    EXPECT_EQ(600u, mWritePosition);
+    EXPECT_EQ(0u, ring.getStats().fencesSet);
+}
+
+TEST_F(RingBufferAllocatorTest, DiscardsWithoutFences)
+{
+    TestRingBufferAllocator ring(&mGPU, false);
+    ring.reset(1000);
+
+    EXPECT_EQ(RING_RESERVED, write(&ring, 200));
+    EXPECT_EQ(RING_NEEDS_DISCARD, write(&ring, 200));
+
+    // After the discard, the buffer is written through and discarded again at its end
+    ring.reset(1000);
+    mWritePosition = 0;
+    for (int i = 0; i < 5; i++)
+    {
+        EXPECT_EQ(RING_RESERVED, write(&ring, 200));
+    }
+    EXPECT_EQ(RING_NEEDS_DISCARD, write(&ring, 200));
+    EXPECT_EQ(0u, ring.getStats().fencesSet);
+}
+
+}
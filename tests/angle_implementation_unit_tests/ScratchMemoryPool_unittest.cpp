@@ -0,0 +1,119 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "common/ScratchMemoryPool.h"
+
+using namespace rx;
+
+namespace
+{
+
+const size_t MaxRetainedBytes = 1024 * 1024;
+
+TEST(ScratchMemoryPoolTest, ReusesReturnedBuffers)
+{
+    ScratchMemoryPool pool(MaxRetainedBytes);
+
+    ScratchMemoryLease lease;
+    ASSERT_TRUE(pool.lease(5000, &lease));
+    EXPECT_EQ(5000u, lease.size());
+    uint8_t *firstData = lease.data();
+    lease.release();
+    EXPECT_TRUE(lease.empty());
+
+    // Any size in the same class gets the same buffer back
+    ASSERT_TRUE(pool.lease(8000, &lease));
+    EXPECT_EQ(firstData, lease.data());
+    lease.release();
+
+    pool.endFrame();
+    EXPECT_EQ(2u, pool.getLastFrameStats().leases);
+    EXPECT_EQ(1u, pool.getLastFrameStats().allocations);
+    EXPECT_EQ(8192u, pool.getLastFrameStats().highWaterBytes);
+    EXPECT_EQ(8192u, pool.getRetainedBytes());
+}
+
+TEST(ScratchMemoryPoolTest, TracksHighWaterMark)
+{
+    ScratchMemoryPool pool(MaxRetainedBytes);
+
+    {
+        ScratchMemoryLease first;
+        ScratchMemoryLease second;
+        ASSERT_TRUE(pool.lease(4096, &first));
+        ASSERT_TRUE(pool.lease(4096, &second));
+        EXPECT_NE(first.data(), second.data());
+    }
+
+    ScratchMemoryLease third;
+    ASSERT_TRUE(pool.lease(100, &third));
+
+    pool.endFrame();
+    EXPECT_EQ(3u, pool.getLastFrameStats().leases);
+    EXPECT_EQ(2u, pool.getLastFrameStats().allocations);
+    EXPECT_EQ(8192u, pool.getLastFrameStats().highWaterBytes);
+
+    // Memory still leased at the end of a frame counts towards the next one
+    pool.endFrame();
+    EXPECT_EQ(0u, pool.getLastFrameStats().leases);
+    EXPECT_EQ(4096u, pool.getLastFrameStats().highWaterBytes);
+}
+
+TEST(ScratchMemoryPoolTest, BoundsRetainedMemory)
+{
+    ScratchMemoryPool pool(MaxRetainedBytes);
+
+    ScratchMemoryLease large;
+    ScratchMemoryLease small;
+    ASSERT_TRUE(pool.lease(MaxRetainedBytes, &large));
+    ASSERT_TRUE(pool.lease(4096, &small));
+
+    // Once the large buffer is kept there is no room for the small one
+    large.release();
+    small.release();
+    EXPECT_EQ(MaxRetainedBytes, pool.getRetainedBytes());
+
+    pool.clear();
+    EXPECT_EQ(0u, pool.getRetainedBytes());
+}
+
+TEST(ScratchMemoryPoolTest, AllocatesLargeRequestsExactly)
+{
+    ScratchMemoryPool pool(MaxRetainedBytes);
+
+    const size_t largeSize = 16 * 1024 * 1024 + 1;
+    {
+        ScratchMemoryLease lease;
+        ASSERT_TRUE(pool.lease(largeSize, &lease));
+        EXPECT_EQ(largeSize, lease.size());
+    }
+
+    pool.endFrame();
+    EXPECT_EQ(largeSize, pool.getLastFrameStats().highWaterBytes);
+    EXPECT_EQ(0u, pool.getRetainedBytes());
+}
+
+TEST(ScratchMemoryPoolTest, FreesIdleBuffers)
+{
+    ScratchMemoryPool pool(MaxRetainedBytes);
+
+    {
+        ScratchMemoryLease lease;
+        ASSERT_TRUE(pool.lease(4096, &lease));
+    }
+    EXPECT_EQ(4096u, pool.getRetainedBytes());
+
+    for (size_t frame = 0; frame < 1000 && pool.getRetainedBytes() > 0; frame++)
+    {
+        pool.endFrame();
+    }
+    EXPECT_EQ(0u, pool.getRetainedBytes());
+}
+
+}
@@ -0,0 +1,179 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "libANGLE/renderer/d3d/StaticBufferCache.h"
+
+using namespace rx;
+
+namespace
+{
+
+// Stands in for a static vertex buffer, counting the live instances to check ownership
+class FakeBuffer
+{
+  public:
+    explicit FakeBuffer(unsigned int size)
+        : mSize(size)
+    {
+        LiveCount++;
+    }
+
+    ~FakeBuffer()
+    {
+        LiveCount--;
+    }
+
+    unsigned int getBufferSize() const { return mSize; }
+    void setBufferSize(unsigned int size) { mSize = size; }
+
+    static int LiveCount;
+
+  private:
+    unsigned int mSize;
+};
+
+int FakeBuffer::LiveCount = 0;
+
+typedef StaticBufferCache<int, FakeBuffer> FakeBufferCache;
+
+class StaticBufferCacheTest : public testing::Test
+{
+  protected:
+    virtual void SetUp()
+    {
+        FakeBuffer::LiveCount = 0;
+    }
+
+    virtual void TearDown()
+    {
+        EXPECT_EQ(0, FakeBuffer::LiveCount);
+    }
+};
+
+TEST_F(StaticBufferCacheTest, CountsHitsAndMisses)
+{
+    FakeBufferCache cache(8);
+
+    EXPECT_EQ(NULL, cache.lookup(1, 1));
+    ASSERT_TRUE(cache.makeRoom(1000, false, 1));
+    FakeBuffer *buffer = new FakeBuffer(100);
+    cache.insert(1, buffer, 1);
+
+    EXPECT_EQ(buffer, cache.lookup(1, 2));
+    EXPECT_EQ(buffer, cache.lookup(1, 3));
+    EXPECT_EQ(NULL, cache.lookup(2, 3));
+
+    // Plain finds are not counted
+    EXPECT_EQ(buffer, cache.find(1));
+    EXPECT_EQ(NULL, cache.find(2));
+
+    EXPECT_EQ(2u, cache.getStats().hits);
+    EXPECT_EQ(2u, cache.getStats().misses);
+    EXPECT_EQ(0u, cache.getStats().evictions);
+    EXPECT_EQ(100u, cache.getTotalSize());
+}
+
+TEST_F(StaticBufferCacheTest, RefusesOverBudgetWithoutEviction)
+{
+    FakeBufferCache cache(8);
+
+    ASSERT_TRUE(cache.makeRoom(100, false, 1));
+    cache.insert(1, new FakeBuffer(150), 1);
+
+    EXPECT_FALSE(cache.makeRoom(100, false, 2));
+    EXPECT_EQ(1u, cache.size());
+    EXPECT_EQ(1, FakeBuffer::LiveCount);
+}
+
+TEST_F(StaticBufferCacheTest, EvictsLeastRecentlyUsed)
+{
+    FakeBufferCache cache(8);
+
+    cache.insert(1, new FakeBuffer(100), 1);
+    cache.insert(2, new FakeBuffer(100), 2);
+    cache.insert(3, new FakeBuffer(100), 3);
+
+    // Using the first one again leaves the second as the least recently used
+    cache.lookup(1, 4);
+
+    ASSERT_TRUE(cache.makeRoom(250, true, 5));
+    EXPECT_EQ(2u, cache.size());
+    EXPECT_NE(static_cast<FakeBuffer*>(NULL), cache.find(1));
+    EXPECT_EQ(NULL, cache.find(2));
+    EXPECT_NE(static_cast<FakeBuffer*>(NULL), cache.find(3));
+    EXPECT_EQ(1u, cache.getStats().evictions);
+    EXPECT_EQ(2, FakeBuffer::LiveCount);
+}
+
+TEST_F(StaticBufferCacheTest, KeepsBuffersUsedAtCurrentSerial)
+{
+    FakeBufferCache cache(8);
+
+    cache.insert(1, new FakeBuffer(100), 1);
+    cache.insert(2, new FakeBuffer(100), 2);
+
+    // Both buffers are used by the draw at serial 3, so neither can make room for a third
+    cache.lookup(1, 3);
+    cache.lookup(2, 3);
+    EXPECT_FALSE(cache.makeRoom(150, true, 3));
+    EXPECT_EQ(2u, cache.size());
+
+    // Only the buffer left unused by the draw at serial 4 may go
+    cache.lookup(2, 4);
+    EXPECT_TRUE(cache.makeRoom(150, true, 4));
+    EXPECT_EQ(NULL, cache.find(1));
+    EXPECT_NE(static_cast<FakeBuffer*>(NULL), cache.find(2));
+}
+
+TEST_F(StaticBufferCacheTest, BoundsEntryCount)
+{
+    FakeBufferCache cache(2);
+
+    // Empty buffers cost nothing against the budget, but still count as entries
+    cache.insert(1, new FakeBuffer(0), 1);
+    cache.insert(2, new FakeBuffer(0), 2);
+
+    EXPECT_FALSE(cache.makeRoom(1000, false, 3));
+    EXPECT_TRUE(cache.makeRoom(1000, true, 3));
+    EXPECT_EQ(1u, cache.size());
+    EXPECT_EQ(NULL, cache.find(1));
+}
+
+TEST_F(StaticBufferCacheTest, HandlesSerialWrapAround)
+{
+    FakeBufferCache cache(8);
+
+    cache.insert(1, new FakeBuffer(100), 0xFFFFFFFEu);
+    cache.insert(2, new FakeBuffer(100), 0xFFFFFFFFu);
+
+    // The serial wrapped since the second buffer was used, which is still the more recent
+    ASSERT_TRUE(cache.makeRoom(150, true, 1));
+    EXPECT_EQ(NULL, cache.find(1));
+    EXPECT_NE(static_cast<FakeBuffer*>(NULL), cache.find(2));
+}
+
+TEST_F(StaticBufferCacheTest, MeasuresPopulatedSizes)
+{
+    FakeBufferCache cache(8);
+
+    FakeBuffer *buffer = new FakeBuffer(0);
+    cache.insert(1, buffer, 1);
+    EXPECT_TRUE(cache.makeRoom(100, false, 2));
+
+    // Static buffers are sized when first filled, after being added
+    buffer->setBufferSize(200);
+    EXPECT_EQ(200u, cache.getTotalSize());
+    EXPECT_FALSE(cache.makeRoom(100, false, 2));
+
+    cache.clear();
+    EXPECT_EQ(0u, cache.size());
+    EXPECT_EQ(0, FakeBuffer::LiveCount);
+}
+
+}
@@ -0,0 +1,217 @@
+#include "ANGLETest.h"
+
+// Use this to select which configurations (e.g. which renderer, which GLES major version) these tests should be run against.
+ANGLE_TYPED_TEST_CASE(MultiDrawTest, ES2_D3D9, ES2_D3D11, ES2_D3D11_FL9_3);
+
+template<typename T>
+class MultiDrawTest : public ANGLETest
+{
+  protected:
+    MultiDrawTest() : ANGLETest(T::GetGlesMajorVersion(), T::GetPlatform())
+    {
+        setWindowWidth(64);
+        setWindowHeight(64);
+        setConfigRedBits(8);
+        setConfigGreenBits(8);
+        setConfigBlueBits(8);
+        setConfigAlphaBits(8);
+    }
+
+    virtual void SetUp()
+    {
+        ANGLETest::SetUp();
+
+        mMultiDrawArraysEXT = NULL;
+        mMultiDrawElementsEXT = NULL;
+        mMultiDrawArraysInstancedANGLE = NULL;
+        mMultiDrawElementsInstancedANGLE = NULL;
+
+        char *extensionString = (char*)glGetString(GL_EXTENSIONS);
+        if (strstr(extensionString, "GL_EXT_multi_draw_arrays"))
+        {
+            mMultiDrawArraysEXT = (PFNGLMULTIDRAWARRAYSEXTPROC)eglGetProcAddress("glMultiDrawArraysEXT");
+            mMultiDrawElementsEXT = (PFNGLMULTIDRAWELEMENTSEXTPROC)eglGetProcAddress("glMultiDrawElementsEXT");
+        }
+        if (strstr(extensionString, "GL_ANGLE_multi_draw"))
+        {
+            mMultiDrawArraysInstancedANGLE = (PFNGLMULTIDRAWARRAYSINSTANCEDANGLEPROC)eglGetProcAddress("glMultiDrawArraysInstancedANGLE");
+            mMultiDrawElementsInstancedANGLE = (PFNGLMULTIDRAWELEMENTSINSTANCEDANGLEPROC)eglGetProcAddress("glMultiDrawElementsInstancedANGLE");
+        }
+
+        ASSERT_TRUE(mMultiDrawArraysEXT != NULL);
+        ASSERT_TRUE(mMultiDrawElementsEXT != NULL);
+
+        const std::string vs = SHADER_SOURCE
+        (
+            attribute vec2 a_position;
+            void main()
+            {
+                gl_Position = vec4(a_position, 0.0, 1.0);
+            }
+        );
+
+        const std::string fs = SHADER_SOURCE
+        (
+            precision mediump float;
+            void main()
+            {
+                gl_FragColor = vec4(1.0, 0.0, 0.0, 1.0);
+            }
+        );
+
+        mProgram = CompileProgram(vs, fs);
+        ASSERT_NE(0u, mProgram);
+
+        // One quad in each quarter of the window, as six vertices of two triangles, with indices
+        // that draw the same quads
+        std::vector<GLfloat> vertices;
+        std::vector<GLushort> indices;
+        for (int quad = 0; quad < 4; quad++)
+        {
+            GLfloat left = (quad % 2 == 0) ? -1.0f : 0.0f;
+            GLfloat bottom = (quad / 2 == 0) ? -1.0f : 0.0f;
+            GLfloat quadVertices[12] =
+            {
+                left, bottom,         left + 1.0f, bottom,         left + 1.0f, bottom + 1.0f,
+                left, bottom,         left + 1.0f, bottom + 1.0f,  left, bottom + 1.0f,
+            };
+            vertices.insert(vertices.end(), quadVertices, quadVertices + 12);
+
+            for (GLushort vertex = 0; vertex < 6; vertex++)
+            {
+                indices.push_back(static_cast<GLushort>(quad * 6 + vertex));
+            }
+        }
+
+        glGenBuffers(1, &mVertexBuffer);
+        glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+        glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(GLfloat), &vertices[0], GL_STATIC_DRAW);
+
+        glGenBuffers(1, &mIndexBuffer);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBuffer);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(GLushort), &indices[0], GL_STATIC_DRAW);
+
+        GLint positionLocation = glGetAttribLocation(mProgram, "a_position");
+        glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE, 0, 0);
+        glEnableVertexAttribArray(positionLocation);
+
+        glUseProgram(mProgram);
+        glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        ASSERT_GL_NO_ERROR();
+    }
+
+    virtual void TearDown()
+    {
+        glDeleteBuffers(1, &mVertexBuffer);
+        glDeleteBuffers(1, &mIndexBuffer);
+        glDeleteProgram(mProgram);
+
+        ANGLETest::TearDown();
+    }
+
+    // Checks the centre of each quarter of the window, which is red where its quad was drawn
+    void checkQuads(bool drawn0, bool drawn1, bool drawn2, bool drawn3)
+    {
+        const bool drawn[4] = { drawn0, drawn1, drawn2, drawn3 };
+        for (int quad = 0; quad < 4; quad++)
+        {
+            int x = (quad % 2 == 0) ? getWindowWidth() / 4 : getWindowWidth() * 3 / 4;
+            int y = (quad / 2 == 0) ? getWindowHeight() / 4 : getWindowHeight() * 3 / 4;
+            EXPECT_PIXEL_EQ(x, y, drawn[quad] ? 255 : 0, 0, 0, 255);
+        }
+    }
+
+    GLuint mProgram;
+    GLuint mVertexBuffer;
+    GLuint mIndexBuffer;
+
+    PFNGLMULTIDRAWARRAYSEXTPROC mMultiDrawArraysEXT;
+    PFNGLMULTIDRAWELEMENTSEXTPROC mMultiDrawElementsEXT;
+    PFNGLMULTIDRAWARRAYSINSTANCEDANGLEPROC mMultiDrawArraysInstancedANGLE;
+    PFNGLMULTIDRAWELEMENTSINSTANCEDANGLEPROC mMultiDrawElementsInstancedANGLE;
+};
+
+TYPED_TEST(MultiDrawTest, MultiDrawArrays)
+{
+    const GLint firsts[] = { 0, 18, 6 };
+    const GLsizei counts[] = { 6, 6, 0 };
+    this->mMultiDrawArraysEXT(GL_TRIANGLES, firsts, counts, 3);
+    EXPECT_GL_NO_ERROR();
+
+    this->checkQuads(true, false, false, true);
+}
+
+TYPED_TEST(MultiDrawTest, MultiDrawElements)
+{
+    const GLsizei counts[] = { 6, 6 };
+    const GLvoid *const indices[] =
+    {
+        reinterpret_cast<const GLvoid*>(6 * sizeof(GLushort)),
+        reinterpret_cast<const GLvoid*>(12 * sizeof(GLushort)),
+    };
+    this->mMultiDrawElementsEXT(GL_TRIANGLES, counts, GL_UNSIGNED_SHORT, indices, 2);
+    EXPECT_GL_NO_ERROR();
+
+    this->checkQuads(false, true, true, false);
+}
+
+TYPED_TEST(MultiDrawTest, MultiDrawInstanced)
+{
+    if (this->mMultiDrawArraysInstancedANGLE == NULL || this->mMultiDrawElementsInstancedANGLE == NULL)
+    {
+        std::cout << "Test skipped because GL_ANGLE_multi_draw is not available." << std::endl;
+        return;
+    }
+
+    // Draws with no instances are skipped
+    const GLint firsts[] = { 0, 6 };
+    const GLsizei counts[] = { 6, 6 };
+    const GLsizei instanceCounts[] = { 1, 0 };
+    this->mMultiDrawArraysInstancedANGLE(GL_TRIANGLES, firsts, counts, instanceCounts, 2);
+    EXPECT_GL_NO_ERROR();
+
+    const GLvoid *const indices[] =
+    {
+        reinterpret_cast<const GLvoid*>(12 * sizeof(GLushort)),
+        reinterpret_cast<const GLvoid*>(18 * sizeof(GLushort)),
+    };
+    this->mMultiDrawElementsInstancedANGLE(GL_TRIANGLES, counts, GL_UNSIGNED_SHORT, indices, instanceCounts, 2);
+    EXPECT_GL_NO_ERROR();
+
+    this->checkQuads(true, false, true, false);
+}
+
+TYPED_TEST(MultiDrawTest, ErrorLeavesBatchUndrawn)
+{
+    const GLint firsts[] = { 0, 6 };
+    const GLsizei counts[] = { 6, -1 };
+    this->mMultiDrawArraysEXT(GL_TRIANGLES, firsts, counts, 2);
+    EXPECT_GL_ERROR(GL_INVALID_VALUE);
+
+    // The second draw reads past the end of the index buffer
+    const GLsizei elementCounts[] = { 6, 6 };
+    const GLvoid *const indices[] =
+    {
+        reinterpret_cast<const GLvoid*>(0),
+        reinterpret_cast<const GLvoid*>(20 * sizeof(GLushort)),
+    };
+    this->mMultiDrawElementsEXT(GL_TRIANGLES, elementCounts, GL_UNSIGNED_SHORT, indices, 2);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    this->mMultiDrawArraysEXT(GL_TRIANGLES, firsts, counts, -1);
+    EXPECT_GL_ERROR(GL_INVALID_VALUE);
+
+    this->mMultiDrawArraysEXT(GL_TRIANGLES, firsts, NULL, 1);
+    EXPECT_GL_ERROR(GL_INVALID_VALUE);
+
+    this->mMultiDrawElementsEXT(GL_TRIANGLES, elementCounts, GL_UNSIGNED_SHORT, NULL, 1);
+    EXPECT_GL_ERROR(GL_INVALID_VALUE);
+
+    // Nothing is read from the arrays of an empty batch
+    this->mMultiDrawArraysEXT(GL_TRIANGLES, NULL, NULL, 0);
+    EXPECT_GL_NO_ERROR();
+
+    this->checkQuads(false, false, false, false);
+}
@@ -0,0 +1,184 @@
+#include "ANGLETest.h"
+
+// Use this to select which configurations (e.g. which renderer, which GLES major version) these tests should be run against.
+ANGLE_TYPED_TEST_CASE(PrimitiveRestartTest, ES3_D3D11);
+
+template<typename T>
+class PrimitiveRestartTest : public ANGLETest
+{
+  protected:
+    PrimitiveRestartTest() : ANGLETest(T::GetGlesMajorVersion(), T::GetPlatform())
+    {
+        setWindowWidth(128);
+        setWindowHeight(128);
+        setConfigRedBits(8);
+        setConfigGreenBits(8);
+        setConfigBlueBits(8);
+        setConfigAlphaBits(8);
+    }
+
+    virtual void SetUp()
+    {
+        ANGLETest::SetUp();
+
+        const std::string vertexShaderSource = SHADER_SOURCE
+        (
+            precision highp float;
+            attribute vec2 position;
+
+            void main()
+            {
+                gl_Position = vec4(position, 0.0, 1.0);
+            }
+        );
+
+        const std::string fragmentShaderSource = SHADER_SOURCE
+        (
+            precision highp float;
+
+            void main()
+            {
+                gl_FragColor = vec4(1.0, 0.0, 0.0, 1.0);
+            }
+        );
+
+        mProgram = CompileProgram(vertexShaderSource, fragmentShaderSource);
+        if (mProgram == 0)
+        {
+            FAIL() << "shader compilation failed.";
+        }
+
+        // Two quads, one on each side of the window, each in strip order.
+        const GLfloat vertices[] =
+        {
+            -0.9f, -0.5f,  -0.9f, 0.5f,  -0.1f, -0.5f,  -0.1f, 0.5f,
+             0.1f, -0.5f,   0.1f, 0.5f,   0.9f, -0.5f,   0.9f, 0.5f,
+        };
+
+        glGenBuffers(1, &mVertexBuffer);
+        glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+
+        glGenBuffers(1, &mIndexBuffer);
+
+        ASSERT_GL_NO_ERROR();
+    }
+
+    virtual void TearDown()
+    {
+        glDeleteProgram(mProgram);
+        glDeleteBuffers(1, &mVertexBuffer);
+        glDeleteBuffers(1, &mIndexBuffer);
+
+        ANGLETest::TearDown();
+    }
+
+    template <typename IndexType>
+    void drawQuads(GLenum mode, GLenum indexType, const IndexType *indices, GLsizei count)
+    {
+        glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        glUseProgram(mProgram);
+
+        glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+        GLint positionLocation = glGetAttribLocation(mProgram, "position");
+        glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE, 0, 0);
+        glEnableVertexAttribArray(positionLocation);
+
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBuffer);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(IndexType), indices, GL_STATIC_DRAW);
+
+        glEnable(GL_PRIMITIVE_RESTART_FIXED_INDEX);
+        glDrawElements(mode, count, indexType, 0);
+        glDisable(GL_PRIMITIVE_RESTART_FIXED_INDEX);
+
+        EXPECT_GL_NO_ERROR();
+    }
+
+    void checkQuads()
+    {
+        // Both quads are drawn, but nothing connects them.
+        EXPECT_PIXEL_EQ(32, 64, 255, 0, 0, 255);
+        EXPECT_PIXEL_EQ(96, 64, 255, 0, 0, 255);
+        EXPECT_PIXEL_EQ(64, 64, 0, 0, 0, 255);
+    }
+
+    GLuint mProgram;
+    GLuint mVertexBuffer;
+    GLuint mIndexBuffer;
+};
+
+TYPED_TEST(PrimitiveRestartTest, TriangleStripUnsignedShort)
+{
+    const GLushort indices[] = { 0, 1, 2, 3, 0xFFFF, 4, 5, 6, 7 };
+    this->drawQuads(GL_TRIANGLE_STRIP, GL_UNSIGNED_SHORT, indices, 9);
+    this->checkQuads();
+}
+
+TYPED_TEST(PrimitiveRestartTest, TriangleStripUnsignedByte)
+{
+    const GLubyte indices[] = { 0, 1, 2, 3, 0xFF, 4, 5, 6, 7 };
+    this->drawQuads(GL_TRIANGLE_STRIP, GL_UNSIGNED_BYTE, indices, 9);
+    this->checkQuads();
+}
+
+TYPED_TEST(PrimitiveRestartTest, TriangleStripUnsignedInt)
+{
+    const GLuint indices[] = { 0, 1, 2, 3, 0xFFFFFFFF, 4, 5, 6, 7 };
+    this->drawQuads(GL_TRIANGLE_STRIP, GL_UNSIGNED_INT, indices, 9);
+    this->checkQuads();
+}
+
+TYPED_TEST(PrimitiveRestartTest, TriangleFan)
+{
+    const GLushort indices[] = { 0, 1, 3, 2, 0xFFFF, 4, 5, 7, 6 };
+    this->drawQuads(GL_TRIANGLE_FAN, GL_UNSIGNED_SHORT, indices, 9);
+    this->checkQuads();
+}
+
+TYPED_TEST(PrimitiveRestartTest, TrianglesDropIncompletePrimitive)
+{
+    // The restart index discards the partial triangle (0, 1) before it.
+    const GLushort indices[] = { 0, 1, 0xFFFF, 0, 1, 2, 1, 3, 2, 4, 5, 6, 5, 7, 6 };
+    this->drawQuads(GL_TRIANGLES, GL_UNSIGNED_SHORT, indices, 15);
+    this->checkQuads();
+}
+
+TYPED_TEST(PrimitiveRestartTest, OnlyRestartIndices)
+{
+    const GLushort indices[] = { 0xFFFF, 0xFFFF, 0xFFFF };
+    this->drawQuads(GL_TRIANGLE_FAN, GL_UNSIGNED_SHORT, indices, 3);
+    EXPECT_PIXEL_EQ(32, 64, 0, 0, 0, 255);
+}
+
+TYPED_TEST(PrimitiveRestartTest, ClientMemoryIndexMatchingRestartIndex)
+{
+    // Client memory indices and vertices, so that the range of the indices is only found when they
+    // are converted. Index 0xFFFF is an ordinary vertex while primitive restart is disabled.
+    std::vector<GLfloat> vertices(0x10000 * 2, 0.0f);
+    const GLfloat quad[] = { -0.9f, -0.5f,  -0.9f, 0.5f,  -0.1f, -0.5f,  -0.1f, 0.5f };
+    std::copy(quad, quad + 6, vertices.begin());
+    std::copy(quad + 6, quad + 8, vertices.end() - 2);
+
+    const GLushort indices[] = { 0, 1, 2, 0xFFFF, 2, 1 };
+
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    glUseProgram(this->mProgram);
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    GLint positionLocation = glGetAttribLocation(this->mProgram, "position");
+    glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE, 0, &vertices[0]);
+    glEnableVertexAttribArray(positionLocation);
+
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, indices);
+    EXPECT_GL_NO_ERROR();
+
+    glDisableVertexAttribArray(positionLocation);
+
+    EXPECT_PIXEL_EQ(32, 64, 255, 0, 0, 255);
+    EXPECT_PIXEL_EQ(96, 64, 0, 0, 0, 255);
+}
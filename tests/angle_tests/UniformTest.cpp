@@ -76,3 +76,51 @@ TYPED_TEST(UniformTest, GetUniformNoCurrentProgram)
     ASSERT_GL_NO_ERROR();
     EXPECT_EQ(1, i);
 }
+
+// Relinking the bound program replaces its uniform storage, which must not disturb the driver
+// uniforms that share the constant registers on D3D9
+TYPED_TEST(UniformTest, RelinkBoundProgram)
+{
+    const std::string &vertexShader =
+        "attribute vec2 position;\n"
+        "void main() { gl_Position = vec4(position, 0, 1); }";
+    const std::string &fragShader =
+        "precision mediump float;\n"
+        "uniform vec4 color;\n"
+        "void main() { gl_FragColor = color; }";
+
+    GLuint program = CompileProgram(vertexShader, fragShader);
+    ASSERT_NE(program, 0u);
+
+    // A quad covering the middle half of the window
+    const GLfloat vertices[] =
+    {
+        -0.5f, -0.5f,   0.5f, -0.5f,   0.5f, 0.5f,
+        -0.5f, -0.5f,   0.5f,  0.5f,  -0.5f, 0.5f,
+    };
+
+    glUseProgram(program);
+    GLint positionLocation = glGetAttribLocation(program, "position");
+    glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE, 0, vertices);
+    glEnableVertexAttribArray(positionLocation);
+
+    glUniform4f(glGetUniformLocation(program, "color"), 1.0f, 0.0f, 0.0f, 1.0f);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+
+    glLinkProgram(program);
+    ASSERT_EQ(positionLocation, glGetAttribLocation(program, "position"));
+    glUniform4f(glGetUniformLocation(program, "color"), 0.0f, 1.0f, 0.0f, 1.0f);
+
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_PIXEL_EQ(this->getWindowWidth() / 2, this->getWindowHeight() / 2, 0, 255, 0, 255);
+    EXPECT_PIXEL_EQ(this->getWindowWidth() / 8, this->getWindowHeight() / 8, 0, 0, 0, 255);
+    EXPECT_PIXEL_EQ(this->getWindowWidth() * 7 / 8, this->getWindowHeight() * 7 / 8, 0, 0, 0, 255);
+
+    glDisableVertexAttribArray(positionLocation);
+    glUseProgram(0);
+    glDeleteProgram(program);
+}
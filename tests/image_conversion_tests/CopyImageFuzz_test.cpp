@@ -0,0 +1,80 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// CopyImageFuzz_test.cpp: Runs every fast copy function over random pixel counts and alignments,
+// and compares it with converting each pixel through gl::ColorF.
+
+#include "gtest/gtest.h"
+
+#include "ImageConversionFunctions.h"
+
+#include <cstdlib>
+#include <vector>
+
+namespace image_conversion_tests
+{
+
+// Lets gtest name the parameter of a failing test
+void PrintTo(const CopyFunctionInfo &function, std::ostream *os)
+{
+    *os << function.name;
+}
+
+}
+
+using namespace image_conversion_tests;
+
+namespace
+{
+
+// Value of the bytes around the copied pixels, which must not be written
+const uint8_t CanaryByte = 0xCD;
+
+void CheckCopy(const CopyFunctionInfo &function, size_t count, size_t sourceOffset, size_t destOffset)
+{
+    std::vector<uint8_t> source(sourceOffset + count * function.sourcePixelBytes);
+    for (size_t i = 0; i < source.size(); i++)
+    {
+        source[i] = static_cast<uint8_t>(rand());
+    }
+
+    const size_t destSize = destOffset + count * function.destPixelBytes + 16;
+    std::vector<uint8_t> expected(destSize, CanaryByte);
+    for (size_t i = 0; i < count; i++)
+    {
+        function.referencePixelCopy(&source[sourceOffset + i * function.sourcePixelBytes],
+                                    &expected[destOffset + i * function.destPixelBytes]);
+    }
+
+    std::vector<uint8_t> actual(destSize, CanaryByte);
+    function.copyFunction(source.data() + sourceOffset, actual.data() + destOffset, count);
+
+    ASSERT_TRUE(expected == actual) << function.name << ", " << count << " pixels from offset " << sourceOffset
+                                    << " to offset " << destOffset;
+}
+
+class CopyImageFuzzTest : public testing::TestWithParam<CopyFunctionInfo>
+{
+};
+
+TEST_P(CopyImageFuzzTest, MatchesColorF)
+{
+    const CopyFunctionInfo &function = GetParam();
+    srand(0);
+
+    CheckCopy(function, 0, 0, 0);
+    for (size_t iteration = 0; iteration < 200; iteration++)
+    {
+        // Offsets stay aligned to the pixel words, as they are in mapped resources
+        size_t sourceOffset = (rand() % 8) * 4;
+        size_t destOffset = (rand() % 8) * ((function.destPixelBytes == 2) ? 2 : 4);
+        CheckCopy(function, rand() % 300, sourceOffset, destOffset);
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(AllCopyFunctions, CopyImageFuzzTest, testing::ValuesIn(GetCopyFunctions()));
+
+}
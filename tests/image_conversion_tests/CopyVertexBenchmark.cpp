@@ -0,0 +1,107 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// CopyVertexBenchmark.cpp: Measures the vertex attribute conversions of the D3D9 and D3D11
+// renderers, on tightly packed and on interleaved vertices.
+
+#include "gtest/gtest.h"
+#include "third_party/perf/perf_test.h"
+
+#include "libANGLE/renderer/d3d/d3d9/vertexconversion.h"
+#include "libANGLE/renderer/d3d/d3d11/copyvertex.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace rx;
+
+namespace
+{
+
+const double MinimumSeconds = 0.05;
+const size_t MinimumRuns = 3;
+
+// Returns how many megabytes of source vertices per second work goes through
+template <typename Work>
+double MeasureThroughput(Work work, size_t bytesPerRun)
+{
+    typedef std::chrono::steady_clock Clock;
+
+    Clock::time_point start = Clock::now();
+    double seconds = 0.0;
+    size_t runs = 0;
+    while (runs < MinimumRuns || seconds < MinimumSeconds)
+    {
+        work();
+        runs++;
+        seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    }
+
+    return (static_cast<double>(bytesPerRun) * runs) / (seconds * 1024.0 * 1024.0);
+}
+
+typedef void (*VertexCopyFunction)(const uint8_t *input, size_t stride, size_t count, uint8_t *output);
+
+struct VertexCopyRun
+{
+    VertexCopyFunction copyFunction;
+    const uint8_t *input;
+    size_t stride;
+    size_t count;
+    uint8_t *output;
+
+    void operator()() const
+    {
+        copyFunction(input, stride, count, output);
+    }
+};
+
+void MeasureVertexCopy(const char *name, VertexCopyFunction copyFunction, size_t inputBytes, size_t outputBytes)
+{
+    const size_t count = 256 * 1024;
+
+    // Interleaved vertices put the attribute in a 32-byte vertex, next to other attributes
+    const size_t strides[] = { inputBytes, 32 };
+    const char *layouts[] = { "_packed", "_interleaved" };
+
+    for (size_t layout = 0; layout < 2; layout++)
+    {
+        std::vector<uint8_t> input(count * strides[layout]);
+        for (size_t i = 0; i < input.size(); i++)
+        {
+            input[i] = static_cast<uint8_t>(rand());
+        }
+        std::vector<uint8_t> output(count * outputBytes);
+
+        VertexCopyRun run = { copyFunction, input.data(), strides[layout], count, output.data() };
+        perf_test::PrintResult("copy_vertex", layouts[layout], name, MeasureThroughput(run, count * inputBytes),
+                               "MB/s", true);
+    }
+}
+
+TEST(CopyVertexBenchmark, D3D11Conversions)
+{
+    MeasureVertexCopy("ushort4_norm_to_float4", CopyTo32FVertexData<GLushort, 4, 4, true>, 8, 16);
+    MeasureVertexCopy("ushort2_to_float2", CopyTo32FVertexData<GLushort, 2, 2, false>, 4, 8);
+    MeasureVertexCopy("int3_norm_to_float3", CopyTo32FVertexData<GLint, 3, 3, true>, 12, 12);
+    MeasureVertexCopy("uint4_norm_to_float4", CopyTo32FVertexData<GLuint, 4, 4, true>, 16, 16);
+    MeasureVertexCopy("fixed3_to_float3", Copy32FixedTo32FVertexData<3, 3>, 12, 12);
+    MeasureVertexCopy("fixed4_to_float4", Copy32FixedTo32FVertexData<4, 4>, 16, 16);
+    MeasureVertexCopy("byte4_snorm_to_short4", Copy8SnormTo16SnormVertexData<4, 4>, 4, 8);
+    MeasureVertexCopy("byte2_sint_to_short2", Copy8SintTo16SintVertexData<2, 2>, 2, 4);
+}
+
+TEST(CopyVertexBenchmark, D3D9Conversions)
+{
+    MeasureVertexCopy("byte3_norm_to_float3", VertexDataConverter<GLbyte, NoWiden<3>, Normalize<GLbyte> >::convertArray, 3, 12);
+    MeasureVertexCopy("ubyte4_norm_to_float4", VertexDataConverter<GLubyte, NoWiden<4>, Normalize<GLubyte> >::convertArray, 4, 16);
+    MeasureVertexCopy("short2_norm_to_float2", VertexDataConverter<GLshort, NoWiden<2>, Normalize<GLshort> >::convertArray, 4, 8);
+    MeasureVertexCopy("fixed2_to_float2", VertexDataConverter<GLint, NoWiden<2>, FixedToFloat<GLint, 16> >::convertArray, 8, 8);
+}
+
+}
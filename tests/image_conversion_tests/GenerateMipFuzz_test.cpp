@@ -0,0 +1,177 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// GenerateMipFuzz_test.cpp: Runs every GenerateMip instantiation, alone and through
+// GenerateMipChain, over random sizes and pitches, and compares it with a pixel by pixel filter.
+
+#include "gtest/gtest.h"
+
+#include "ImageConversionFunctions.h"
+
+#include "libANGLE/renderer/d3d/generatemip.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+namespace image_conversion_tests
+{
+
+// Lets gtest name the parameter of a failing test
+void PrintTo(const MipFunctionInfo &function, std::ostream *os)
+{
+    *os << function.name;
+}
+
+}
+
+using namespace image_conversion_tests;
+
+namespace
+{
+
+// Value of the bytes outside of the mip levels, which must not be written
+const uint8_t CanaryByte = 0xCD;
+
+// A mip chain with randomly padded pitches, in memory initialized to CanaryByte
+class MipChain
+{
+  public:
+    MipChain(const MipFunctionInfo &function, size_t width, size_t height, size_t depth)
+    {
+        while (true)
+        {
+            rx::MipChainLevel level;
+            level.width = width;
+            level.height = height;
+            level.depth = depth;
+            level.rowPitch = width * function.pixelBytes + (rand() % 4) * 16;
+            level.depthPitch = level.rowPitch * height + (rand() % 4) * 16;
+            level.data = NULL;
+            mLevels.push_back(level);
+
+            if (width == 1 && height == 1 && depth == 1)
+            {
+                break;
+            }
+            width = std::max<size_t>(1, width / 2);
+            height = std::max<size_t>(1, height / 2);
+            depth = std::max<size_t>(1, depth / 2);
+        }
+
+        for (size_t i = 0; i < mLevels.size(); i++)
+        {
+            mData.push_back(std::vector<uint8_t>(mLevels[i].depthPitch * mLevels[i].depth, CanaryByte));
+            mLevels[i].data = mData[i].data();
+        }
+    }
+
+    void randomizeTopLevel(const MipFunctionInfo &function)
+    {
+        const rx::MipChainLevel &level = mLevels[0];
+        for (size_t z = 0; z < level.depth; z++)
+        {
+            for (size_t y = 0; y < level.height; y++)
+            {
+                uint8_t *row = level.data + z * level.depthPitch + y * level.rowPitch;
+                if (function.hasFloat32Channels)
+                {
+                    float *values = reinterpret_cast<float*>(row);
+                    for (size_t i = 0; i < level.width * function.pixelBytes / sizeof(float); i++)
+                    {
+                        values[i] = static_cast<float>(rand() % 20001 - 10000) / 7.0f;
+                    }
+                }
+                else
+                {
+                    for (size_t i = 0; i < level.width * function.pixelBytes; i++)
+                    {
+                        row[i] = static_cast<uint8_t>(rand());
+                    }
+                }
+            }
+        }
+    }
+
+    void copyTopLevel(const MipChain &other)
+    {
+        ASSERT_EQ(other.mData[0].size(), mData[0].size());
+        mData[0] = other.mData[0];
+    }
+
+    const std::vector<rx::MipChainLevel> &levels() const { return mLevels; }
+    const std::vector<uint8_t> &levelData(size_t level) const { return mData[level]; }
+
+  private:
+    std::vector<rx::MipChainLevel> mLevels;
+    std::vector<std::vector<uint8_t> > mData;
+};
+
+void GenerateLevels(rx::MipGenerationFunction generateMip, const std::vector<rx::MipChainLevel> &levels)
+{
+    for (size_t i = 1; i < levels.size(); i++)
+    {
+        const rx::MipChainLevel &source = levels[i - 1];
+        const rx::MipChainLevel &dest = levels[i];
+        generateMip(source.width, source.height, source.depth, source.data, source.rowPitch, source.depthPitch,
+                    dest.data, dest.rowPitch, dest.depthPitch);
+    }
+}
+
+void CheckMips(const MipFunctionInfo &function, size_t width, size_t height, size_t depth)
+{
+    // The copies share pitches by being built from the same random sequence
+    unsigned int layoutSeed = static_cast<unsigned int>(rand());
+
+    srand(layoutSeed);
+    MipChain expected(function, width, height, depth);
+    expected.randomizeTopLevel(function);
+    GenerateLevels(function.referenceMip, expected.levels());
+
+    srand(layoutSeed);
+    MipChain actual(function, width, height, depth);
+    actual.copyTopLevel(expected);
+    GenerateLevels(function.generateMip, actual.levels());
+
+    srand(layoutSeed);
+    MipChain chain(function, width, height, depth);
+    chain.copyTopLevel(expected);
+    rx::GenerateMipChain(function.generateMip, chain.levels().data(), chain.levels().size());
+
+    for (size_t level = 1; level < expected.levels().size(); level++)
+    {
+        ASSERT_TRUE(expected.levelData(level) == actual.levelData(level))
+            << function.name << " " << width << "x" << height << "x" << depth << " level " << level;
+        ASSERT_TRUE(expected.levelData(level) == chain.levelData(level))
+            << function.name << " chain " << width << "x" << height << "x" << depth << " level " << level;
+    }
+}
+
+class GenerateMipFuzzTest : public testing::TestWithParam<MipFunctionInfo>
+{
+};
+
+TEST_P(GenerateMipFuzzTest, MatchesReferenceFilter)
+{
+    const MipFunctionInfo &function = GetParam();
+    srand(0);
+
+    CheckMips(function, 2, 1, 1);
+    CheckMips(function, 1, 2, 1);
+    CheckMips(function, 1, 1, 2);
+    for (size_t iteration = 0; iteration < 30; iteration++)
+    {
+        size_t depth = (rand() % 3 == 0) ? 1 + rand() % 9 : 1;
+        CheckMips(function, 1 + rand() % 90, 1 + rand() % 40, depth);
+    }
+
+    // Large enough for GenerateMipChain to use several threads
+    CheckMips(function, 1027, 515, 1);
+}
+
+INSTANTIATE_TEST_CASE_P(AllMipFunctions, GenerateMipFuzzTest, testing::ValuesIn(GetMipFunctions()));
+
+}
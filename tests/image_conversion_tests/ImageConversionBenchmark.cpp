@@ -0,0 +1,245 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// ImageConversionBenchmark.cpp: Measures the throughput of every load, mip generation and copy
+// function on the CPU alone, so that changes to them can be compared without a GPU or a driver.
+
+#include "gtest/gtest.h"
+#include "third_party/perf/perf_test.h"
+
+#include "ImageConversionFunctions.h"
+
+#include "common/ScratchMemoryPool.h"
+#include "libANGLE/renderer/d3d/ImageLoadTask.h"
+#include "libANGLE/renderer/d3d/generatemip.h"
+#include "libANGLE/renderer/d3d/loadimage.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <vector>
+
+using namespace image_conversion_tests;
+
+namespace
+{
+
+// Each measurement repeats its work for at least this long, to smooth out the timer resolution
+// and the first run's page faults.
+const double MinimumSeconds = 0.05;
+const size_t MinimumRuns = 3;
+
+// Runs work until enough time has passed, and returns how many megabytes of bytesPerRun it went
+// through per second.
+template <typename Work>
+double MeasureThroughput(Work work, size_t bytesPerRun)
+{
+    typedef std::chrono::steady_clock Clock;
+
+    Clock::time_point start = Clock::now();
+    double seconds = 0.0;
+    size_t runs = 0;
+    while (runs < MinimumRuns || seconds < MinimumSeconds)
+    {
+        work();
+        runs++;
+        seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    }
+
+    return (static_cast<double>(bytesPerRun) * runs) / (seconds * 1024.0 * 1024.0);
+}
+
+std::vector<uint8_t> RandomBytes(size_t size)
+{
+    std::vector<uint8_t> bytes(size);
+    for (size_t i = 0; i < size; i++)
+    {
+        bytes[i] = static_cast<uint8_t>(rand());
+    }
+    return bytes;
+}
+
+struct LoadRun
+{
+    const LoadFunctionInfo *function;
+    size_t width;
+    size_t height;
+    const uint8_t *input;
+    size_t inputRowPitch;
+    uint8_t *output;
+    size_t outputRowPitch;
+
+    void operator()() const
+    {
+        function->loadFunction(width, height, 1, input, inputRowPitch, inputRowPitch * height,
+                               output, outputRowPitch, outputRowPitch * height);
+    }
+};
+
+TEST(ImageConversionBenchmark, LoadFunctions)
+{
+    const size_t size = 1024;
+
+    for (size_t i = 0; i < GetLoadFunctions().size(); i++)
+    {
+        const LoadFunctionInfo &function = GetLoadFunctions()[i];
+        const size_t blockRows = size / function.blockSize;
+
+        std::vector<uint8_t> input = RandomBytes(blockRows * blockRows * function.inputBytes);
+        size_t outputRowPitch = function.outputIsBlocks ? blockRows * function.outputBytes : size * function.outputBytes;
+        std::vector<uint8_t> output((function.outputIsBlocks ? blockRows : size) * outputRowPitch);
+
+        LoadRun run = { &function, size, size, input.data(), blockRows * function.inputBytes,
+                        output.data(), outputRowPitch };
+        perf_test::PrintResult("load", "", function.name, MeasureThroughput(run, input.size()), "MB/s", true);
+    }
+}
+
+struct MipChainRun
+{
+    rx::MipGenerationFunction generateMip;
+    std::vector<rx::MipChainLevel> levels;
+
+    void operator()() const
+    {
+        rx::GenerateMipChain(generateMip, levels.data(), levels.size());
+    }
+};
+
+struct MipLevelRun
+{
+    rx::MipGenerationFunction generateMip;
+    rx::MipChainLevel source;
+    rx::MipChainLevel dest;
+
+    void operator()() const
+    {
+        generateMip(source.width, source.height, source.depth, source.data, source.rowPitch, source.depthPitch,
+                    dest.data, dest.rowPitch, dest.depthPitch);
+    }
+};
+
+TEST(ImageConversionBenchmark, GenerateMipFunctions)
+{
+    const size_t size = 1024;
+
+    for (size_t i = 0; i < GetMipFunctions().size(); i++)
+    {
+        const MipFunctionInfo &function = GetMipFunctions()[i];
+
+        // Float formats get small finite values, as denormals and NaNs would distort the timing
+        std::vector<std::vector<uint8_t> > data;
+        MipChainRun chain;
+        chain.generateMip = function.generateMip;
+        for (size_t levelSize = size; levelSize > 0; levelSize /= 2)
+        {
+            rx::MipChainLevel level;
+            level.width = levelSize;
+            level.height = levelSize;
+            level.depth = 1;
+            level.rowPitch = levelSize * function.pixelBytes;
+            level.depthPitch = level.rowPitch * levelSize;
+
+            if (data.empty() && function.hasFloat32Channels)
+            {
+                std::vector<float> values(level.depthPitch / sizeof(float));
+                for (size_t value = 0; value < values.size(); value++)
+                {
+                    values[value] = static_cast<float>(rand() % 256) / 16.0f;
+                }
+                const uint8_t *bytes = reinterpret_cast<const uint8_t*>(values.data());
+                data.push_back(std::vector<uint8_t>(bytes, bytes + level.depthPitch));
+            }
+            else
+            {
+                data.push_back(data.empty() ? RandomBytes(level.depthPitch) : std::vector<uint8_t>(level.depthPitch));
+            }
+
+            level.data = data.back().data();
+            chain.levels.push_back(level);
+        }
+
+        const size_t topLevelBytes = chain.levels[0].depthPitch;
+        perf_test::PrintResult("mip_chain", "", function.name, MeasureThroughput(chain, topLevelBytes), "MB/s", true);
+
+        MipLevelRun level = { function.generateMip, chain.levels[0], chain.levels[1] };
+        perf_test::PrintResult("mip_level", "", function.name, MeasureThroughput(level, topLevelBytes), "MB/s", true);
+    }
+}
+
+struct CopyRun
+{
+    rx::ColorCopyFunction copyFunction;
+    const uint8_t *source;
+    uint8_t *dest;
+    size_t count;
+
+    void operator()() const
+    {
+        copyFunction(source, dest, count);
+    }
+};
+
+TEST(ImageConversionBenchmark, CopyFunctions)
+{
+    const size_t pixelCount = 1024 * 1024;
+
+    for (size_t i = 0; i < GetCopyFunctions().size(); i++)
+    {
+        const CopyFunctionInfo &function = GetCopyFunctions()[i];
+
+        std::vector<uint8_t> source = RandomBytes(pixelCount * function.sourcePixelBytes);
+        std::vector<uint8_t> dest(pixelCount * function.destPixelBytes);
+
+        CopyRun run = { function.copyFunction, source.data(), dest.data(), pixelCount };
+        perf_test::PrintResult("copy", "", function.name, MeasureThroughput(run, source.size()), "MB/s", true);
+    }
+}
+
+struct LoadTaskRun
+{
+    rx::ScratchMemoryPool *scratchPool;
+    size_t size;
+    const uint8_t *input;
+    uint8_t *output;
+
+    void operator()() const
+    {
+        rx::ImageLoadTask task;
+        task.start(scratchPool, rx::LoadRGB8ToBGRX8, size, size, 1, input, size * 3, size * size * 3, size * 3,
+                   output, size * 4, size * size * 4);
+        task.wait();
+    }
+};
+
+// Compares a large upload converted on the calling thread with the same upload handed to
+// ImageLoadTask, which pays for a copy of the input to convert it on worker threads.
+TEST(ImageConversionBenchmark, ImageLoadTask)
+{
+    const size_t size = 2048;
+
+    std::vector<uint8_t> input = RandomBytes(size * size * 3);
+    std::vector<uint8_t> output(size * size * 4);
+
+    const LoadFunctionInfo *function = NULL;
+    for (size_t i = 0; i < GetLoadFunctions().size(); i++)
+    {
+        if (GetLoadFunctions()[i].loadFunction == rx::LoadRGB8ToBGRX8)
+        {
+            function = &GetLoadFunctions()[i];
+        }
+    }
+    ASSERT_NE(nullptr, function);
+
+    LoadRun sync = { function, size, size, input.data(), size * 3, output.data(), size * 4 };
+    perf_test::PrintResult("load_task", "", "sync", MeasureThroughput(sync, input.size()), "MB/s", true);
+
+    rx::ScratchMemoryPool scratchPool(input.size() * 2);
+    LoadTaskRun async = { &scratchPool, size, input.data(), output.data() };
+    perf_test::PrintResult("load_task", "", "async", MeasureThroughput(async, input.size()), "MB/s", true);
+}
+
+}
@@ -0,0 +1,310 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// ImageConversionFunctions.cpp: Lists the CPU image conversion functions of the D3D renderers.
+
+#include "ImageConversionFunctions.h"
+
+#include "common/angleutils.h"
+#include "common/mathutil.h"
+#include "libANGLE/renderer/d3d/copyimage.h"
+#include "libANGLE/renderer/d3d/generatemip.h"
+#include "libANGLE/renderer/d3d/imageformats.h"
+#include "libANGLE/renderer/d3d/loadimage.h"
+
+using namespace rx;
+
+namespace image_conversion_tests
+{
+
+namespace
+{
+
+// Entries are named after the function expression, which may contain commas in template arguments.
+#define PIXEL_LOAD(inputBytes, inputAlignment, outputBytes, ...) \
+    { #__VA_ARGS__, __VA_ARGS__, inputBytes, inputAlignment, outputBytes, 1, false, NULL }
+
+#define SSE2_PIXEL_LOAD(inputBytes, inputAlignment, outputBytes, function) \
+    { #function "_SSE2", function##_SSE2, inputBytes, inputAlignment, outputBytes, 1, false, function }
+
+#define BLOCK_LOAD(blockBytes, outputBytes, outputIsBlocks, ...) \
+    { #__VA_ARGS__, __VA_ARGS__, blockBytes, 1, outputBytes, 4, outputIsBlocks, NULL }
+
+const LoadFunctionInfo LoadFunctions[] =
+{
+    PIXEL_LOAD(1, 1, 4, LoadA8ToRGBA8),
+    PIXEL_LOAD(1, 1, 4, LoadA8ToBGRA8),
+    PIXEL_LOAD(4, 4, 16, LoadA32FToRGBA32F),
+    PIXEL_LOAD(2, 2, 8, LoadA16FToRGBA16F),
+    PIXEL_LOAD(1, 1, 4, LoadL8ToRGBA8),
+    PIXEL_LOAD(1, 1, 4, LoadL8ToBGRA8),
+    PIXEL_LOAD(4, 4, 16, LoadL32FToRGBA32F),
+    PIXEL_LOAD(2, 2, 8, LoadL16FToRGBA16F),
+    PIXEL_LOAD(2, 1, 4, LoadLA8ToRGBA8),
+    PIXEL_LOAD(2, 1, 4, LoadLA8ToBGRA8),
+    PIXEL_LOAD(8, 4, 16, LoadLA32FToRGBA32F),
+    PIXEL_LOAD(4, 2, 8, LoadLA16FToRGBA16F),
+    PIXEL_LOAD(3, 1, 4, LoadRGB8ToBGRX8),
+    PIXEL_LOAD(2, 1, 4, LoadRG8ToBGRX8),
+    PIXEL_LOAD(1, 1, 4, LoadR8ToBGRX8),
+    PIXEL_LOAD(2, 2, 4, LoadR5G6B5ToBGRA8),
+    PIXEL_LOAD(2, 2, 4, LoadR5G6B5ToRGBA8),
+    PIXEL_LOAD(4, 4, 4, LoadRGBA8ToBGRA8),
+    PIXEL_LOAD(2, 2, 4, LoadRGBA4ToBGRA8),
+    PIXEL_LOAD(2, 2, 4, LoadRGBA4ToRGBA8),
+    PIXEL_LOAD(2, 2, 4, LoadBGRA4ToBGRA8),
+    PIXEL_LOAD(2, 2, 4, LoadRGB5A1ToBGRA8),
+    PIXEL_LOAD(2, 2, 4, LoadRGB5A1ToRGBA8),
+    PIXEL_LOAD(2, 2, 4, LoadBGR5A1ToBGRA8),
+    PIXEL_LOAD(4, 4, 4, LoadRGB10A2ToRGBA8),
+    PIXEL_LOAD(6, 2, 4, LoadRGB16FToRGB9E5),
+    PIXEL_LOAD(12, 4, 4, LoadRGB32FToRGB9E5),
+    PIXEL_LOAD(6, 2, 4, LoadRGB16FToRG11B10F),
+    PIXEL_LOAD(12, 4, 4, LoadRGB32FToRG11B10F),
+    PIXEL_LOAD(4, 4, 4, LoadG8R24ToR24G8),
+    PIXEL_LOAD(12, 4, 8, LoadRGB32FToRGBA16F),
+    PIXEL_LOAD(4, 4, 2, LoadR32ToR16),
+    PIXEL_LOAD(4, 4, 4, LoadR32ToR24G8),
+
+    SSE2_PIXEL_LOAD(1, 1, 4, LoadA8ToBGRA8),
+    SSE2_PIXEL_LOAD(1, 1, 4, LoadL8ToRGBA8),
+    SSE2_PIXEL_LOAD(2, 1, 4, LoadLA8ToRGBA8),
+    SSE2_PIXEL_LOAD(3, 1, 4, LoadRGB8ToBGRX8),
+    SSE2_PIXEL_LOAD(2, 2, 4, LoadR5G6B5ToBGRA8),
+    SSE2_PIXEL_LOAD(2, 2, 4, LoadR5G6B5ToRGBA8),
+    SSE2_PIXEL_LOAD(4, 4, 4, LoadRGBA8ToBGRA8),
+    SSE2_PIXEL_LOAD(2, 2, 4, LoadRGBA4ToBGRA8),
+    SSE2_PIXEL_LOAD(2, 2, 4, LoadRGBA4ToRGBA8),
+    SSE2_PIXEL_LOAD(2, 2, 4, LoadRGB5A1ToBGRA8),
+    SSE2_PIXEL_LOAD(2, 2, 4, LoadRGB5A1ToRGBA8),
+
+    PIXEL_LOAD(1, 1, 1, LoadToNative<GLubyte, 1>),
+    PIXEL_LOAD(2, 1, 2, LoadToNative<GLubyte, 2>),
+    PIXEL_LOAD(3, 1, 3, LoadToNative<GLubyte, 3>),
+    PIXEL_LOAD(4, 1, 4, LoadToNative<GLubyte, 4>),
+    PIXEL_LOAD(1, 1, 1, LoadToNative<GLbyte, 1>),
+    PIXEL_LOAD(2, 1, 2, LoadToNative<GLbyte, 2>),
+    PIXEL_LOAD(4, 1, 4, LoadToNative<GLbyte, 4>),
+    PIXEL_LOAD(2, 2, 2, LoadToNative<GLushort, 1>),
+    PIXEL_LOAD(4, 2, 4, LoadToNative<GLushort, 2>),
+    PIXEL_LOAD(6, 2, 6, LoadToNative<GLushort, 3>),
+    PIXEL_LOAD(8, 2, 8, LoadToNative<GLushort, 4>),
+    PIXEL_LOAD(2, 2, 2, LoadToNative<GLshort, 1>),
+    PIXEL_LOAD(4, 2, 4, LoadToNative<GLshort, 2>),
+    PIXEL_LOAD(8, 2, 8, LoadToNative<GLshort, 4>),
+    PIXEL_LOAD(4, 4, 4, LoadToNative<GLuint, 1>),
+    PIXEL_LOAD(8, 4, 8, LoadToNative<GLuint, 2>),
+    PIXEL_LOAD(12, 4, 12, LoadToNative<GLuint, 3>),
+    PIXEL_LOAD(16, 4, 16, LoadToNative<GLuint, 4>),
+    PIXEL_LOAD(4, 4, 4, LoadToNative<GLint, 1>),
+    PIXEL_LOAD(8, 4, 8, LoadToNative<GLint, 2>),
+    PIXEL_LOAD(16, 4, 16, LoadToNative<GLint, 4>),
+    PIXEL_LOAD(4, 4, 4, LoadToNative<GLfloat, 1>),
+    PIXEL_LOAD(8, 4, 8, LoadToNative<GLfloat, 2>),
+    PIXEL_LOAD(12, 4, 12, LoadToNative<GLfloat, 3>),
+    PIXEL_LOAD(16, 4, 16, LoadToNative<GLfloat, 4>),
+
+    PIXEL_LOAD(3, 1, 4, LoadToNative3To4<GLubyte, 0x01>),
+    PIXEL_LOAD(3, 1, 4, LoadToNative3To4<GLubyte, 0xFF>),
+    PIXEL_LOAD(3, 1, 4, LoadToNative3To4<GLbyte, 0x01>),
+    PIXEL_LOAD(3, 1, 4, LoadToNative3To4<GLbyte, 0x7F>),
+    PIXEL_LOAD(6, 2, 8, LoadToNative3To4<GLushort, 0x0001>),
+    PIXEL_LOAD(6, 2, 8, LoadToNative3To4<GLshort, 0x0001>),
+    PIXEL_LOAD(6, 2, 8, LoadToNative3To4<GLhalf, gl::Float16One>),
+    PIXEL_LOAD(12, 4, 16, LoadToNative3To4<GLuint, 0x00000001>),
+    PIXEL_LOAD(12, 4, 16, LoadToNative3To4<GLint, 0x00000001>),
+    PIXEL_LOAD(12, 4, 16, LoadToNative3To4<GLfloat, gl::Float32One>),
+
+    PIXEL_LOAD(4, 4, 2, Load32FTo16F<1>),
+    PIXEL_LOAD(8, 4, 4, Load32FTo16F<2>),
+    PIXEL_LOAD(16, 4, 8, Load32FTo16F<4>),
+
+    BLOCK_LOAD(8, 8, true, LoadCompressedToNative<4, 4, 8>),
+    BLOCK_LOAD(16, 16, true, LoadCompressedToNative<4, 4, 16>),
+    BLOCK_LOAD(8, 4, false, LoadETC2RGB8ToRGBA8),
+    BLOCK_LOAD(8, 4, false, LoadETC2RGB8A1ToRGBA8),
+    BLOCK_LOAD(16, 4, false, LoadETC2RGBA8ToRGBA8),
+    BLOCK_LOAD(8, 1, false, LoadEACR11ToR8),
+    BLOCK_LOAD(8, 2, false, LoadEACR11SToR16),
+    BLOCK_LOAD(16, 2, false, LoadEACRG11ToRG8),
+    BLOCK_LOAD(16, 4, false, LoadEACRG11SToRG16),
+};
+
+#undef PIXEL_LOAD
+#undef SSE2_PIXEL_LOAD
+#undef BLOCK_LOAD
+
+template <typename T>
+const T *GetPixel(const uint8_t *data, size_t x, size_t y, size_t z, size_t rowPitch, size_t depthPitch)
+{
+    return reinterpret_cast<const T*>(data + x * sizeof(T) + y * rowPitch + z * depthPitch);
+}
+
+// Averages the samples of a box pairwise, the way rx::GenerateMip does: samples are ordered with
+// x outermost and z innermost, and neighbouring pairs are averaged until one is left.
+template <typename T>
+void ReferenceMip(size_t sourceWidth, size_t sourceHeight, size_t sourceDepth,
+                  const uint8_t *sourceData, size_t sourceRowPitch, size_t sourceDepthPitch,
+                  uint8_t *destData, size_t destRowPitch, size_t destDepthPitch)
+{
+    const size_t destWidth = std::max<size_t>(1, sourceWidth / 2);
+    const size_t destHeight = std::max<size_t>(1, sourceHeight / 2);
+    const size_t destDepth = std::max<size_t>(1, sourceDepth / 2);
+
+    const size_t xSamples = (sourceWidth > 1) ? 2 : 1;
+    const size_t ySamples = (sourceHeight > 1) ? 2 : 1;
+    const size_t zSamples = (sourceDepth > 1) ? 2 : 1;
+
+    for (size_t z = 0; z < destDepth; z++)
+    {
+        for (size_t y = 0; y < destHeight; y++)
+        {
+            for (size_t x = 0; x < destWidth; x++)
+            {
+                T samples[8];
+                size_t sampleCount = 0;
+                for (size_t sx = 0; sx < xSamples; sx++)
+                {
+                    for (size_t sy = 0; sy < ySamples; sy++)
+                    {
+                        for (size_t sz = 0; sz < zSamples; sz++)
+                        {
+                            samples[sampleCount++] = *GetPixel<T>(sourceData, x * xSamples + sx, y * ySamples + sy,
+                                                                  z * zSamples + sz, sourceRowPitch, sourceDepthPitch);
+                        }
+                    }
+                }
+
+                while (sampleCount > 1)
+                {
+                    for (size_t i = 0; i < sampleCount / 2; i++)
+                    {
+                        T average;
+                        T::average(&average, &samples[i * 2], &samples[i * 2 + 1]);
+                        samples[i] = average;
+                    }
+                    sampleCount /= 2;
+                }
+
+                T *dest = reinterpret_cast<T*>(destData + x * sizeof(T) + y * destRowPitch + z * destDepthPitch);
+                *dest = samples[0];
+            }
+        }
+    }
+}
+
+#define MIP_FUNCTION(type, hasFloat32Channels) \
+    { #type, GenerateMip<type>, ReferenceMip<type>, sizeof(type), hasFloat32Channels }
+
+const MipFunctionInfo MipFunctions[] =
+{
+    MIP_FUNCTION(L8, false),
+    MIP_FUNCTION(R8, false),
+    MIP_FUNCTION(A8, false),
+    MIP_FUNCTION(L8A8, false),
+    MIP_FUNCTION(A8L8, false),
+    MIP_FUNCTION(R8G8, false),
+    MIP_FUNCTION(R8G8B8, false),
+    MIP_FUNCTION(B8G8R8, false),
+    MIP_FUNCTION(R5G6B5, false),
+    MIP_FUNCTION(A8R8G8B8, false),
+    MIP_FUNCTION(R8G8B8A8, false),
+    MIP_FUNCTION(B8G8R8A8, false),
+    MIP_FUNCTION(B8G8R8X8, false),
+    MIP_FUNCTION(B5G5R5A1, false),
+    MIP_FUNCTION(R5G5B5A1, false),
+    MIP_FUNCTION(R4G4B4A4, false),
+    MIP_FUNCTION(A4R4G4B4, false),
+    MIP_FUNCTION(B4G4R4A4, false),
+    MIP_FUNCTION(R16, false),
+    MIP_FUNCTION(R16G16, false),
+    MIP_FUNCTION(R16G16B16, false),
+    MIP_FUNCTION(R16G16B16A16, false),
+    MIP_FUNCTION(R32, false),
+    MIP_FUNCTION(R32G32, false),
+    MIP_FUNCTION(R32G32B32, false),
+    MIP_FUNCTION(R32G32B32A32, false),
+    MIP_FUNCTION(R8S, false),
+    MIP_FUNCTION(R8G8S, false),
+    MIP_FUNCTION(R8G8B8S, false),
+    MIP_FUNCTION(R8G8B8A8S, false),
+    MIP_FUNCTION(R16S, false),
+    MIP_FUNCTION(R16G16S, false),
+    MIP_FUNCTION(R16G16B16S, false),
+    MIP_FUNCTION(R16G16B16A16S, false),
+    MIP_FUNCTION(R32S, false),
+    MIP_FUNCTION(R32G32S, false),
+    MIP_FUNCTION(R32G32B32S, false),
+    MIP_FUNCTION(R32G32B32A32S, false),
+    MIP_FUNCTION(A16B16G16R16F, false),
+    MIP_FUNCTION(R16G16B16A16F, false),
+    MIP_FUNCTION(R16F, false),
+    MIP_FUNCTION(A16F, false),
+    MIP_FUNCTION(L16F, false),
+    MIP_FUNCTION(L16A16F, false),
+    MIP_FUNCTION(R16G16F, false),
+    MIP_FUNCTION(R16G16B16F, false),
+    MIP_FUNCTION(A32B32G32R32F, true),
+    MIP_FUNCTION(R32G32B32A32F, true),
+    MIP_FUNCTION(R32F, true),
+    MIP_FUNCTION(A32F, true),
+    MIP_FUNCTION(L32F, true),
+    MIP_FUNCTION(L32A32F, true),
+    MIP_FUNCTION(R32G32F, true),
+    MIP_FUNCTION(R32G32B32F, true),
+    MIP_FUNCTION(R10G10B10A2, false),
+    MIP_FUNCTION(R9G9B9E5, false),
+    MIP_FUNCTION(R11G11B10F, false),
+};
+
+#undef MIP_FUNCTION
+
+#define COPY_FUNCTION(sourceType, destType) \
+    { #sourceType " to " #destType, CopyUnormPixels<sourceType, destType>, CopyPixel<sourceType, destType, GLfloat>, \
+      sizeof(sourceType), sizeof(destType) }
+
+// The source formats and copy destinations of the D3D11 fast copy table
+#define COPY_FUNCTIONS_FROM(sourceType)          \
+    COPY_FUNCTION(sourceType, R8G8B8A8),         \
+    COPY_FUNCTION(sourceType, R4G4B4A4),         \
+    COPY_FUNCTION(sourceType, R5G5B5A1),         \
+    COPY_FUNCTION(sourceType, R10G10B10A2),      \
+    COPY_FUNCTION(sourceType, R5G6B5),           \
+    COPY_FUNCTION(sourceType, B8G8R8A8),         \
+    COPY_FUNCTION(sourceType, B4G4R4A4),         \
+    COPY_FUNCTION(sourceType, B5G5R5A1)
+
+const CopyFunctionInfo CopyFunctions[] =
+{
+    COPY_FUNCTIONS_FROM(R8G8B8A8),
+    COPY_FUNCTIONS_FROM(B8G8R8A8),
+    COPY_FUNCTIONS_FROM(R10G10B10A2),
+};
+
+#undef COPY_FUNCTIONS_FROM
+#undef COPY_FUNCTION
+
+}
+
+const std::vector<LoadFunctionInfo> &GetLoadFunctions()
+{
+    static const std::vector<LoadFunctionInfo> functions(LoadFunctions, LoadFunctions + ArraySize(LoadFunctions));
+    return functions;
+}
+
+const std::vector<MipFunctionInfo> &GetMipFunctions()
+{
+    static const std::vector<MipFunctionInfo> functions(MipFunctions, MipFunctions + ArraySize(MipFunctions));
+    return functions;
+}
+
+const std::vector<CopyFunctionInfo> &GetCopyFunctions()
+{
+    static const std::vector<CopyFunctionInfo> functions(CopyFunctions, CopyFunctions + ArraySize(CopyFunctions));
+    return functions;
+}
+
+}
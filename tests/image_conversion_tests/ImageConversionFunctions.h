@@ -0,0 +1,74 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// ImageConversionFunctions.h: Lists the CPU image conversion functions of the D3D renderers, with
+// what the fuzz tests and benchmarks need to know to call them and to check their results.
+
+#ifndef IMAGE_CONVERSION_TESTS_IMAGECONVERSIONFUNCTIONS_H_
+#define IMAGE_CONVERSION_TESTS_IMAGECONVERSIONFUNCTIONS_H_
+
+#include "libANGLE/renderer/d3d/formatutilsD3D.h"
+
+#include <cstddef>
+#include <stdint.h>
+#include <vector>
+
+namespace image_conversion_tests
+{
+
+struct LoadFunctionInfo
+{
+    const char *name;
+    rx::LoadImageFunction loadFunction;
+
+    // Size of an input pixel, or of an input block for block compressed formats
+    size_t inputBytes;
+    // Alignment of the input components, which row and depth pitches must keep
+    size_t inputAlignment;
+    // Size of an output pixel, or of an output block when outputIsBlocks is set
+    size_t outputBytes;
+
+    // 4 for formats loaded in 4x4 blocks, 1 otherwise
+    size_t blockSize;
+    bool outputIsBlocks;
+
+    // For vectorized functions, the scalar function that must give the same output
+    rx::LoadImageFunction scalarFunction;
+};
+
+const std::vector<LoadFunctionInfo> &GetLoadFunctions();
+
+struct MipFunctionInfo
+{
+    const char *name;
+    rx::MipGenerationFunction generateMip;
+    // Pixel by pixel box filter, averaging in the same order as generateMip
+    rx::MipGenerationFunction referenceMip;
+
+    size_t pixelBytes;
+    // Formats with 32-bit float channels are only given finite values, since which NaN payload
+    // survives an average depends on how the compiler orders the operands.
+    bool hasFloat32Channels;
+};
+
+const std::vector<MipFunctionInfo> &GetMipFunctions();
+
+struct CopyFunctionInfo
+{
+    const char *name;
+    rx::ColorCopyFunction copyFunction;
+    // Converts one pixel through gl::ColorF
+    void (*referencePixelCopy)(const uint8_t *source, uint8_t *dest);
+
+    size_t sourcePixelBytes;
+    size_t destPixelBytes;
+};
+
+const std::vector<CopyFunctionInfo> &GetCopyFunctions();
+
+}
+
+#endif // IMAGE_CONVERSION_TESTS_IMAGECONVERSIONFUNCTIONS_H_
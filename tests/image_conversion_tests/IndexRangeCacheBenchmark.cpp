@@ -0,0 +1,149 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// IndexRangeCacheBenchmark.cpp: Measures the lookups, invalidations and buffer range queries of
+// IndexRangeCache, next to the plain scans that a cache miss costs.
+
+#include "gtest/gtest.h"
+#include "third_party/perf/perf_test.h"
+
+#include "libANGLE/renderer/IndexRangeCache.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+
+const double MinimumSeconds = 0.05;
+const size_t MinimumRuns = 3;
+
+// Returns how many million operations per second work goes through
+template <typename Work>
+double MeasureRate(Work work, size_t operationsPerRun)
+{
+    typedef std::chrono::steady_clock Clock;
+
+    Clock::time_point start = Clock::now();
+    double seconds = 0.0;
+    size_t runs = 0;
+    while (runs < MinimumRuns || seconds < MinimumSeconds)
+    {
+        work();
+        runs++;
+        seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    }
+
+    return (static_cast<double>(operationsPerRun) * runs) / (seconds * 1000000.0);
+}
+
+// Draws of DrawCount consecutive ranges of DrawIndices unsigned short indices each
+const GLsizei DrawIndices = 96;
+const unsigned int DrawCount = 1024;
+const unsigned int DrawBytes = DrawIndices * sizeof(GLushort);
+
+void FillCache(rx::IndexRangeCache *cache)
+{
+    for (unsigned int drawIndex = 0; drawIndex < DrawCount; drawIndex++)
+    {
+        unsigned int offset = drawIndex * DrawBytes;
+        cache->addRange(GL_UNSIGNED_SHORT, offset, DrawIndices, false, rx::RangeUI(0, DrawIndices), offset);
+    }
+}
+
+struct LookupRun
+{
+    const rx::IndexRangeCache *cache;
+
+    void operator()() const
+    {
+        rx::RangeUI range;
+        for (unsigned int drawIndex = 0; drawIndex < DrawCount; drawIndex++)
+        {
+            cache->findRange(GL_UNSIGNED_SHORT, drawIndex * DrawBytes, DrawIndices, false, &range, NULL);
+        }
+    }
+};
+
+// Updates one draw's indices at a time, as glBufferSubData of a small region does, and caches
+// its range again
+struct InvalidateRun
+{
+    rx::IndexRangeCache *cache;
+
+    void operator()() const
+    {
+        for (unsigned int drawIndex = 0; drawIndex < DrawCount; drawIndex++)
+        {
+            unsigned int offset = drawIndex * DrawBytes;
+            cache->invalidateRange(offset, DrawBytes);
+            cache->addRange(GL_UNSIGNED_SHORT, offset, DrawIndices, false, rx::RangeUI(0, DrawIndices), offset);
+        }
+    }
+};
+
+struct ScanRun
+{
+    const GLushort *indices;
+    GLsizei count;
+
+    void operator()() const
+    {
+        rx::IndexRangeCache::ComputeRange(GL_UNSIGNED_SHORT, indices, count, false);
+    }
+};
+
+struct BufferRangeRun
+{
+    const rx::IndexRangeCache *cache;
+    const uint8_t *data;
+    size_t size;
+    GLsizei count;
+
+    void operator()() const
+    {
+        cache->computeBufferRange(GL_UNSIGNED_SHORT, data, size, 0, count, false);
+    }
+};
+
+TEST(IndexRangeCacheBenchmark, Lookups)
+{
+    rx::IndexRangeCache cache;
+    FillCache(&cache);
+
+    LookupRun lookup = { &cache };
+    perf_test::PrintResult("index_range_cache", "", "find_range", MeasureRate(lookup, DrawCount),
+                           "Mlookups/s", true);
+
+    InvalidateRun invalidate = { &cache };
+    perf_test::PrintResult("index_range_cache", "", "invalidate_range", MeasureRate(invalidate, DrawCount),
+                           "Minvalidations/s", true);
+}
+
+TEST(IndexRangeCacheBenchmark, BufferRanges)
+{
+    const GLsizei count = 4 * 1024 * 1024;
+
+    std::vector<GLushort> indices(count);
+    for (size_t i = 0; i < indices.size(); i++)
+    {
+        indices[i] = static_cast<GLushort>(rand());
+    }
+
+    ScanRun scan = { indices.data(), count };
+    perf_test::PrintResult("index_range_cache", "_scan", "ushort", MeasureRate(scan, count),
+                           "Mindices/s", true);
+
+    // The summary is built by the first query and reused by the rest
+    rx::IndexRangeCache cache;
+    BufferRangeRun bufferRange = { &cache, reinterpret_cast<const uint8_t*>(indices.data()),
+                                   indices.size() * sizeof(GLushort), count };
+    perf_test::PrintResult("index_range_cache", "_summary", "ushort", MeasureRate(bufferRange, count),
+                           "Mindices/s", true);
+}
+
+}
@@ -0,0 +1,172 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// LoadImageFuzz_test.cpp: Runs every load function over random sizes and pitches, and compares it
+// with loading the same image one pixel or one block at a time.
+
+#include "gtest/gtest.h"
+
+#include "ImageConversionFunctions.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+namespace image_conversion_tests
+{
+
+// Lets gtest name the parameter of a failing test
+void PrintTo(const LoadFunctionInfo &function, std::ostream *os)
+{
+    *os << function.name;
+}
+
+}
+
+using namespace image_conversion_tests;
+
+namespace
+{
+
+// Value of the output bytes that a load must not write
+const uint8_t CanaryByte = 0xCD;
+
+struct LoadLayout
+{
+    size_t width;
+    size_t height;
+    size_t depth;
+
+    size_t inputRowPitch;
+    size_t inputDepthPitch;
+    size_t inputSize;
+
+    size_t outputRowPitch;
+    size_t outputDepthPitch;
+    size_t outputSize;
+};
+
+size_t RandomPadding(size_t alignment)
+{
+    return (rand() % 4) * alignment;
+}
+
+// Pitches are padded by random amounts, keeping the alignment of the components. The input ends
+// right after the last row, as client memory may, so that reading past it is caught by ASan.
+LoadLayout GetRandomLayout(const LoadFunctionInfo &function, size_t width, size_t height, size_t depth)
+{
+    size_t columns = (width + function.blockSize - 1) / function.blockSize;
+    size_t rows = (height + function.blockSize - 1) / function.blockSize;
+    size_t outputRows = function.outputIsBlocks ? rows : height;
+    size_t outputRowBytes = function.outputIsBlocks ? columns * function.outputBytes : width * function.outputBytes;
+
+    LoadLayout layout;
+    layout.width = width;
+    layout.height = height;
+    layout.depth = depth;
+
+    size_t inputRowBytes = columns * function.inputBytes;
+    layout.inputRowPitch = inputRowBytes + RandomPadding(function.inputAlignment);
+    layout.inputDepthPitch = layout.inputRowPitch * rows + RandomPadding(function.inputAlignment);
+    layout.inputSize = (depth - 1) * layout.inputDepthPitch + (rows - 1) * layout.inputRowPitch + inputRowBytes;
+
+    layout.outputRowPitch = outputRowBytes + RandomPadding(16);
+    layout.outputDepthPitch = layout.outputRowPitch * outputRows + RandomPadding(16);
+    layout.outputSize = layout.outputDepthPitch * depth;
+
+    return layout;
+}
+
+// Loads the image one pixel, or one block, per call
+void LoadPieceByPiece(const LoadFunctionInfo &function, const LoadLayout &layout, const uint8_t *input, uint8_t *output)
+{
+    const size_t blockSize = function.blockSize;
+    const size_t outputRowsPerBlock = function.outputIsBlocks ? 1 : blockSize;
+    const size_t outputBytesPerBlock = function.outputIsBlocks ? function.outputBytes : function.outputBytes * blockSize;
+
+    for (size_t z = 0; z < layout.depth; z++)
+    {
+        for (size_t y = 0; y < layout.height; y += blockSize)
+        {
+            for (size_t x = 0; x < layout.width; x += blockSize)
+            {
+                size_t blockX = x / blockSize;
+                size_t blockY = y / blockSize;
+
+                const uint8_t *pieceInput = input + z * layout.inputDepthPitch + blockY * layout.inputRowPitch +
+                                            blockX * function.inputBytes;
+                uint8_t *pieceOutput = output + z * layout.outputDepthPitch + blockY * outputRowsPerBlock * layout.outputRowPitch +
+                                       blockX * outputBytesPerBlock;
+
+                function.loadFunction(std::min(blockSize, layout.width - x), std::min(blockSize, layout.height - y), 1,
+                                      pieceInput, layout.inputRowPitch, layout.inputDepthPitch,
+                                      pieceOutput, layout.outputRowPitch, layout.outputDepthPitch);
+            }
+        }
+    }
+}
+
+void CheckLoad(const LoadFunctionInfo &function, size_t width, size_t height, size_t depth)
+{
+    const LoadLayout layout = GetRandomLayout(function, width, height, depth);
+
+    std::vector<uint8_t> input(layout.inputSize);
+    for (size_t i = 0; i < input.size(); i++)
+    {
+        input[i] = static_cast<uint8_t>(rand());
+    }
+
+    std::vector<uint8_t> expected(layout.outputSize, CanaryByte);
+    LoadPieceByPiece(function, layout, input.data(), expected.data());
+
+    std::vector<uint8_t> actual(layout.outputSize, CanaryByte);
+    function.loadFunction(width, height, depth, input.data(), layout.inputRowPitch, layout.inputDepthPitch,
+                          actual.data(), layout.outputRowPitch, layout.outputDepthPitch);
+
+    // Comparing the padding too checks that neither load wrote outside of the image
+    ASSERT_TRUE(expected == actual) << function.name << " " << width << "x" << height << "x" << depth
+                                    << " input pitches " << layout.inputRowPitch << "/" << layout.inputDepthPitch
+                                    << " output pitches " << layout.outputRowPitch << "/" << layout.outputDepthPitch;
+
+    if (function.scalarFunction != NULL)
+    {
+        std::vector<uint8_t> scalar(layout.outputSize, CanaryByte);
+        function.scalarFunction(width, height, depth, input.data(), layout.inputRowPitch, layout.inputDepthPitch,
+                                scalar.data(), layout.outputRowPitch, layout.outputDepthPitch);
+        ASSERT_TRUE(scalar == actual) << function.name << " differs from its scalar version at "
+                                      << width << "x" << height << "x" << depth;
+    }
+}
+
+class LoadImageFuzzTest : public testing::TestWithParam<LoadFunctionInfo>
+{
+};
+
+TEST_P(LoadImageFuzzTest, MatchesPieceByPieceLoad)
+{
+    const LoadFunctionInfo &function = GetParam();
+    srand(0);
+
+    CheckLoad(function, 1, 1, 1);
+    for (size_t iteration = 0; iteration < 40; iteration++)
+    {
+        CheckLoad(function, 1 + rand() % 70, 1 + rand() % 13, 1 + rand() % 3);
+    }
+
+    // Large enough for the block decoders to split the image across threads
+    if (function.blockSize > 1)
+    {
+        CheckLoad(function, 1031, 1029, 1);
+    }
+    else
+    {
+        CheckLoad(function, 517, 263, 1);
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(AllLoadFunctions, LoadImageFuzzTest, testing::ValuesIn(GetLoadFunctions()));
+
+}
@@ -0,0 +1,129 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// PrimitiveIndicesBenchmark.cpp: Measures the generation of line loop and triangle fan indices,
+// next to the plain loops it replaced.
+
+#include "gtest/gtest.h"
+#include "third_party/perf/perf_test.h"
+
+#include "libANGLE/renderer/d3d/primitiveindices.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+const double MinimumSeconds = 0.05;
+const size_t MinimumRuns = 3;
+
+// Returns how many million source vertices per second work goes through
+template <typename Work>
+double MeasureVertexRate(Work work, size_t verticesPerRun)
+{
+    typedef std::chrono::steady_clock Clock;
+
+    Clock::time_point start = Clock::now();
+    double seconds = 0.0;
+    size_t runs = 0;
+    while (runs < MinimumRuns || seconds < MinimumSeconds)
+    {
+        work();
+        runs++;
+        seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    }
+
+    return (static_cast<double>(verticesPerRun) * runs) / (seconds * 1000000.0);
+}
+
+template <typename T>
+struct PlainLoopRun
+{
+    const T *indices;
+    GLuint count;
+    GLuint *output;
+    bool fan;
+
+    void operator()() const
+    {
+        if (fan)
+        {
+            for (GLuint i = 0; i + 2 < count; i++)
+            {
+                output[i * 3 + 0] = indices[0];
+                output[i * 3 + 1] = indices[i + 1];
+                output[i * 3 + 2] = indices[i + 2];
+            }
+        }
+        else
+        {
+            for (GLuint i = 0; i < count; i++)
+            {
+                output[i] = indices[i];
+            }
+            output[count] = indices[0];
+        }
+    }
+};
+
+struct GeneratedRun
+{
+    GLenum type;
+    const void *indices;
+    GLuint count;
+    GLuint *output;
+    bool fan;
+
+    void operator()() const
+    {
+        if (fan)
+        {
+            rx::GenerateTriangleFanIndices(type, indices, count, output);
+        }
+        else
+        {
+            rx::GenerateLineLoopIndices(type, indices, count, output);
+        }
+    }
+};
+
+template <typename T>
+void MeasureIndexType(GLenum type, const char *typeName)
+{
+    const GLuint count = 1024 * 1024;
+
+    std::vector<T> indices(count);
+    for (size_t i = 0; i < indices.size(); i++)
+    {
+        indices[i] = static_cast<T>(rand());
+    }
+    std::vector<GLuint> output(count * 3);
+
+    for (int fan = 0; fan < 2; fan++)
+    {
+        std::string trace = std::string(typeName) + (fan ? "_fan" : "_loop");
+
+        PlainLoopRun<T> plainLoop = { indices.data(), count, output.data(), fan != 0 };
+        perf_test::PrintResult("primitive_indices", "_plain_loop", trace, MeasureVertexRate(plainLoop, count),
+                               "Mvertices/s", true);
+
+        GeneratedRun generated = { type, indices.data(), count, output.data(), fan != 0 };
+        perf_test::PrintResult("primitive_indices", "", trace, MeasureVertexRate(generated, count),
+                               "Mvertices/s", true);
+    }
+}
+
+TEST(PrimitiveIndicesBenchmark, IndexTypes)
+{
+    MeasureIndexType<GLubyte>(GL_UNSIGNED_BYTE, "ubyte");
+    MeasureIndexType<GLushort>(GL_UNSIGNED_SHORT, "ushort");
+    MeasureIndexType<GLuint>(GL_UNSIGNED_INT, "uint");
+}
+
+}
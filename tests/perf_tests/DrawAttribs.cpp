@@ -0,0 +1,175 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "DrawAttribs.h"
+
+#include <algorithm>
+#include <cassert>
+#include <sstream>
+
+#include "shader_utils.h"
+
+std::string DrawAttribsParams::suffix() const
+{
+    std::stringstream strstr;
+
+    strstr << BenchmarkParams::suffix()
+           << "_" << attribCount << "attribs"
+           << "_" << verticesPerDraw << "vertices";
+
+    if (interleaved)
+    {
+        strstr << "_interleaved";
+    }
+
+    return strstr.str();
+}
+
+DrawAttribsBenchmark::DrawAttribsBenchmark(const DrawAttribsParams &params)
+    : SimpleBenchmark("DrawAttribs", 64, 64, 2, params),
+      mProgram(0),
+      mBuffer(0),
+      mTotalDraws(0),
+      mTotalDrawTime(0.0),
+      mDrawTimer(CreateTimer()),
+      mParams(params)
+{
+    mDrawIterations = mParams.iterations;
+    assert(mParams.iterations > 0);
+    assert(mParams.attribCount > 0);
+    assert(mParams.verticesPerDraw > 0 && mParams.verticesPerDraw % 3 == 0);
+}
+
+bool DrawAttribsBenchmark::initializeBenchmark()
+{
+    GLint maxAttribs = 0;
+    glGetIntegerv(GL_MAX_VERTEX_ATTRIBS, &maxAttribs);
+    if (mParams.attribCount > static_cast<unsigned int>(maxAttribs))
+    {
+        return false;
+    }
+
+    // Every attribute contributes to the position, so none of them is optimized out
+    std::stringstream vs;
+    for (unsigned int attrib = 0; attrib < mParams.attribCount; attrib++)
+    {
+        vs << "attribute vec4 a" << attrib << ";\n";
+    }
+    vs << "void main()\n"
+       << "{\n"
+       << "    gl_Position = a0";
+    for (unsigned int attrib = 1; attrib < mParams.attribCount; attrib++)
+    {
+        vs << " + a" << attrib << " * 0.001";
+    }
+    vs << ";\n"
+       << "}\n";
+
+    const std::string fs = SHADER_SOURCE
+    (
+        precision mediump float;
+        void main()
+        {
+            gl_FragColor = vec4(1.0, 0.0, 0.0, 1.0);
+        }
+    );
+
+    mProgram = CompileProgram(vs.str(), fs);
+    if (!mProgram)
+    {
+        return false;
+    }
+
+    glUseProgram(mProgram);
+
+    // Tiny triangles scattered over the window
+    const unsigned int streamedCount = mParams.attribCount / 2;
+    const unsigned int clientComponents = mParams.interleaved ? streamedCount * 4 : 4;
+    mBufferData.resize(mParams.verticesPerDraw * 4);
+    mClientData.resize(mParams.verticesPerDraw * clientComponents);
+    for (unsigned int vertex = 0; vertex < mParams.verticesPerDraw; vertex++)
+    {
+        GLfloat x = static_cast<GLfloat>(vertex % 31) / 16.0f - 0.95f;
+        GLfloat y = static_cast<GLfloat>(vertex / 3 % 29) / 15.0f - 0.95f;
+        GLfloat position[4] = { x + (vertex % 3 == 1 ? 0.02f : 0.0f), y + (vertex % 3 == 2 ? 0.02f : 0.0f), 0.0f, 1.0f };
+
+        std::copy(position, position + 4, mBufferData.begin() + vertex * 4);
+        for (unsigned int component = 0; component < clientComponents; component++)
+        {
+            mClientData[vertex * clientComponents + component] = position[component % 4];
+        }
+    }
+
+    glGenBuffers(1, &mBuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, mBuffer);
+    glBufferData(GL_ARRAY_BUFFER, mBufferData.size() * sizeof(GLfloat), mBufferData.data(), GL_STATIC_DRAW);
+
+    for (unsigned int attrib = 0; attrib < mParams.attribCount; attrib++)
+    {
+        std::stringstream name;
+        name << "a" << attrib;
+
+        GLint location = glGetAttribLocation(mProgram, name.str().c_str());
+        if (location == -1)
+        {
+            return false;
+        }
+
+        if (attrib % 2 == 0)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, mBuffer);
+            glVertexAttribPointer(location, 4, GL_FLOAT, GL_FALSE, 0, 0);
+        }
+        else
+        {
+            GLsizei stride = clientComponents * sizeof(GLfloat);
+            const GLfloat *pointer = mClientData.data() + (mParams.interleaved ? (attrib / 2) * 4 : 0);
+
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+            glVertexAttribPointer(location, 4, GL_FLOAT, GL_FALSE, stride, pointer);
+        }
+        glEnableVertexAttribArray(location);
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    GLenum glErr = glGetError();
+    if (glErr != GL_NO_ERROR)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+void DrawAttribsBenchmark::destroyBenchmark()
+{
+    printResult("draws", mTotalDraws, "draws", false);
+
+    if (mTotalDraws > 0)
+    {
+        double nsPerDraw = (mTotalDrawTime * 1.0e9) / static_cast<double>(mTotalDraws);
+        printResult("time_per_draw", nsPerDraw, "ns", true);
+    }
+
+    glDeleteBuffers(1, &mBuffer);
+    glDeleteProgram(mProgram);
+}
+
+void DrawAttribsBenchmark::drawBenchmark()
+{
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    mDrawTimer->start();
+    for (unsigned int draw = 0; draw < mParams.drawsPerIteration; draw++)
+    {
+        glDrawArrays(GL_TRIANGLES, 0, mParams.verticesPerDraw);
+    }
+    mDrawTimer->stop();
+
+    mTotalDrawTime += mDrawTimer->getElapsedTime();
+    mTotalDraws += mParams.drawsPerIteration;
+}
@@ -0,0 +1,56 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "SimpleBenchmark.h"
+
+struct DrawAttribsParams : public BenchmarkParams
+{
+    virtual std::string suffix() const;
+
+    // Number of vertex attributes used by the program, alternately sourced from a buffer object
+    // and streamed from client memory
+    unsigned int attribCount;
+
+    // Whether the streamed attributes share one interleaved client array, rather than each
+    // reading its own
+    bool interleaved;
+
+    // Number of vertices per glDrawArrays call, drawn as small triangles
+    unsigned int verticesPerDraw;
+
+    // Number of glDrawArrays calls per draw iteration
+    unsigned int drawsPerIteration;
+
+    // static parameters
+    unsigned int iterations;
+};
+
+// Measures the per-draw cost of preparing vertex attributes, with small triangles whose
+// rasterization is negligible next to the attribute translation.
+class DrawAttribsBenchmark : public SimpleBenchmark
+{
+  public:
+    DrawAttribsBenchmark(const DrawAttribsParams &params);
+
+    virtual bool initializeBenchmark();
+    virtual void destroyBenchmark();
+    virtual void drawBenchmark();
+
+    typedef DrawAttribsParams Params;
+
+  private:
+    DISALLOW_COPY_AND_ASSIGN(DrawAttribsBenchmark);
+
+    GLuint mProgram;
+    GLuint mBuffer;
+    std::vector<GLfloat> mBufferData;
+    std::vector<GLfloat> mClientData;
+    size_t mTotalDraws;
+    double mTotalDrawTime;
+    std::unique_ptr<Timer> mDrawTimer;
+
+    const DrawAttribsParams mParams;
+};
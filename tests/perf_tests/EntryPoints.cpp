@@ -0,0 +1,113 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "EntryPoints.h"
+
+#include <cassert>
+#include <sstream>
+
+#include "shader_utils.h"
+
+std::string EntryPointsParams::suffix() const
+{
+    std::stringstream strstr;
+
+    strstr << BenchmarkParams::suffix()
+           << "_" << callsPerIteration << "calls";
+
+    return strstr.str();
+}
+
+EntryPointsBenchmark::EntryPointsBenchmark(const EntryPointsParams &params)
+    : SimpleBenchmark("EntryPoints", 64, 64, 2, params),
+      mProgram(0),
+      mUniformLocation(-1),
+      mTotalCalls(0),
+      mTotalCallTime(0.0),
+      mCallTimer(CreateTimer()),
+      mParams(params)
+{
+    mDrawIterations = mParams.iterations;
+    assert(mParams.iterations > 0);
+}
+
+bool EntryPointsBenchmark::initializeBenchmark()
+{
+    const std::string vs = SHADER_SOURCE
+    (
+        attribute vec4 vPosition;
+        uniform float uScale;
+        void main()
+        {
+            gl_Position = vPosition * uScale;
+        }
+    );
+
+    const std::string fs = SHADER_SOURCE
+    (
+        precision mediump float;
+        void main()
+        {
+            gl_FragColor = vec4(1.0, 0.0, 0.0, 1.0);
+        }
+    );
+
+    mProgram = CompileProgram(vs, fs);
+    if (!mProgram)
+    {
+        return false;
+    }
+
+    glUseProgram(mProgram);
+
+    mUniformLocation = glGetUniformLocation(mProgram, "uScale");
+    if (mUniformLocation == -1)
+    {
+        return false;
+    }
+
+    GLenum glErr = glGetError();
+    if (glErr != GL_NO_ERROR)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+void EntryPointsBenchmark::destroyBenchmark()
+{
+    printResult("calls", mTotalCalls, "calls", false);
+
+    if (mTotalCalls > 0)
+    {
+        double nsPerCall = (mTotalCallTime * 1.0e9) / static_cast<double>(mTotalCalls);
+        printResult("time_per_call", nsPerCall, "ns", true);
+    }
+
+    glDeleteProgram(mProgram);
+}
+
+void EntryPointsBenchmark::drawBenchmark()
+{
+    // No draw call consumes the uniform, so each call only pays for the entry point and its
+    // validation.
+    mCallTimer->start();
+    for (unsigned int call = 0; call < mParams.callsPerIteration; call++)
+    {
+        glUniform1f(mUniformLocation, 1.0f);
+    }
+    mCallTimer->stop();
+
+    mTotalCallTime += mCallTimer->getElapsedTime();
+    mTotalCalls += mParams.callsPerIteration;
+}
+
+void EntryPointsBenchmark::endDrawBenchmark()
+{
+    // Keep the swap from presenting undefined contents.
+    glClear(GL_COLOR_BUFFER_BIT);
+}
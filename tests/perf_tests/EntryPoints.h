@@ -0,0 +1,44 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "SimpleBenchmark.h"
+
+struct EntryPointsParams : public BenchmarkParams
+{
+    virtual std::string suffix() const;
+
+    // Number of glUniform1f calls per draw iteration
+    unsigned int callsPerIteration;
+
+    // static parameters
+    unsigned int iterations;
+};
+
+// Measures the fixed cost of a GL entry point by repeatedly issuing a call that does no work
+// beyond fetching the current context and validating its arguments.
+class EntryPointsBenchmark : public SimpleBenchmark
+{
+  public:
+    EntryPointsBenchmark(const EntryPointsParams &params);
+
+    virtual bool initializeBenchmark();
+    virtual void destroyBenchmark();
+    virtual void drawBenchmark();
+    virtual void endDrawBenchmark();
+
+    typedef EntryPointsParams Params;
+
+  private:
+    DISALLOW_COPY_AND_ASSIGN(EntryPointsBenchmark);
+
+    GLuint mProgram;
+    GLint mUniformLocation;
+    size_t mTotalCalls;
+    double mTotalCallTime;
+    std::unique_ptr<Timer> mCallTimer;
+
+    const EntryPointsParams mParams;
+};
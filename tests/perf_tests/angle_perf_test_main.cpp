@@ -8,6 +8,8 @@
 #include "BufferSubData.h"
 #include "TexSubImage.h"
 #include "PointSprites.h"
+#include "EntryPoints.h"
+#include "DrawAttribs.h"
 
 #include <iostream>
 #include <rapidjson/document.h>
@@ -243,6 +245,69 @@ bool ParseBenchmarkParams(const rapidjson::Document &document, PointSpritesParam
     return true;
 }
 
+bool ParseBenchmarkParams(const rapidjson::Document &document, EntryPointsParams *params)
+{
+    auto callsPerIteration = GetUintMember(document, "calls_per_iteration");
+    auto iterations = GetUintMember(document, "iterations");
+
+    if (!callsPerIteration.valid || !iterations.valid)
+    {
+        return false;
+    }
+
+    if (callsPerIteration.value == 0 || iterations.value == 0)
+    {
+        std::cerr << "Zero calls or iterations not valid." << std::endl;
+        return false;
+    }
+
+    params->callsPerIteration = callsPerIteration.value;
+    params->iterations = iterations.value;
+
+    return true;
+}
+
+bool ParseBenchmarkParams(const rapidjson::Document &document, DrawAttribsParams *params)
+{
+    auto attribCount = GetUintMember(document, "attrib_count");
+    auto interleaved = GetBoolMember(document, "interleaved");
+    auto verticesPerDraw = GetUintMember(document, "vertices_per_draw");
+    auto drawsPerIteration = GetUintMember(document, "draws_per_iteration");
+    auto iterations = GetUintMember(document, "iterations");
+
+    if (!attribCount.valid || !interleaved.valid || !verticesPerDraw.valid || !drawsPerIteration.valid ||
+        !iterations.valid)
+    {
+        return false;
+    }
+
+    if (attribCount.value == 0)
+    {
+        std::cerr << "Zero attributes not valid." << std::endl;
+        return false;
+    }
+
+    if (verticesPerDraw.value == 0 || verticesPerDraw.value % 3 != 0)
+    {
+        std::cerr << "Vertices per draw must be a non-zero multiple of 3: " << verticesPerDraw.value << std::endl;
+        return false;
+    }
+
+    if (drawsPerIteration.value == 0 || iterations.value == 0)
+    {
+        std::cerr << "Zero draws or iterations not valid." << std::endl;
+        return false;
+    }
+
+    params->attribCount = attribCount.value;
+    params->interleaved = interleaved.value;
+    params->verticesPerDraw = verticesPerDraw.value;
+    params->drawsPerIteration = drawsPerIteration.value;
+    params->iterations = iterations.value;
+
+    return true;
+}
+
 template <class BenchT>
 int ParseAndRunBenchmark(EGLint rendererType, const rapidjson::Document &document)
 {
@@ -315,6 +380,14 @@ int main(int argc, char **argv)
     {
         return ParseAndRunBenchmark<PointSpritesBenchmark>(rendererType, document);
     }
+    else if (testName.value == "EntryPoints")
+    {
+        return ParseAndRunBenchmark<EntryPointsBenchmark>(rendererType, document);
+    }
+    else if (testName.value == "DrawAttribs")
+    {
+        return ParseAndRunBenchmark<DrawAttribsBenchmark>(rendererType, document);
+    }
     else
     {
         std::cerr << "Unknown test: " << testName.value << std::endl;
@@ -172,6 +172,32 @@
                         },
                     },
                 },
+                {
+                    'target_name': 'angle_image_conversion_tests',
+                    'type': 'executable',
+                    'includes':
+                    [
+                        '../build/common_defines.gypi',
+                        'angle_image_conversion_tests.gypi',
+                    ],
+                    'sources':
+                    [
+                        '<@(angle_image_conversion_tests_sources)',
+                    ],
+                },
+                {
+                    'target_name': 'angle_image_conversion_perftests',
+                    'type': 'executable',
+                    'includes':
+                    [
+                        '../build/common_defines.gypi',
+                        'angle_image_conversion_tests.gypi',
+                    ],
+                    'sources':
+                    [
+                        '<@(angle_image_conversion_perftests_sources)',
+                    ],
+                },
             ],
             'conditions':
             [
@@ -220,6 +246,10 @@
                     [
                         'perf_tests/BufferSubData.cpp',
                         'perf_tests/BufferSubData.h',
+                        'perf_tests/DrawAttribs.cpp',
+                        'perf_tests/DrawAttribs.h',
+                        'perf_tests/EntryPoints.cpp',
+                        'perf_tests/EntryPoints.h',
                         'perf_tests/PointSprites.cpp',
                         'perf_tests/PointSprites.h',
                         'perf_tests/SimpleBenchmark.cpp',